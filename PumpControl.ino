@@ -1,20 +1,9 @@
 /*
   Форматирование prettier --print-width 120 --html-whitespace-sensitivity css --write compressed.html
-  Cжатие gzip -k -9 index.html
-  Перевод .gz в .h - % xxd -i index.html.gz > index_html_gz.h
-
-  #ifndef INDEX_HTML_GZ_H
-  #define INDEX_HTML_GZ_H
-
-  #include <stdint.h>
-
-  static const uint8_t index_html_gz[] PROGMEM = {
-  ... 0x00
-  };
-
-  static const unsigned int index_html_gz_len = sizeof(index_html_gz);
-
-  #endif
+  Встроенный интерфейс (ui_bundle_data.h, варианты gzip и brotli) и образы
+  data/index.html.gz, data/index.html.br собираются из index.html:
+    python3 tools/pack_ui.py index.html --data-dir data
+  Файлы index.html / index.html.gz / index.html.br в SPIFFS имеют приоритет над бандлом.
 */
 
 #include <ESP8266WiFi.h>
@@ -24,24 +13,120 @@
 #include "wifimanager.h"
 #include "control.h"
 #include "webserver.h"
+#include "scheduler.h"
+#include "profiler.h"
+#include "button.h"
+#include "history.h"
+#include "telemetry_store.h"
+#include "rollup.h"
+#include "event_journal.h"
 
 SettingsManager settingsManager;
 WiFiManager wifiManager(settingsManager);
-ControlManager controlManager(settingsManager);
-WebServerManager webServer(settingsManager, controlManager); // <-- Создали объект сервера
+ControlManager controlManager(settingsManager.settings.control);
+HistoryManager historyManager;
+TelemetryStore telemetryStore("/ts");
+RollupManager rollupManager;
+EventJournal eventJournal;
+TaskScheduler scheduler;
+WebServerManager webServer(settingsManager, controlManager, historyManager, rollupManager, eventJournal, telemetryStore, scheduler); // <-- Создали объект сервера
+ButtonInput button;
+
+void rebootTask() {
+  Serial.println("Main: Reboot requested by web server. Restarting...");
+  telemetryStore.flush();
+  eventJournal.flush();
+  ESP.restart();
+}
+
+void saveSettingsTask() {
+  if (!settingsManager.settings.isSaveRequested) {
+    return;
+  }
+
+  Serial.println("Main: Save request detected. Saving settings to SPIFFS...");
+
+  bool needsReboot = settingsManager.settings.isRebootRequested;
+
+  if (settingsManager.saveSettings()) {
+    Serial.println("Main: Settings saved successfully.");
+  } else {
+    Serial.println("Main: ERROR: Failed to save settings to SPIFFS!");
+  }
+
+  settingsManager.settings.isSaveRequested = false;
+  settingsManager.settings.isRebootRequested = false;
+
+  if (needsReboot) {
+    scheduler.addOneShot("reboot", rebootTask, 100, 0, PRIORITY_HOUSEKEEPING);
+  }
+}
+
+void wifiTask() {
+  wifiManager.loop();
+
+  StatusLed& statusLed = controlManager.getStatusLed();
+  statusLed.setActive(LED_PATTERN_CONNECTING, wifiManager.isConnecting());
+  statusLed.setActive(LED_PATTERN_AP, wifiManager.isInFallbackAP());
+}
+
+void onReading(uint8_t channel, uint16_t distanceMm, bool isPumpOn, void* context) {
+  if (channel == 0) {
+    rollupManager.addReading(historyManager.getUptimeSec(), distanceMm, isPumpOn);
+  }
+}
+
+void onEvent(uint8_t channel, ControlEvent event, EventReason reason, uint16_t distanceMm, void* context) {
+  eventJournal.record(historyManager.getUptimeSec(), event, reason, channel, distanceMm);
+}
+
+void historyTask() {
+  historyManager.addSample(millis(), controlManager.getCurrentDistance(), controlManager.getPumpState());
+}
+
+void telemetryTask() {
+  for (uint8_t ch = 0; ch < controlManager.getChannelCount(); ch++) {
+    uint8_t flags = (controlManager.getPumpState(ch) ? TELEMETRY_FLAG_PUMP : 0) |
+                    (settingsManager.settings.control.manualMode_pump ? TELEMETRY_FLAG_MANUAL : 0) |
+                    (controlManager.isErrorState(ch) ? TELEMETRY_FLAG_ERROR : 0);
+    telemetryStore.append(millis(), controlManager.getCurrentDistance(ch), flags, ch);
+  }
+}
+
+void buttonTask() {
+  switch (button.poll()) {
+    case BUTTON_SHORT_PRESS:
+      Serial.println("Main: Button short press, toggling pump manually.");
+      controlManager.setManualMode(true);
+      controlManager.setPumpState(!controlManager.getPumpState());
+      break;
+    case BUTTON_LONG_PRESS:
+      Serial.println("Main: Button long press, returning to automatic mode.");
+      controlManager.setManualMode(false);
+      break;
+    default:
+      break;
+  }
+}
 
 void setup() {
   Serial.begin(115200);
   Serial.println("\nStarting...");
 
   settingsManager.begin();
+  telemetryStore.begin();
+  eventJournal.begin();
+  eventJournal.record(0, EVENT_BOOT, REASON_NONE, 0, 0);
 
   delay(200);
   
+  controlManager.setReadingCallback(onReading, nullptr);
+  controlManager.setEventCallback(onEvent, nullptr);
   controlManager.begin();
+  button.begin(settingsManager.settings.control.pin_button);
 
   delay(200);
-  if (digitalRead(settingsManager.settings.control.pin_button) == LOW ) {
+  if (button.isPressed()) {
     settingsManager.settings.isWifiTurnedOn = false;
   } else {
     settingsManager.settings.isWifiTurnedOn = true;
@@ -51,32 +136,20 @@ void setup() {
   wifiManager.begin();
   delay(200);
   webServer.begin();
+
+  scheduler.addPeriodic("control", []() { controlManager.update(); }, 0, 5000, PRIORITY_CONTROL);
+  scheduler.addPeriodic("wifi", wifiTask, 10, 20000, PRIORITY_NETWORK);
+  scheduler.addPeriodic("mdns", []() { MDNS.update(); }, 50, 50000, PRIORITY_NETWORK);
+  scheduler.addPeriodic("live", []() { webServer.loop(); }, 100, 0, PRIORITY_NETWORK);
+  scheduler.addPeriodic("button", buttonTask, 20, 0, PRIORITY_HOUSEKEEPING);
+  scheduler.addPeriodic("history", historyTask, 1000, 0, PRIORITY_HOUSEKEEPING);
+  scheduler.addPeriodic("telemetry", telemetryTask, 10000, 0, PRIORITY_HOUSEKEEPING);
+  scheduler.addPeriodic("events", []() { eventJournal.flush(); }, 1000, 0, PRIORITY_HOUSEKEEPING);
+  scheduler.addPeriodic("settings", saveSettingsTask, 100, 0, PRIORITY_HOUSEKEEPING);
+  scheduler.addPeriodic("trace", []() { controlManager.getTraceRecorder().flush(); }, 1000, 0, PRIORITY_HOUSEKEEPING);
 }
 
 void loop() {
-  wifiManager.loop();
-
-  controlManager.update();
-
-  if (settingsManager.settings.isSaveRequested) {
-    Serial.println("Main: Save request detected. Saving settings to SPIFFS...");
-
-    bool needsReboot = settingsManager.settings.isRebootRequested;
-
-    if (settingsManager.saveSettings()) {
-      Serial.println("Main: Settings saved successfully.");
-    } else {
-      Serial.println("Main: ERROR: Failed to save settings to SPIFFS!");
-    }
-
-    settingsManager.settings.isSaveRequested = false;
-    settingsManager.settings.isRebootRequested = false;
-
-    if (needsReboot) {
-      Serial.println("Main: Reboot requested by web server. Restarting...");
-      delay(100);
-      ESP.restart();
-    }
-  }
-
+  PROFILE_SCOPE(PROFILE_LOOP);
+  scheduler.run();
 }
@@ -0,0 +1,66 @@
+#include "button.h"
+
+ButtonInput* ButtonInput::_instance = nullptr;
+
+ButtonInput::ButtonInput() {}
+
+void ButtonInput::begin(int pin) {
+    if (pin < 0) return;
+
+    _pin = pin;
+    pinMode(_pin, INPUT_PULLUP);
+    _isPressed = digitalRead(_pin) == LOW;
+    _lastEdgeMs = millis();
+    _pressStartMs = _lastEdgeMs;
+    // Кнопка, зажатая при старте, выключает Wi-Fi и не должна давать событие
+    _isLongReported = _isPressed;
+
+    _instance = this;
+    attachInterrupt(digitalPinToInterrupt(_pin), _onChange, CHANGE);
+}
+
+ButtonEvent ButtonInput::poll() {
+    if (_pin < 0) return BUTTON_NONE;
+
+    unsigned long now = millis();
+    bool level = digitalRead(_pin) == LOW;
+
+    noInterrupts();
+    // Если последний фронт попал в окно дребезга, состояние догоняется здесь
+    _handleLevel(level, now);
+
+    ButtonEvent event = _pendingEvent;
+    _pendingEvent = BUTTON_NONE;
+    if (event == BUTTON_NONE && _isPressed && !_isLongReported && now - _pressStartMs >= LONG_PRESS_MS) {
+        _isLongReported = true;
+        event = BUTTON_LONG_PRESS;
+    }
+    interrupts();
+
+    return event;
+}
+
+bool ButtonInput::isPressed() const {
+    return _isPressed;
+}
+
+void IRAM_ATTR ButtonInput::_handleLevel(bool isPressed, unsigned long nowMs) {
+    if (isPressed == _isPressed || nowMs - _lastEdgeMs < DEBOUNCE_MS) return;
+
+    _lastEdgeMs = nowMs;
+    _isPressed = isPressed;
+
+    if (isPressed) {
+        _pressStartMs = nowMs;
+        _isLongReported = false;
+    } else if (!_isLongReported) {
+        _pendingEvent = (nowMs - _pressStartMs >= LONG_PRESS_MS) ? BUTTON_LONG_PRESS : BUTTON_SHORT_PRESS;
+    }
+}
+
+void IRAM_ATTR ButtonInput::_onChange() {
+    ButtonInput* self = _instance;
+    if (!self) return;
+
+    self->_handleLevel(digitalRead(self->_pin) == LOW, millis());
+}
@@ -0,0 +1,38 @@
+#ifndef BUTTON_H
+#define BUTTON_H
+
+#include <Arduino.h>
+
+enum ButtonEvent : uint8_t {
+    BUTTON_NONE = 0,
+    BUTTON_SHORT_PRESS,
+    BUTTON_LONG_PRESS
+};
+
+// Кнопка на землю с подтяжкой. Фронты ловятся прерыванием с подавлением
+// дребезга, poll() только забирает готовое событие.
+class ButtonInput {
+public:
+    static const unsigned long DEBOUNCE_MS = 30;
+    static const unsigned long LONG_PRESS_MS = 1500;
+
+    ButtonInput();
+    void begin(int pin);
+    ButtonEvent poll();
+    bool isPressed() const;
+
+private:
+    static ButtonInput* _instance;
+    static void IRAM_ATTR _onChange();
+
+    int _pin = -1;
+    volatile bool _isPressed = false;
+    volatile bool _isLongReported = false;
+    volatile unsigned long _lastEdgeMs = 0;
+    volatile unsigned long _pressStartMs = 0;
+    volatile ButtonEvent _pendingEvent = BUTTON_NONE;
+
+    void IRAM_ATTR _handleLevel(bool isPressed, unsigned long nowMs);
+};
+
+#endif
@@ -1,86 +1,132 @@
 #include "control.h"
 
-ControlManager::ControlManager(SettingsManager& settingsManager)
-    : _settingsManager(settingsManager), _sonar(nullptr) {
-
-    for (int i = 0; i < MEDIAN_FILTER_SIZE; i++) {
-        _distanceReadings[i] = 0.0;
-    }
-    _readingIndex = 0;
-}
+ControlManager::ControlManager(PumpControlSettings& settings)
+    : _settings(settings) {}
 
 void ControlManager::begin() {
-    const auto& control = _settingsManager.settings.control;
-
-    pinMode(control.pin_pump, OUTPUT);
-    pinMode(control.pin_led, OUTPUT);
-    pinMode(control.pin_button, INPUT_PULLUP);
+    const auto& control = _settings;
+
+    _channelCount = control.channelCount;
+    if (_channelCount < 1) _channelCount = 1;
+    if (_channelCount > MAX_CHANNELS) _channelCount = MAX_CHANNELS;
+
+    for (uint8_t ch = 0; ch < _channelCount; ch++) {
+        const ChannelSettings& channel = control.channels[ch];
+        if (channel.pin_pump < 0 || channel.pin_trig < 0 || channel.pin_echo < 0) {
+            Serial.printf("ControlManager: Channel %u has no pins assigned, using %u channel(s).\n", ch, ch);
+            _channelCount = ch;
+            break;
+        }
 
-    analogWrite(control.pin_led, 80);
+        hal::pinOutput(channel.pin_pump);
+        _controlPin(ch, false);
+#if defined(CONTROL_BENCH_GPIO) && defined(CONTROL_FIXED_PIN_PUMP) && defined(ARDUINO)
+        if (ch == 0) _benchmarkPinWrites();
+#endif
+        _sonar.addChannel(channel.pin_trig, channel.pin_echo);
+    }
 
-    _controlPin(false);
-    _controlLed(0, false);
+    _statusLed.begin(control.pin_led);
 
-    _sonar = new NewPing(control.pin_trig, control.pin_echo, 400);
+    _sonar.setInterval(control.sampleIntervalMs);
+    _sonar.begin(MAX_SENSOR_DISTANCE);
 
-    Serial.println("ControlManager: Pins initialized and sensor object created.");
+    Serial.printf("ControlManager: Pins initialized and sensor sampler started for %u channel(s).\n", _channelCount);
 }
 
 void ControlManager::update() {
+    PROFILE_SCOPE(PROFILE_CONTROL_UPDATE);
+
+    _sonar.setInterval(_settings.sampleIntervalMs);
+
+#ifdef CONTROL_PROFILE_CYCLES
+    uint32_t startCycles = hal::cycleCount();
+#endif
+
+    uint8_t channel;
+    uint16_t rawDistance;
+    uint16_t distance;
+    if (_readSensor(channel, rawDistance, distance)) {
+        _processReading(channel, distance);
+        _stateVersion++;
+        if (channel == 0) {
+            _traceRecorder.record(hal::millis(), rawDistance, _hasBit(_pumpOnMask, 0), _settings.manualMode_pump);
+        }
+        if (_readingCallback) {
+            _readingCallback(channel, distance, _hasBit(_pumpOnMask, channel), _readingContext);
+        }
+#ifdef CONTROL_PROFILE_CYCLES
+        uint32_t cycles = hal::cycleCount() - startCycles;
+        _profileLevelPaths(channel, rawDistance);
+        _profileSample(cycles);
+#endif
+    }
 
-    float distance = _readSensor();
-    _settingsManager.settings.control.currentDistance = distance;
+    _statusLed.setActive(LED_PATTERN_ERROR, _errorMask != 0);
+    _statusLed.setActive(LED_PATTERN_PUMP_ON, _pumpOnMask != 0);
+}
 
-    const int maxSensorDistance = 400;
+void ControlManager::_processReading(uint8_t channel, uint16_t distance) {
+    _distanceMm[channel] = distance;
 
- bool isOutOfRange = (distance < 30) ||  (distance > 380);
+    bool isOutOfRange = (distance < MIN_VALID_DISTANCE) || (distance > MAX_VALID_DISTANCE);
+    bool isError = _hasBit(_errorMask, channel);
+    bool isPotentialError = _hasBit(_potentialErrorMask, channel);
 
-    if (!_settingsManager.settings.control.manualMode_pump) {
+    if (!_settings.manualMode_pump) {
         if (isOutOfRange) {
-            if (!_isPotentialErrorState) {
-                Serial.println("ControlManager: Out of range detected. Starting error timer.");
-                _isPotentialErrorState = true;
-                _errorConditionStartTime = millis();
-            } else if (!_isErrorState && (millis() - _errorConditionStartTime > _errorDelayMs)) {
-                Serial.println("ControlManager: Error timer expired. Entering ERROR state.");
-                _isErrorState = true;
+            if (!isPotentialError) {
+                Serial.printf("ControlManager: [ch %u] Out of range detected. Starting error timer.\n", channel);
+                _setBit(_potentialErrorMask, channel, true);
+                _errorStartMs[channel] = hal::millis();
+            } else if (!isError && (hal::millis() - _errorStartMs[channel] > _errorDelayMs)) {
+                Serial.printf("ControlManager: [ch %u] Error timer expired. Entering ERROR state.\n", channel);
+                _setBit(_errorMask, channel, true);
+                _emitEvent(channel, EVENT_ERROR_ENTER, REASON_OUT_OF_RANGE);
             }
         } else {
-            if (_isErrorState || _isPotentialErrorState) {
-                Serial.println("ControlManager: Back in range. Clearing error state.");
+            if (isError || isPotentialError) {
+                Serial.printf("ControlManager: [ch %u] Back in range. Clearing error state.\n", channel);
             }
-            _isErrorState = false;
-            _isPotentialErrorState = false;
+            if (isError) _emitEvent(channel, EVENT_ERROR_EXIT, REASON_BACK_IN_RANGE);
+            _setBit(_errorMask, channel, false);
+            _setBit(_potentialErrorMask, channel, false);
         }
     } else {
-        if (_isErrorState || _isPotentialErrorState) {
-            Serial.println("ControlManager: Manual mode active. Clearing any previous error state.");
-            _isErrorState = false;
-            _isPotentialErrorState = false;
+        if (isError || isPotentialError) {
+            Serial.printf("ControlManager: [ch %u] Manual mode active. Clearing any previous error state.\n", channel);
+            _setBit(_errorMask, channel, false);
+            _setBit(_potentialErrorMask, channel, false);
+            if (isError) _emitEvent(channel, EVENT_ERROR_EXIT, REASON_MANUAL);
         }
     }
 
-    if (!_settingsManager.settings.control.manualMode_pump) {
-        _controlPump();
+    if (!_settings.manualMode_pump) {
+        _controlPump(channel);
     }
+}
 
-    if (_isErrorState) {
-        _controlLed(0, true);
-    } else {
-        if (_isPumpOn) {
-            _controlLed(200, false);
-        } else {
-            _controlLed(80, false);
-        }
-    }
+uint8_t ControlManager::getChannelCount() const {
+    return _channelCount;
+}
+
+uint16_t ControlManager::getCurrentDistance(uint8_t channel) const {
+    return (channel < _channelCount) ? _distanceMm[channel] : 0;
 }
 
-float ControlManager::getCurrentDistance() const {
-    return _settingsManager.settings.control.currentDistance;
+int32_t ControlManager::getLevelRate(uint8_t channel) const {
+    // Отсчёты канала идут не через sampleIntervalMs, а через период очереди датчиков
+    unsigned long periodMs = _sonar.getChannelPeriodMs();
+    if (periodMs == 0 || channel >= _channelCount) return 0;
+    return _distanceFilters[channel].deltaOver(1000) / (int32_t)periodMs;
 }
 
 void ControlManager::setManualMode(bool enabled) {
-    _settingsManager.settings.control.manualMode_pump = enabled;
+    if (enabled != _settings.manualMode_pump) {
+        _emitEvent(0, enabled ? EVENT_MANUAL_MODE : EVENT_AUTO_MODE, REASON_NONE);
+    }
+    _settings.manualMode_pump = enabled;
+    _stateVersion++;
     if (enabled) {
         Serial.println("ControlManager: Switched to MANUAL mode.");
     } else {
@@ -88,96 +134,211 @@ void ControlManager::setManualMode(bool enabled) {
     }
 }
 
-void ControlManager::setPumpState(bool isOn) {
-    if (_settingsManager.settings.control.manualMode_pump) {
-        _isPumpOn = isOn;
-        _controlPin(_isPumpOn);
-        Serial.printf("ControlManager: Manual pump state set to %s\n", _isPumpOn ? "ON" : "OFF");
+void ControlManager::setPumpState(bool isOn, uint8_t channel) {
+    if (_settings.manualMode_pump && channel < _channelCount) {
+        if (isOn != _hasBit(_pumpOnMask, channel)) {
+            _emitEvent(channel, isOn ? EVENT_PUMP_ON : EVENT_PUMP_OFF, REASON_MANUAL);
+        }
+        _setBit(_pumpOnMask, channel, isOn);
+        _controlPin(channel, isOn);
+        _stateVersion++;
+        Serial.printf("ControlManager: [ch %u] Manual pump state set to %s\n", channel, isOn ? "ON" : "OFF");
     }
 }
 
-bool ControlManager::getPumpState() const {
-    return _isPumpOn;
+bool ControlManager::getPumpState(uint8_t channel) const {
+    return _hasBit(_pumpOnMask, channel);
 }
 
-bool ControlManager::isErrorState() const {
-    return _isErrorState;
+bool ControlManager::isErrorState(uint8_t channel) const {
+    return _hasBit(_errorMask, channel);
 }
 
-float ControlManager::_readSensor() {
-    if (!_sonar) return 0.0;
-    delay(29);
+uint32_t ControlManager::getStateVersion() const {
+    return _stateVersion;
+}
 
-    float newReading = _sonar->ping_cm();
-    _distanceReadings[_readingIndex] = newReading;
-    _readingIndex = (_readingIndex + 1) % MEDIAN_FILTER_SIZE;
+SonarTraceRecorder& ControlManager::getTraceRecorder() {
+    return _traceRecorder;
+}
 
-    float sortedReadings[MEDIAN_FILTER_SIZE];
-    for (int i = 0; i < MEDIAN_FILTER_SIZE; i++) {
-        sortedReadings[i] = _distanceReadings[i];
-    }
+StatusLed& ControlManager::getStatusLed() {
+    return _statusLed;
+}
 
-    for (int i = 0; i < MEDIAN_FILTER_SIZE - 1; i++) {
-        for (int j = 0; j < MEDIAN_FILTER_SIZE - i - 1; j++) {
-            if (sortedReadings[j] > sortedReadings[j + 1]) {
-                float temp = sortedReadings[j];
-                sortedReadings[j] = sortedReadings[j + 1];
-                sortedReadings[j + 1] = temp;
-            }
-        }
+void ControlManager::setReadingCallback(ReadingCallback callback, void* context) {
+    _readingCallback = callback;
+    _readingContext = context;
+}
+
+void ControlManager::setEventCallback(EventCallback callback, void* context) {
+    _eventCallback = callback;
+    _eventContext = context;
+}
+
+#ifdef CONTROL_PROFILE_CYCLES
+// Путь уровня - фильтр, проверка диапазона и гистерезис с прогнозом - в
+// двух вариантах на одном сыром отсчёте: целые мм (как в _readSensor и
+// _controlPump) и прежние float-сантиметры. Пороги в см считаются до замера,
+// как раньше они лежали в настройках готовыми.
+void ControlManager::_profileLevelPaths(uint8_t channel, uint16_t rawDistance) {
+    const ChannelSettings& config = _settings.channels[channel];
+    int32_t onMm = config.minTriggerMm;
+    int32_t offMm = config.maxTriggerMm;
+    float onCm = config.minTriggerMm * 0.1f;
+    float offCm = config.maxTriggerMm * 0.1f;
+    unsigned int pingCm = rawDistance / 10;
+
+    uint32_t start = hal::cycleCount();
+    DistanceFilter& intFilter = _profileIntFilters[channel];
+    int32_t distanceMm = intFilter.process(rawDistance);
+    _setBit(_profileIntRangeMask, channel, (distanceMm < MIN_VALID_DISTANCE) || (distanceMm > MAX_VALID_DISTANCE));
+    int32_t predictedMm = distanceMm + intFilter.deltaOver(1);
+    bool isIntPumpOn = _hasBit(_profileIntPumpMask, channel);
+    if (predictedMm <= onMm && !isIntPumpOn) isIntPumpOn = true;
+    else if (predictedMm >= offMm && isIntPumpOn) isIntPumpOn = false;
+    _setBit(_profileIntPumpMask, channel, isIntPumpOn);
+    uint32_t intCycles = hal::cycleCount() - start;
+
+    start = hal::cycleCount();
+    FloatDistanceFilter& floatFilter = _profileFloatFilters[channel];
+    float distanceCm = floatFilter.process(pingCm);
+    _setBit(_profileFloatRangeMask, channel, (distanceCm < 30) || (distanceCm > 380));
+    float predictedCm = distanceCm + floatFilter.deltaOver(1);
+    bool isFloatPumpOn = _hasBit(_profileFloatPumpMask, channel);
+    if (predictedCm <= onCm && !isFloatPumpOn) isFloatPumpOn = true;
+    else if (predictedCm >= offCm && isFloatPumpOn) isFloatPumpOn = false;
+    _setBit(_profileFloatPumpMask, channel, isFloatPumpOn);
+    uint32_t floatCycles = hal::cycleCount() - start;
+
+    _profileIntCycles += intCycles;
+    _profileFloatCycles += floatCycles;
+}
+
+void ControlManager::_profileSample(uint32_t cycles) {
+    _profileCycles += cycles;
+    if (cycles > _profileMaxCycles) _profileMaxCycles = cycles;
+    if (++_profileSamples == 100) {
+        Serial.printf("ControlManager: update() cycles per sample avg %u, max %u; level path int32 mm %u, float cm %u\n",
+                      (unsigned)(_profileCycles / _profileSamples), (unsigned)_profileMaxCycles,
+                      (unsigned)(_profileIntCycles / _profileSamples), (unsigned)(_profileFloatCycles / _profileSamples));
+        _profileCycles = 0;
+        _profileMaxCycles = 0;
+        _profileIntCycles = 0;
+        _profileFloatCycles = 0;
+        _profileSamples = 0;
     }
+}
+#endif
+
+#if defined(CONTROL_BENCH_GPIO) && defined(CONTROL_FIXED_PIN_PUMP) && defined(ARDUINO)
+// Пишется только LOW, так что насос при замере не дёргается
+void ControlManager::_benchmarkPinWrites() {
+    const uint32_t iterations = 1000;
+    int pin = _settings.channels[0].pin_pump;
+
+    uint32_t start = hal::cycleCount();
+    for (uint32_t i = 0; i < iterations; i++) hal::writePin(pin, false);
+    uint32_t runtimeCycles = hal::cycleCount() - start;
+
+    start = hal::cycleCount();
+    for (uint32_t i = 0; i < iterations; i++) hal::FastPin<CONTROL_FIXED_PIN_PUMP>::write(false);
+    uint32_t fixedCycles = hal::cycleCount() - start;
+
+    Serial.printf("ControlManager: pin write cycles, digitalWrite %u, FastPin<%d> %u\n",
+                  (unsigned)(runtimeCycles / iterations), CONTROL_FIXED_PIN_PUMP, (unsigned)(fixedCycles / iterations));
+}
+#endif
+
+bool ControlManager::_readSensor(uint8_t& channel, uint16_t& rawDistance, uint16_t& distance) {
+    if (!_sonar.poll(channel, rawDistance)) return false;
 
-    return sortedReadings[MEDIAN_FILTER_SIZE / 2];
+    int32_t filtered = _distanceFilters[channel].process(rawDistance);
+    distance = (filtered < 0) ? 0 : filtered;
+    return true;
 }
 
-void ControlManager::_controlPump() {
-    if (_isErrorState) {
-        if (_isPumpOn) {
-            _isPumpOn = false;
-            _controlPin(_isPumpOn);
-            Serial.println("ControlManager: ERROR state. Pump forced OFF.");
+void ControlManager::_controlPump(uint8_t channel) {
+    bool isPumpOn = _hasBit(_pumpOnMask, channel);
+
+    if (_hasBit(_errorMask, channel)) {
+        if (isPumpOn) {
+            _setBit(_pumpOnMask, channel, false);
+            _controlPin(channel, false);
+            Serial.printf("ControlManager: [ch %u] ERROR state. Pump forced OFF.\n", channel);
+            _emitEvent(channel, EVENT_PUMP_OFF, REASON_ERROR);
         }
         return;
     }
 
-    float distance = _settingsManager.settings.control.currentDistance;
+    const ChannelSettings& config = _settings.channels[channel];
+
+    // Прогноз на следующий отсчёт по оценке скорости наполнения/откачки
+    int32_t distance = _distanceMm[channel] + _distanceFilters[channel].deltaOver(1);
 
-    float onDistance = _settingsManager.settings.control.minTrigger;
+    int32_t onDistance = config.minTriggerMm;
 
-    float offDistance = _settingsManager.settings.control.maxTrigger;
+    int32_t offDistance = config.maxTriggerMm;
 
-    if (distance <= onDistance && !_isPumpOn) {
-        _isPumpOn = true;
-        Serial.printf("ControlManager: Water level is high (%.2f cm). Pump ON.\n", distance);
+    if (distance <= onDistance && !isPumpOn) {
+        isPumpOn = true;
+        Serial.printf("ControlManager: [ch %u] Water level is high (%d mm). Pump ON.\n", channel, (int)distance);
+        _emitEvent(channel, EVENT_PUMP_ON, REASON_LEVEL_HIGH);
     }
 
-    else if (distance >= offDistance && _isPumpOn) {
-        _isPumpOn = false;
-        Serial.printf("ControlManager: Water level is low (%.2f cm). Pump OFF.\n", distance);
+    else if (distance >= offDistance && isPumpOn) {
+        isPumpOn = false;
+        Serial.printf("ControlManager: [ch %u] Water level is low (%d mm). Pump OFF.\n", channel, (int)distance);
+        _emitEvent(channel, EVENT_PUMP_OFF, REASON_LEVEL_LOW);
     }
 
-    _controlPin(_isPumpOn);
+    _setBit(_pumpOnMask, channel, isPumpOn);
+    _controlPin(channel, isPumpOn);
 }
 
-void ControlManager::_controlPin(bool state) {
-    int pin = _settingsManager.settings.control.pin_pump;
-    if (state) {
-         digitalWrite(pin, HIGH);
-    } else {
-         digitalWrite(pin, LOW);
+const char* ControlManager::getEventName(uint8_t event) {
+    switch (event) {
+        case EVENT_BOOT: return "boot";
+        case EVENT_PUMP_ON: return "pumpOn";
+        case EVENT_PUMP_OFF: return "pumpOff";
+        case EVENT_ERROR_ENTER: return "errorEnter";
+        case EVENT_ERROR_EXIT: return "errorExit";
+        case EVENT_MANUAL_MODE: return "manualMode";
+        case EVENT_AUTO_MODE: return "autoMode";
+        default: return "unknown";
     }
 }
 
-void ControlManager::_controlLed(int pwm, bool error) {
-    int pin = _settingsManager.settings.control.pin_led;
+const char* ControlManager::getReasonName(uint8_t reason) {
+    switch (reason) {
+        case REASON_NONE: return "none";
+        case REASON_LEVEL_HIGH: return "levelHigh";
+        case REASON_LEVEL_LOW: return "levelLow";
+        case REASON_ERROR: return "error";
+        case REASON_MANUAL: return "manual";
+        case REASON_OUT_OF_RANGE: return "outOfRange";
+        case REASON_BACK_IN_RANGE: return "backInRange";
+        default: return "unknown";
+    }
+}
 
-    if (error) {
-        if (millis() - _lastBlinkTime > _blinkInterval) {
-            _lastBlinkTime = millis();
-            _ledState = !_ledState;
-        }
-        digitalWrite(pin, _ledState ? HIGH : LOW);
-    } else {
-        analogWrite(pin, pwm);
+void ControlManager::_emitEvent(uint8_t channel, ControlEvent event, EventReason reason) {
+    if (_eventCallback) {
+        _eventCallback(channel, event, reason, _distanceMm[channel], _eventContext);
+    }
+}
+
+// Вывод насоса, зашитый при сборке (-DCONTROL_FIXED_PIN_PUMP=16): если он
+// совпадает с pin_pump из настроек, запись идёт напрямую в регистр.
+// Иначе, как и без флага, через digitalWrite().
+void ControlManager::_controlPin(uint8_t channel, bool state) {
+    int pin = _settings.channels[channel].pin_pump;
+#ifdef CONTROL_FIXED_PIN_PUMP
+    if (pin == CONTROL_FIXED_PIN_PUMP) {
+        hal::FastPin<CONTROL_FIXED_PIN_PUMP>::write(state);
+        return;
     }
+#endif
+    hal::writePin(pin, state);
 }
+
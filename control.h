@@ -1,44 +1,161 @@
 #ifndef CONTROL_H
 #define CONTROL_H
 
-#include <Arduino.h>
-#include <NewPing.h>
-#include "settings.h"
+#include "control_settings.h"
+#include "hal.h"
+#include "sonar_trace.h"
+#include "filters.h"
+#include "profiler.h"
+#include "status_led.h"
+
+#ifndef CONTROL_MEDIAN_WINDOW
+#define CONTROL_MEDIAN_WINDOW 5
+#endif
+
+// 0 - только медиана (как раньше), 1 - медиана, отсев выбросов и альфа-бета трекер
+#ifndef CONTROL_FILTER_PIPELINE
+#define CONTROL_FILTER_PIPELINE 1
+#endif
+
+#if CONTROL_FILTER_PIPELINE == 0
+typedef FilterPipeline<
+    MedianStage<int32_t, CONTROL_MEDIAN_WINDOW>
+> DistanceFilter;
+#else
+typedef FilterPipeline<
+    MedianStage<int32_t, CONTROL_MEDIAN_WINDOW>,
+    OutlierGateStage<int32_t, 300, 5>,
+    AlphaBetaStage<int32_t, 128, 16, 256>
+> DistanceFilter;
+#endif
+
+#ifdef CONTROL_PROFILE_CYCLES
+// Прежний путь уровня в сантиметрах float, до перехода на целые мм: для
+// сравнения гоняется рядом с целочисленным на тех же отсчётах
+#if CONTROL_FILTER_PIPELINE == 0
+typedef FilterPipeline<
+    MedianStage<float, CONTROL_MEDIAN_WINDOW>
+> FloatDistanceFilter;
+#else
+typedef FilterPipeline<
+    MedianStage<float, CONTROL_MEDIAN_WINDOW>,
+    OutlierGateStage<float, 30, 5>,
+    AlphaBetaStage<float, 8, 1, 16>
+> FloatDistanceFilter;
+#endif
+#endif
+
+// Вызывается из update() для каждого отфильтрованного показания
+typedef void (*ReadingCallback)(uint8_t channel, uint16_t distanceMm, bool isPumpOn, void* context);
+
+enum ControlEvent : uint8_t {
+    EVENT_BOOT = 0,
+    EVENT_PUMP_ON,
+    EVENT_PUMP_OFF,
+    EVENT_ERROR_ENTER,
+    EVENT_ERROR_EXIT,
+    EVENT_MANUAL_MODE,
+    EVENT_AUTO_MODE
+};
+
+enum EventReason : uint8_t {
+    REASON_NONE = 0,
+    REASON_LEVEL_HIGH,
+    REASON_LEVEL_LOW,
+    REASON_ERROR,
+    REASON_MANUAL,
+    REASON_OUT_OF_RANGE,
+    REASON_BACK_IN_RANGE
+};
+
+// Смена состояния насоса, ошибки или режима
+typedef void (*EventCallback)(uint8_t channel, ControlEvent event, EventReason reason, uint16_t distanceMm, void* context);
 
 class ControlManager {
 public:
-    ControlManager(SettingsManager& settingsManager);
+    static const uint8_t MAX_CHANNELS = CONTROL_MAX_CHANNELS;
+    static_assert(MAX_CHANNELS >= 1 && MAX_CHANNELS <= 8, "Channel flags are stored in uint8_t masks");
+
+    ControlManager(PumpControlSettings& settings);
     void begin();
     void update();
 
-    float getCurrentDistance() const;
+    uint8_t getChannelCount() const;
+    uint16_t getCurrentDistance(uint8_t channel = 0) const;
+    int32_t getLevelRate(uint8_t channel = 0) const;
     void setManualMode(bool enabled);
-    void setPumpState(bool isOn);
-    bool getPumpState() const;
-    bool isErrorState() const;
+    void setPumpState(bool isOn, uint8_t channel = 0);
+    bool getPumpState(uint8_t channel = 0) const;
+    bool isErrorState(uint8_t channel = 0) const;
+    uint32_t getStateVersion() const;
+    SonarTraceRecorder& getTraceRecorder();
+    StatusLed& getStatusLed();
+    void setReadingCallback(ReadingCallback callback, void* context);
+    void setEventCallback(EventCallback callback, void* context);
+    static const char* getEventName(uint8_t event);
+    static const char* getReasonName(uint8_t reason);
 
 private:
-    SettingsManager& _settingsManager;
-    NewPing* _sonar;
+    PumpControlSettings& _settings;
+    hal::DistanceSensor _sonar;
+    SonarTraceRecorder _traceRecorder;
+    uint8_t _channelCount = 0;
 
-    bool _isPumpOn = false;
-    bool _isErrorState = false;
-    bool _isPotentialErrorState = false;
-    unsigned long _errorConditionStartTime = 0;
+    // Состояние каналов хранится по полям (struct-of-arrays): флаги - битовые
+    // маски, остальное - плотные массивы, которые проходятся одним циклом.
+    uint8_t _pumpOnMask = 0;
+    uint8_t _errorMask = 0;
+    uint8_t _potentialErrorMask = 0;
+    uint16_t _distanceMm[MAX_CHANNELS] = {0};
+    unsigned long _errorStartMs[MAX_CHANNELS] = {0};
+    DistanceFilter _distanceFilters[MAX_CHANNELS];
     const unsigned long _errorDelayMs = 3000;
+    uint32_t _stateVersion = 0;
+
+    StatusLed _statusLed;
+    ReadingCallback _readingCallback = nullptr;
+    void* _readingContext = nullptr;
+    EventCallback _eventCallback = nullptr;
+    void* _eventContext = nullptr;
+
+    static const uint16_t MAX_SENSOR_DISTANCE = 4000;
+    static const uint16_t MIN_VALID_DISTANCE = 300;
+    static const uint16_t MAX_VALID_DISTANCE = 3800;
 
-    unsigned long _lastBlinkTime = 0;
-    bool _ledState = false;
-    const unsigned long _blinkInterval = 150;
+#ifdef CONTROL_PROFILE_CYCLES
+    // Копии фильтров и решения насоса для сравнения путей уровня: на живое
+    // управление не влияют
+    DistanceFilter _profileIntFilters[MAX_CHANNELS];
+    FloatDistanceFilter _profileFloatFilters[MAX_CHANNELS];
+    uint8_t _profileIntPumpMask = 0;
+    uint8_t _profileFloatPumpMask = 0;
+    uint8_t _profileIntRangeMask = 0;
+    uint8_t _profileFloatRangeMask = 0;
+
+    uint32_t _profileCycles = 0;
+    uint32_t _profileMaxCycles = 0;
+    uint32_t _profileIntCycles = 0;
+    uint32_t _profileFloatCycles = 0;
+    uint32_t _profileSamples = 0;
+
+    void _profileLevelPaths(uint8_t channel, uint16_t rawDistance);
+    void _profileSample(uint32_t cycles);
+#endif
+
+#if defined(CONTROL_BENCH_GPIO) && defined(CONTROL_FIXED_PIN_PUMP) && defined(ARDUINO)
+    void _benchmarkPinWrites();
+#endif
 
-    static const int MEDIAN_FILTER_SIZE = 5;
-    float _distanceReadings[MEDIAN_FILTER_SIZE];
-    int _readingIndex = 0;
+    static bool _hasBit(uint8_t mask, uint8_t channel) { return mask & (1 << channel); }
+    static void _setBit(uint8_t& mask, uint8_t channel, bool value) {
+        if (value) mask |= (1 << channel); else mask &= ~(1 << channel);
+    }
 
-    float _readSensor();
-    void _controlPump();
-    void _controlPin(bool state);
-    void _controlLed(int pwm, bool error);
+    bool _readSensor(uint8_t& channel, uint16_t& rawDistance, uint16_t& distance);
+    void _processReading(uint8_t channel, uint16_t distance);
+    void _controlPump(uint8_t channel);
+    void _controlPin(uint8_t channel, bool state);
+    void _emitEvent(uint8_t channel, ControlEvent event, EventReason reason);
 };
 
 #endif
@@ -0,0 +1,27 @@
+#ifndef CONTROL_SETTINGS_H
+#define CONTROL_SETTINGS_H
+
+#include <stdint.h>
+
+#ifndef CONTROL_MAX_CHANNELS
+#define CONTROL_MAX_CHANNELS 4
+#endif
+
+struct ChannelSettings {
+  uint16_t minTriggerMm;
+  uint16_t maxTriggerMm;
+  int pin_pump;
+  int pin_echo;
+  int pin_trig;
+};
+
+struct PumpControlSettings {
+  uint8_t channelCount;
+  ChannelSettings channels[CONTROL_MAX_CHANNELS];
+  int sampleIntervalMs;
+  int pin_led;
+  int pin_button;
+  bool manualMode_pump;
+};
+
+#endif
@@ -0,0 +1,130 @@
+#include "downsample.h"
+
+HistoryDownsampler::HistoryDownsampler(const HistoryManager& history, uint32_t fromSec, uint32_t toSec, uint16_t maxPoints)
+    : _lead(history), _trail(history), _resolutionMm(HistoryManager::RESOLUTION_MM) {
+    uint32_t oldest = history.getOldestSec();
+    uint32_t newest = history.getUptimeSec();
+    if (fromSec < oldest) fromSec = oldest;
+    if (toSec > newest) toSec = newest;
+    if (fromSec > toSec || maxPoints == 0) return;
+
+    // Последняя точка нужна как C для последней корзины
+    HistoryReader reader(history);
+    if (!reader.seek(toSec) || !reader.next(_last, toSec + 1)) return;
+    if (!_trail.seek(fromSec)) return;
+    _lead = _trail;
+
+    _fromSec = fromSec;
+    _toSec = toSec;
+    uint32_t samples = toSec - fromSec + 1;
+    _pointCount = (samples < maxPoints) ? samples : maxPoints;
+    _bucketCount = (_pointCount > 2) ? _pointCount - 2 : 0;
+}
+
+bool HistoryDownsampler::next(HistoryPoint& point) {
+    if (_emitted >= _pointCount) return false;
+
+    HistorySpan span;
+    if (_emitted == 0) {
+        _lead.next(span, _fromSec + 1);
+        _trail = _lead;
+        _prevSec = span.startSec;
+        _prevValue = span.value;
+        _emitted++;
+        _fillPoint(point, span.startSec, span.value, span.isPumpOn);
+        return true;
+    }
+
+    if (_emitted == _pointCount - 1) {
+        _emitted++;
+        _fillPoint(point, _last.startSec, _last.value, _last.isPumpOn);
+        return true;
+    }
+
+    uint16_t bucket = _emitted - 1;
+    uint32_t start = _bucketStart(bucket);
+    uint32_t end = _bucketStart(bucket + 1);
+
+    // C - среднее следующей корзины (или последняя точка), время относительно _fromSec
+    int64_t avgSec;
+    int64_t avgValue;
+    if (bucket + 1 < _bucketCount) {
+        uint32_t nextEnd = _bucketStart(bucket + 2);
+        uint64_t sumSec = 0;
+        uint64_t sumValue = 0;
+        uint32_t count = 0;
+        while (_lead.next(span, nextEnd)) {
+            // Отрезок, начатый в текущей корзине, входит в среднее своим хвостом
+            if (span.startSec < end) {
+                uint32_t skipped = end - span.startSec;
+                if (skipped >= span.length) continue;
+                span.startSec = end;
+                span.length -= skipped;
+            }
+            uint64_t offset = span.startSec - _fromSec;
+            sumSec += span.length * offset + (uint64_t)span.length * (span.length - 1) / 2;
+            sumValue += (uint64_t)span.value * span.length;
+            count += span.length;
+        }
+        if (count == 0) count = 1;
+        avgSec = sumSec / count;
+        avgValue = sumValue / count;
+    } else {
+        avgSec = _toSec - _fromSec;
+        avgValue = _last.value;
+    }
+
+    int64_t ax = _prevSec - _fromSec;
+    int64_t ay = _prevValue;
+    int64_t bestArea = -1;
+    uint32_t bestSec = start;
+    uint16_t bestValue = _prevValue;
+    bool bestPump = false;
+
+    while (_trail.next(span, end)) {
+        if (span.startSec < start) continue;
+
+        uint32_t candidates[2] = { span.startSec, span.startSec + span.length - 1 };
+        for (uint8_t i = 0; i < (span.length > 1 ? 2 : 1); i++) {
+            int64_t bx = candidates[i] - _fromSec;
+            int64_t area = (ax - avgSec) * ((int64_t)span.value - ay) - (ax - bx) * (avgValue - ay);
+            if (area < 0) area = -area;
+            if (area > bestArea) {
+                bestArea = area;
+                bestSec = candidates[i];
+                bestValue = span.value;
+                bestPump = span.isPumpOn;
+            }
+        }
+    }
+
+    _prevSec = bestSec;
+    _prevValue = bestValue;
+    _emitted++;
+    _fillPoint(point, bestSec, bestValue, bestPump);
+    return bestArea >= 0;
+}
+
+uint32_t HistoryDownsampler::getFromSec() const {
+    return _fromSec;
+}
+
+uint32_t HistoryDownsampler::getToSec() const {
+    return _toSec;
+}
+
+uint16_t HistoryDownsampler::getPointCount() const {
+    return _pointCount;
+}
+
+uint32_t HistoryDownsampler::_bucketStart(uint16_t bucket) const {
+    if (bucket >= _bucketCount) return _toSec;
+    uint32_t inner = _toSec - _fromSec - 1;
+    return _fromSec + 1 + (uint32_t)((uint64_t)inner * bucket / _bucketCount);
+}
+
+void HistoryDownsampler::_fillPoint(HistoryPoint& point, uint32_t sec, uint16_t value, bool isPumpOn) const {
+    point.sec = sec;
+    point.distanceMm = value * _resolutionMm;
+    point.isPumpOn = isPumpOn;
+}
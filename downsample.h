@@ -0,0 +1,47 @@
+#ifndef DOWNSAMPLE_H
+#define DOWNSAMPLE_H
+
+#include <stdint.h>
+#include "history.h"
+
+struct HistoryPoint {
+    uint32_t sec;
+    uint16_t distanceMm;
+    bool isPumpOn;
+};
+
+// Largest-Triangle-Three-Buckets по истории за один проход. Два декодера
+// идут по кольцу: ведущий на корзину впереди считает среднее следующей
+// корзины, второй выбирает точку текущей. Память постоянная и не зависит
+// от диапазона. Внутри серии уровень постоянен, площадь треугольника
+// линейна по времени, поэтому проверяются только концы серий.
+class HistoryDownsampler {
+public:
+    HistoryDownsampler(const HistoryManager& history, uint32_t fromSec, uint32_t toSec, uint16_t maxPoints);
+
+    bool next(HistoryPoint& point);
+
+    uint32_t getFromSec() const;
+    uint32_t getToSec() const;
+    uint16_t getPointCount() const;
+
+private:
+    HistoryReader _lead;
+    HistoryReader _trail;
+    uint32_t _fromSec = 0;
+    uint32_t _toSec = 0;
+    uint16_t _pointCount = 0;
+    uint16_t _bucketCount = 0;
+    uint16_t _emitted = 0;
+    uint16_t _resolutionMm;
+
+    // Последняя выбранная точка (A в LTTB) и последняя точка диапазона
+    uint32_t _prevSec = 0;
+    uint16_t _prevValue = 0;
+    HistorySpan _last;
+
+    uint32_t _bucketStart(uint16_t bucket) const;
+    void _fillPoint(HistoryPoint& point, uint32_t sec, uint16_t value, bool isPumpOn) const;
+};
+
+#endif
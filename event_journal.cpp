@@ -0,0 +1,144 @@
+#include "event_journal.h"
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+static const char* EVENTS_FILE = "/events.bin";
+static const char* EVENTS_OLD_FILE = "/events.old";
+#endif
+
+EventJournal::EventJournal() {}
+
+void EventJournal::begin() {
+#ifdef ARDUINO
+    EventRecord last;
+    if (_readLast(EVENTS_FILE, last) || _readLast(EVENTS_OLD_FILE, last)) {
+        _nextSeq = last.seq + 1;
+        _firstSeq = _nextSeq;
+        _flushedSeq = last.seq;
+    }
+    Serial.printf("EventJournal: Continuing at event #%lu.\n", (unsigned long)_nextSeq);
+#endif
+}
+
+void EventJournal::record(uint32_t timestamp, uint8_t type, uint8_t reason, uint8_t channel, uint16_t distanceMm) {
+    EventRecord& rec = _ring[_nextSeq % RING_SIZE];
+    memset(&rec, 0, sizeof(rec));
+    rec.seq = _nextSeq++;
+    rec.timestamp = timestamp;
+    rec.distanceMm = distanceMm;
+    rec.type = type;
+    rec.reason = reason;
+    rec.channel = channel;
+
+    if (_nextSeq - _firstSeq > RING_SIZE) _firstSeq = _nextSeq - RING_SIZE;
+}
+
+uint32_t EventJournal::getLastSeq() const {
+    return _nextSeq - 1;
+}
+
+size_t EventJournal::read(uint32_t sinceSeq, EventRecord* records, size_t maxRecords) const {
+    size_t count = 0;
+
+#ifdef ARDUINO
+    // Всё, что старше кольца, читается с флеша
+    if (sinceSeq + 1 < _firstSeq) {
+        count += _readFile(EVENTS_OLD_FILE, sinceSeq, records, maxRecords);
+        if (count > 0) sinceSeq = records[count - 1].seq;
+        count += _readFile(EVENTS_FILE, sinceSeq, records + count, maxRecords - count);
+        if (count > 0) sinceSeq = records[count - 1].seq;
+    }
+#endif
+
+    uint32_t seq = (sinceSeq + 1 < _firstSeq) ? _firstSeq : sinceSeq + 1;
+    for (; seq < _nextSeq && count < maxRecords; seq++) {
+        const EventRecord* rec = _findInRing(seq);
+        if (rec) records[count++] = *rec;
+    }
+    return count;
+}
+
+const EventRecord* EventJournal::_findInRing(uint32_t seq) const {
+    if (seq < _firstSeq || seq >= _nextSeq) return nullptr;
+    return &_ring[seq % RING_SIZE];
+}
+
+#ifdef ARDUINO
+
+void EventJournal::flush() {
+    if (_flushedSeq + 1 >= _nextSeq) return;
+
+    if (_flushedSeq + 1 < _firstSeq) {
+        _lost += _firstSeq - _flushedSeq - 1;
+        _flushedSeq = _firstSeq - 1;
+        Serial.printf("EventJournal: %lu event(s) lost before reaching flash.\n", (unsigned long)_lost);
+    }
+
+    File file = SPIFFS.open(EVENTS_FILE, "a");
+    if (!file) return;
+
+    size_t pending = (_nextSeq - 1 - _flushedSeq) * sizeof(EventRecord);
+    if (file.size() + pending > MAX_FILE_SIZE) {
+        // Только переименование, записи никогда не переписываются
+        file.close();
+        SPIFFS.remove(EVENTS_OLD_FILE);
+        SPIFFS.rename(EVENTS_FILE, EVENTS_OLD_FILE);
+        file = SPIFFS.open(EVENTS_FILE, "a");
+        if (!file) return;
+    }
+
+    while (_flushedSeq + 1 < _nextSeq) {
+        const EventRecord* rec = _findInRing(_flushedSeq + 1);
+        if (file.write((const uint8_t*)rec, sizeof(EventRecord)) != sizeof(EventRecord)) break;
+        _flushedSeq++;
+    }
+    file.close();
+}
+
+size_t EventJournal::_readFile(const char* path, uint32_t sinceSeq, EventRecord* records, size_t maxRecords) const {
+    if (maxRecords == 0) return 0;
+
+    File file = SPIFFS.open(path, "r");
+    if (!file) return 0;
+
+    // Номера в файле возрастают: двоичный поиск первого после sinceSeq
+    uint32_t low = 0;
+    uint32_t high = file.size() / sizeof(EventRecord);
+    uint32_t total = high;
+    EventRecord rec;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        file.seek(mid * sizeof(EventRecord), SeekSet);
+        if (file.read((uint8_t*)&rec, sizeof(rec)) == sizeof(rec) && rec.seq <= sinceSeq) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    size_t count = 0;
+    file.seek(low * sizeof(EventRecord), SeekSet);
+    while (low++ < total && count < maxRecords) {
+        if (file.read((uint8_t*)&records[count], sizeof(EventRecord)) != sizeof(EventRecord)) break;
+        if (records[count].seq >= _firstSeq) break;
+        if (records[count].seq > sinceSeq) count++;
+    }
+    file.close();
+    return count;
+}
+
+bool EventJournal::_readLast(const char* path, EventRecord& record) {
+    File file = SPIFFS.open(path, "r");
+    if (!file) return false;
+
+    size_t count = file.size() / sizeof(EventRecord);
+    bool isRead = count > 0 &&
+                  file.seek((count - 1) * sizeof(EventRecord), SeekSet) &&
+                  file.read((uint8_t*)&record, sizeof(record)) == sizeof(record);
+    file.close();
+    return isRead;
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef EVENT_JOURNAL_H
+#define EVENT_JOURNAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef ARDUINO
+#include <FS.h>
+#endif
+
+// Журнал событий насоса: записи по 16 байт с возрастающим номером seq.
+// Последние RING_SIZE событий лежат в RAM; на плате они ещё и дописываются
+// в /events.bin (при переполнении файл становится /events.old), так что
+// номера продолжаются после перезагрузки, а старые события читаются с флеша.
+// Время - секунды от старта; после перезагрузки в журнале есть EVENT_BOOT.
+
+struct EventRecord {
+    uint32_t seq;
+    uint32_t timestamp;
+    uint16_t distanceMm;
+    uint8_t type;
+    uint8_t reason;
+    uint8_t channel;
+    uint8_t reserved[3];
+};
+
+static_assert(sizeof(EventRecord) == 16, "EventRecord layout is part of the flash format");
+
+class EventJournal {
+public:
+    static const uint16_t RING_SIZE = 128;
+
+    EventJournal();
+
+    void begin();
+    void record(uint32_t timestamp, uint8_t type, uint8_t reason, uint8_t channel, uint16_t distanceMm);
+
+    uint32_t getLastSeq() const;
+    // Копирует до maxRecords событий с номером больше sinceSeq
+    size_t read(uint32_t sinceSeq, EventRecord* records, size_t maxRecords) const;
+
+#ifdef ARDUINO
+    void flush();
+#endif
+
+private:
+    EventRecord _ring[RING_SIZE];
+    uint32_t _nextSeq = 1;
+    uint32_t _firstSeq = 1;
+
+    const EventRecord* _findInRing(uint32_t seq) const;
+
+#ifdef ARDUINO
+    static const uint32_t MAX_FILE_SIZE = 16384;
+
+    uint32_t _flushedSeq = 0;
+    uint32_t _lost = 0;
+
+    size_t _readFile(const char* path, uint32_t sinceSeq, EventRecord* records, size_t maxRecords) const;
+    static bool _readLast(const char* path, EventRecord& record);
+#endif
+};
+
+#endif
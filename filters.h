@@ -0,0 +1,173 @@
+#ifndef FILTERS_H
+#define FILTERS_H
+
+#include <stddef.h>
+#include "median_filter.h"
+
+// Цепочка фильтров собирается из типов на этапе компиляции:
+//   FilterPipeline<MedianStage<...>, OutlierGateStage<...>, AlphaBetaStage<...>>
+// Каждая ступень - обычный класс с process()/deltaOver(), без виртуальных
+// вызовов, поэтому компилятор встраивает всю цепочку целиком.
+// Коэффициенты задаются целыми дробями NUM/DEN, чтобы цепочка одинаково
+// работала и с float, и с целыми единицами измерения.
+
+template <typename T, size_t N>
+class MedianStage {
+public:
+    typedef T value_type;
+    static constexpr bool tracksRate = false;
+
+    T process(T x) {
+        if (!_isPrimed) {
+            _filter.reset(x);
+            _isPrimed = true;
+        }
+        return _filter.add(x);
+    }
+
+    T deltaOver(T) const { return T(); }
+
+private:
+    MedianFilter<T, N> _filter;
+    bool _isPrimed = false;
+};
+
+template <typename T, int NUM, int DEN>
+class EmaStage {
+public:
+    static_assert(NUM > 0 && NUM <= DEN, "EMA coefficient must be in (0, 1]");
+
+    typedef T value_type;
+    static constexpr bool tracksRate = false;
+
+    T process(T x) {
+        if (!_isPrimed) {
+            _acc = x * DEN;
+            _isPrimed = true;
+        } else {
+            _acc += (x * DEN - _acc) * NUM / DEN;
+        }
+        return _acc / DEN;
+    }
+
+    T deltaOver(T) const { return T(); }
+
+private:
+    T _acc = T();
+    bool _isPrimed = false;
+};
+
+// Отбрасывает одиночные скачки больше MAX_STEP (брызги, ложное эхо),
+// удерживая последнее принятое значение. Если скачок держится дольше
+// MAX_REJECTS отсчётов подряд, уровень считается действительно изменившимся.
+template <typename T, int MAX_STEP, int MAX_REJECTS>
+class OutlierGateStage {
+public:
+    typedef T value_type;
+    static constexpr bool tracksRate = false;
+
+    T process(T x) {
+        if (!_isPrimed) {
+            _last = x;
+            _isPrimed = true;
+            return x;
+        }
+
+        T step = (x > _last) ? x - _last : _last - x;
+        if (step > T(MAX_STEP) && _rejects < MAX_REJECTS) {
+            _rejects++;
+            return _last;
+        }
+
+        _rejects = 0;
+        _last = x;
+        return x;
+    }
+
+    T deltaOver(T) const { return T(); }
+
+private:
+    T _last = T();
+    int _rejects = 0;
+    bool _isPrimed = false;
+};
+
+// Альфа-бета трекер: оценивает уровень и скорость его изменения за отсчёт.
+// Состояние хранится умноженным на DEN.
+template <typename T, int ALPHA_NUM, int BETA_NUM, int DEN>
+class AlphaBetaStage {
+public:
+    static_assert(ALPHA_NUM > 0 && ALPHA_NUM <= DEN, "Alpha must be in (0, 1]");
+    static_assert(BETA_NUM >= 0 && BETA_NUM <= ALPHA_NUM, "Beta must be in [0, alpha]");
+
+    typedef T value_type;
+    static constexpr bool tracksRate = true;
+
+    T process(T x) {
+        if (!_isPrimed) {
+            _level = x * DEN;
+            _rate = T();
+            _isPrimed = true;
+            return x;
+        }
+
+        T predicted = _level + _rate;
+        T residual = x * DEN - predicted;
+        _level = predicted + residual * ALPHA_NUM / DEN;
+        _rate += residual * BETA_NUM / DEN;
+        return _level / DEN;
+    }
+
+    T deltaOver(T samples) const {
+        return _rate * samples / DEN;
+    }
+
+private:
+    T _level = T();
+    T _rate = T();
+    bool _isPrimed = false;
+};
+
+template <typename... Stages>
+class FilterPipeline;
+
+template <typename Last>
+class FilterPipeline<Last> {
+public:
+    typedef typename Last::value_type value_type;
+    static constexpr bool tracksRate = Last::tracksRate;
+
+    value_type process(value_type x) {
+        return _stage.process(x);
+    }
+
+    value_type deltaOver(value_type samples) const {
+        return _stage.deltaOver(samples);
+    }
+
+private:
+    Last _stage;
+};
+
+template <typename Head, typename... Tail>
+class FilterPipeline<Head, Tail...> {
+public:
+    typedef typename Head::value_type value_type;
+    static constexpr bool tracksRate = Head::tracksRate || FilterPipeline<Tail...>::tracksRate;
+
+    value_type process(value_type x) {
+        return _tail.process(_head.process(x));
+    }
+
+    // Изменение уровня за заданное число отсчётов от последней ступени,
+    // которая умеет оценивать скорость; 0, если таких ступеней нет.
+    value_type deltaOver(value_type samples) const {
+        return FilterPipeline<Tail...>::tracksRate ? _tail.deltaOver(samples) : _head.deltaOver(samples);
+    }
+
+private:
+    Head _head;
+    FilterPipeline<Tail...> _tail;
+};
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef HAL_H
+#define HAL_H
+
+// Тонкий слой доступа к железу для ControlManager: GPIO, ШИМ, часы и датчик
+// расстояния. На плате это встраиваемые обёртки над Arduino API, без
+// накладных расходов; при сборке под Linux подключается модель бака.
+
+#ifdef ARDUINO
+#include "hal_arduino.h"
+#else
+#include "hal_sim.h"
+#endif
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef HAL_ARDUINO_H
+#define HAL_ARDUINO_H
+
+#include <Arduino.h>
+#include "sonar.h"
+
+namespace hal {
+
+inline void pinOutput(int pin) { pinMode(pin, OUTPUT); }
+inline void pinInputPullup(int pin) { pinMode(pin, INPUT_PULLUP); }
+inline void writePin(int pin, bool high) { digitalWrite(pin, high ? HIGH : LOW); }
+inline bool readPin(int pin) { return digitalRead(pin) == HIGH; }
+inline void writePwm(int pin, int duty) { analogWrite(pin, duty); }
+
+// Вывод, известный при сборке: запись сразу в регистры GPOS/GPOC (GP16O для
+// GPIO16) без проверок и остановки ШИМ, которые делает digitalWrite().
+// Только для выводов, уже настроенных на выход и не используемых под ШИМ.
+template<int PIN>
+struct FastPin {
+    static_assert(PIN >= 0 && PIN <= 16, "ESP8266 has GPIO0..GPIO16");
+
+    static inline void write(bool high) {
+        if (PIN == 16) {
+            if (high) GP16O |= 1; else GP16O &= ~1;
+        } else {
+            if (high) GPOS = (1 << PIN); else GPOC = (1 << PIN);
+        }
+    }
+};
+
+inline unsigned long millis() { return ::millis(); }
+inline unsigned long micros() { return ::micros(); }
+inline uint32_t cycleCount() { return ESP.getCycleCount(); }
+
+typedef SonarSampler DistanceSensor;
+
+}
+
+#endif
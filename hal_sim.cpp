@@ -0,0 +1,235 @@
+#ifndef ARDUINO
+
+#include "hal_sim.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <time.h>
+
+SimulatedSerial Serial;
+
+void SimulatedSerial::print(const char* text) {
+    if (isEnabled) fputs(text, stdout);
+}
+
+void SimulatedSerial::println(const char* text) {
+    if (isEnabled) puts(text);
+}
+
+void SimulatedSerial::printf(const char* format, ...) {
+    if (!isEnabled) return;
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+}
+
+namespace hal {
+
+static const int MAX_PINS = 17;
+
+static bool pinStates[MAX_PINS];
+static int pwmDuties[MAX_PINS];
+static unsigned long nowUs = 0;
+static TankModel tanks[sim::MAX_TANKS];
+static uint32_t pumpSwitches[sim::MAX_TANKS];
+static uint32_t rngState = 1;
+
+static const SonarTraceRecord* traceRecords = nullptr;
+static size_t traceCount = 0;
+static size_t tracePosition = 0;
+static unsigned long traceNextMs = 0;
+
+static uint32_t nextRandom() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static bool isValidPin(int pin) {
+    return pin >= 0 && pin < MAX_PINS;
+}
+
+void pinOutput(int) {}
+
+void pinInputPullup(int pin) {
+    if (isValidPin(pin)) pinStates[pin] = true;
+}
+
+void writePin(int pin, bool high) {
+    if (!isValidPin(pin)) return;
+    for (uint8_t i = 0; i < sim::MAX_TANKS; i++) {
+        if (pin == tanks[i].pumpPin && pinStates[pin] != high) pumpSwitches[i]++;
+    }
+    pinStates[pin] = high;
+    pwmDuties[pin] = high ? 255 : 0;
+}
+
+bool readPin(int pin) {
+    return isValidPin(pin) && pinStates[pin];
+}
+
+void writePwm(int pin, int duty) {
+    if (!isValidPin(pin)) return;
+    pwmDuties[pin] = duty;
+    pinStates[pin] = duty > 0;
+}
+
+unsigned long millis() {
+    return nowUs / 1000;
+}
+
+unsigned long micros() {
+    return nowUs;
+}
+
+uint32_t cycleCount() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+namespace sim {
+
+void reset(const TankModel& model) {
+    for (uint8_t i = 0; i < MAX_TANKS; i++) {
+        tanks[i] = model;
+        if (i > 0) tanks[i].pumpPin = -1;
+        pumpSwitches[i] = 0;
+    }
+    rngState = model.seed ? model.seed : 1;
+    nowUs = 0;
+    traceRecords = nullptr;
+    traceCount = 0;
+    tracePosition = 0;
+    for (int i = 0; i < MAX_PINS; i++) {
+        pinStates[i] = false;
+        pwmDuties[i] = 0;
+    }
+}
+
+TankModel& tank(uint8_t channel) {
+    return tanks[channel % MAX_TANKS];
+}
+
+void advanceMicros(unsigned long us) {
+    float seconds = us / 1000000.0f;
+    for (uint8_t i = 0; i < MAX_TANKS; i++) {
+        TankModel& model = tanks[i];
+        model.distanceMm -= model.inflowMmPerSec * seconds;
+        if (isPumpOn(i)) {
+            model.distanceMm += model.pumpOutflowMmPerSec * seconds;
+        }
+
+        if (model.distanceMm < model.minDistanceMm) model.distanceMm = model.minDistanceMm;
+        if (model.distanceMm > model.maxDistanceMm) model.distanceMm = model.maxDistanceMm;
+    }
+
+    nowUs += us;
+}
+
+void advanceMillis(unsigned long ms) {
+    advanceMicros(ms * 1000UL);
+}
+
+bool isPumpOn(uint8_t channel) {
+    return readPin(tank(channel).pumpPin);
+}
+
+int getPwm(int pin) {
+    return isValidPin(pin) ? pwmDuties[pin] : 0;
+}
+
+uint32_t getPumpSwitchCount(uint8_t channel) {
+    return pumpSwitches[channel % MAX_TANKS];
+}
+
+void loadTrace(const SonarTraceRecord* records, size_t count) {
+    traceRecords = records;
+    traceCount = count;
+    tracePosition = 0;
+    traceNextMs = millis() + ((count > 0) ? records[0].deltaMs : 0);
+}
+
+size_t getTracePosition() {
+    return tracePosition;
+}
+
+bool isTraceFinished() {
+    return traceRecords && tracePosition >= traceCount;
+}
+
+}
+
+bool SimulatedSonar::addChannel(int, int) {
+    if (_isStarted || _channelCount >= sim::MAX_TANKS) return false;
+    _channelCount++;
+    return true;
+}
+
+void SimulatedSonar::begin(uint16_t maxDistanceMm) {
+    _maxDistanceMm = maxDistanceMm;
+    _isStarted = _channelCount > 0;
+    _lastTriggerMs = millis();
+}
+
+void SimulatedSonar::setInterval(unsigned long intervalMs) {
+    _intervalMs = (intervalMs < MIN_INTERVAL_MS) ? MIN_INTERVAL_MS : intervalMs;
+}
+
+unsigned long SimulatedSonar::getChannelPeriodMs() const {
+    return _pingSpacingMs() * (_channelCount > 1 ? _channelCount : 1);
+}
+
+unsigned long SimulatedSonar::_pingSpacingMs() const {
+    if (_channelCount <= 1) return _intervalMs;
+    unsigned long spacing = _intervalMs / _channelCount;
+    return (spacing < MIN_INTERVAL_MS) ? MIN_INTERVAL_MS : spacing;
+}
+
+bool SimulatedSonar::poll(uint8_t& channel, uint16_t& distanceMm) {
+    if (!_isStarted) return false;
+
+    if (traceRecords) {
+        channel = 0;
+        if (tracePosition >= traceCount || (long)(millis() - traceNextMs) < 0) return false;
+
+        distanceMm = traceRecords[tracePosition].value & SONAR_TRACE_DISTANCE_MASK;
+        tracePosition++;
+        if (tracePosition < traceCount) {
+            traceNextMs += traceRecords[tracePosition].deltaMs;
+        }
+        return true;
+    }
+
+    if (millis() - _lastTriggerMs < _pingSpacingMs()) return false;
+    _lastTriggerMs = millis();
+
+    channel = _nextChannel;
+    _nextChannel = (_nextChannel + 1) % _channelCount;
+    const TankModel& model = tanks[channel];
+
+    uint32_t roll = nextRandom() % 100;
+    if (roll < model.dropoutPercent) {
+        distanceMm = 0;
+        return true;
+    }
+
+    float reading = model.distanceMm;
+    if (roll < (uint32_t)model.dropoutPercent + model.splashPercent) {
+        reading = model.minDistanceMm + nextRandom() % (uint32_t)(model.distanceMm - model.minDistanceMm + 1);
+    } else if (model.noiseMm > 0) {
+        reading += (int32_t)(nextRandom() % (2 * model.noiseMm + 1)) - model.noiseMm;
+    }
+
+    if (reading <= 0 || reading > _maxDistanceMm) {
+        distanceMm = 0;
+    } else {
+        distanceMm = (uint16_t)(reading + 0.5f);
+    }
+    return true;
+}
+
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef HAL_SIM_H
+#define HAL_SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sonar_trace.h"
+
+// Замена Serial для сборки под Linux; по умолчанию вывод подавлен,
+// чтобы прогон модели не упирался в консоль.
+class SimulatedSerial {
+public:
+    bool isEnabled = false;
+
+    void print(const char* text);
+    void println(const char* text = "");
+    void printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern SimulatedSerial Serial;
+
+namespace hal {
+
+void pinOutput(int pin);
+void pinInputPullup(int pin);
+void writePin(int pin, bool high);
+bool readPin(int pin);
+void writePwm(int pin, int duty);
+
+// В модели регистров нет: запись идёт обычным путём, чтобы бак видел насос
+template<int PIN>
+struct FastPin {
+    static inline void write(bool high) { writePin(PIN, high); }
+};
+
+unsigned long millis();
+unsigned long micros();
+// Для замеров -DCONTROL_PROFILE_CYCLES: на компьютере это наносекунды
+// реального времени, а не такты и не модельное время
+uint32_t cycleCount();
+
+// Модель бака: расстояние от датчика до воды растёт при откачке насосом
+// и уменьшается от притока. Насос считается включённым по состоянию pumpPin.
+struct TankModel {
+    float distanceMm = 2800;
+    float minDistanceMm = 200;
+    float maxDistanceMm = 3500;
+    float inflowMmPerSec = 2;
+    float pumpOutflowMmPerSec = 10;
+    int pumpPin = -1;
+
+    uint16_t noiseMm = 5;
+    uint8_t dropoutPercent = 0;
+    uint8_t splashPercent = 0;
+    uint32_t seed = 1;
+};
+
+namespace sim {
+
+static const uint8_t MAX_TANKS = 8;
+
+// reset() задаёт одинаковую модель всем бакам; pumpPin остаётся только
+// у бака 0, остальным его нужно назначить через tank(channel).
+void reset(const TankModel& model);
+TankModel& tank(uint8_t channel = 0);
+
+void advanceMicros(unsigned long us);
+void advanceMillis(unsigned long ms);
+
+bool isPumpOn(uint8_t channel = 0);
+int getPwm(int pin);
+uint32_t getPumpSwitchCount(uint8_t channel = 0);
+
+// Воспроизведение записанной трассы канала 0 вместо модели бака: датчик
+// отдаёт сырые значения из трассы с исходными интервалами между отсчётами.
+void loadTrace(const SonarTraceRecord* records, size_t count);
+size_t getTracePosition();
+bool isTraceFinished();
+
+}
+
+class SimulatedSonar {
+public:
+    bool addChannel(int pinTrig, int pinEcho);
+    void begin(uint16_t maxDistanceMm);
+    void setInterval(unsigned long intervalMs);
+    bool poll(uint8_t& channel, uint16_t& distanceMm);
+    unsigned long getChannelPeriodMs() const;
+
+private:
+    // Как у SonarSampler: шаг между импульсами не меньше MIN_INTERVAL_MS
+    static const unsigned long MIN_INTERVAL_MS = 30;
+
+    uint8_t _channelCount = 0;
+    uint8_t _nextChannel = 0;
+    uint16_t _maxDistanceMm = 0;
+    unsigned long _intervalMs = 50;
+    unsigned long _lastTriggerMs = 0;
+    bool _isStarted = false;
+
+    unsigned long _pingSpacingMs() const;
+};
+
+typedef SimulatedSonar DistanceSensor;
+
+}
+
+#endif
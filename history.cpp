@@ -0,0 +1,378 @@
+#include "history.h"
+#include <string.h>
+
+namespace {
+
+enum CursorStage : uint8_t {
+    STAGE_STREAM_HEADER = 0,
+    STAGE_BLOCK_START,
+    STAGE_BLOCK_HEADER,
+    STAGE_BLOCK_DATA,
+    STAGE_DONE
+};
+
+enum TokenTag : uint8_t {
+    TAG_SAMPLE = 0,
+    TAG_RUN = 1,
+    TAG_STEP_UP = 2,
+    TAG_STEP_DOWN = 3
+};
+
+uint32_t zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+}
+
+HistoryManager::HistoryManager() {}
+
+void HistoryManager::addSample(unsigned long nowMs, uint16_t distanceMm, bool isPumpOn) {
+    uint16_t value = _quantize(distanceMm);
+
+    if (!_hasSample) {
+        _lastMs = nowMs;
+        _hasSample = true;
+        _lastValue = value;
+        _lastPump = isPumpOn;
+        _lastSec = _uptimeSec;
+        _openBlock(_uptimeSec, value, isPumpOn);
+        return;
+    }
+
+    _msRemainder += nowMs - _lastMs;
+    _lastMs = nowMs;
+    uint32_t elapsedSec = _msRemainder / 1000;
+    if (elapsedSec == 0) return;
+    _msRemainder %= 1000;
+    _uptimeSec += elapsedSec;
+
+    // Отсчёты, пропущенные из-за задержки задачи, повторяют предыдущий
+    _pendingRun += elapsedSec - 1;
+
+    if (value == _lastValue && isPumpOn == _lastPump) {
+        _pendingRun++;
+        _lastSec = _uptimeSec;
+        if (_pendingRun >= MAX_RUN) _flushRun();
+        return;
+    }
+
+    int32_t delta = (int32_t)value - _lastValue;
+    _lastSec = _uptimeSec - 1;
+
+    // Самый частый случай - уровень ушёл на одну единицу после паузы:
+    // серия и шаг укладываются в один токен
+    bool isStep = (delta == 1 || delta == -1) && isPumpOn == _lastPump;
+    if (!isStep || !_appendToken((_pendingRun << 2) | (delta > 0 ? TAG_STEP_UP : TAG_STEP_DOWN), _pendingRun + 1)) {
+        _flushRun();
+        uint32_t token = (zigzag(delta) << 3) | (isPumpOn ? 4 : 0) | TAG_SAMPLE;
+        if (!_appendToken(token, 1)) {
+            _openBlock(_uptimeSec, value, isPumpOn);
+        }
+    }
+    _pendingRun = 0;
+    _lastSec = _uptimeSec;
+    _lastValue = value;
+    _lastPump = isPumpOn;
+}
+
+uint32_t HistoryManager::getUptimeSec() const {
+    return _uptimeSec;
+}
+
+uint32_t HistoryManager::getOldestSec() const {
+    const Block* oldest = _findBlock(_nextSeq - _blockCount);
+    return oldest ? oldest->header.startSec : _uptimeSec;
+}
+
+size_t HistoryManager::getBytesUsed() const {
+    size_t used = 0;
+    for (uint32_t seq = _nextSeq - _blockCount; seq != _nextSeq; seq++) {
+        used += sizeof(HistoryBlockHeader) + _blocks[seq % BLOCK_COUNT].header.length;
+    }
+    return used;
+}
+
+uint16_t HistoryManager::_quantize(uint16_t distanceMm) const {
+    if (_hasSample) {
+        int32_t centerMm = (int32_t)_lastValue * RESOLUTION_MM;
+        int32_t diff = (int32_t)distanceMm - centerMm;
+        if (diff > -(int32_t)RESOLUTION_MM && diff < (int32_t)RESOLUTION_MM) return _lastValue;
+    }
+    return (distanceMm + RESOLUTION_MM / 2) / RESOLUTION_MM;
+}
+
+void HistoryManager::_openBlock(uint32_t startSec, uint16_t value, bool isPumpOn) {
+    Block& block = _blocks[_nextSeq % BLOCK_COUNT];
+    block.seq = _nextSeq++;
+    block.header.startSec = startSec;
+    block.header.startValue = value;
+    block.header.flags = isPumpOn ? HISTORY_FLAG_PUMP : 0;
+    block.header.reserved = 0;
+    block.header.length = 0;
+    block.header.sampleCount = 1;
+
+    if (_blockCount < BLOCK_COUNT) _blockCount++;
+}
+
+bool HistoryManager::_appendToken(uint32_t token, uint16_t samples) {
+    Block& block = _blocks[(_nextSeq - 1) % BLOCK_COUNT];
+    uint8_t bytes[5];
+    uint8_t length = _encodeVarint(token, bytes);
+    if (block.header.length + length > DATA_BYTES) return false;
+    // Запас под хвост незаписанной серии при отдаче
+    if (block.header.sampleCount + samples > 0xFFFF - MAX_RUN) return false;
+
+    memcpy(block.data + block.header.length, bytes, length);
+    block.header.length += length;
+    block.header.sampleCount += samples;
+    return true;
+}
+
+void HistoryManager::_flushRun() {
+    while (_pendingRun > 0) {
+        uint32_t run = (_pendingRun > MAX_RUN) ? MAX_RUN : _pendingRun;
+        if (!_appendToken((run << 2) | TAG_RUN, run)) {
+            // Первый отсчёт серии становится заголовком нового блока
+            _openBlock(_lastSec - _pendingRun + 1, _lastValue, _lastPump);
+            run = 1;
+        }
+        _pendingRun -= run;
+    }
+}
+
+const HistoryManager::Block* HistoryManager::_findBlock(uint32_t seq) const {
+    if (_nextSeq - seq > _blockCount || seq == _nextSeq) return nullptr;
+
+    const Block& block = _blocks[seq % BLOCK_COUNT];
+    return (block.seq == seq) ? &block : nullptr;
+}
+
+void HistoryManager::openCursor(HistoryCursor& cursor) const {
+    memset(&cursor, 0, sizeof(cursor));
+    memcpy(cursor.streamHeader.magic, "PHST", 4);
+    cursor.streamHeader.version = HISTORY_VERSION;
+    cursor.streamHeader.resolutionMm = RESOLUTION_MM;
+    cursor.streamHeader.lastSec = _uptimeSec;
+    cursor.seq = _nextSeq - _blockCount;
+    cursor.endSeq = _nextSeq;
+    cursor.stage = STAGE_STREAM_HEADER;
+}
+
+size_t HistoryManager::read(HistoryCursor& cursor, uint8_t* buffer, size_t maxLen) const {
+    size_t written = 0;
+
+    while (written < maxLen && cursor.stage != STAGE_DONE) {
+        switch (cursor.stage) {
+            case STAGE_STREAM_HEADER:
+            case STAGE_BLOCK_HEADER: {
+                bool isStream = cursor.stage == STAGE_STREAM_HEADER;
+                const uint8_t* source = isStream ? (const uint8_t*)&cursor.streamHeader : (const uint8_t*)&cursor.blockHeader;
+                size_t size = isStream ? sizeof(cursor.streamHeader) : sizeof(cursor.blockHeader);
+                size_t chunk = size - cursor.position;
+                if (chunk > maxLen - written) chunk = maxLen - written;
+
+                memcpy(buffer + written, source + cursor.position, chunk);
+                written += chunk;
+                cursor.position += chunk;
+                if (cursor.position == size) {
+                    cursor.stage = isStream ? STAGE_BLOCK_START : STAGE_BLOCK_DATA;
+                    cursor.position = 0;
+                }
+                break;
+            }
+
+            case STAGE_BLOCK_START: {
+                const Block* block = (cursor.seq == cursor.endSeq) ? nullptr : _findBlock(cursor.seq);
+                if (!block) {
+                    cursor.stage = STAGE_DONE;
+                    break;
+                }
+
+                // Длина фиксируется сейчас: блок только дописывается, поэтому
+                // уже отданные байты не меняются. Незаписанная серия последнего
+                // блока добавляется хвостом.
+                cursor.blockHeader = block->header;
+                cursor.tailLength = 0;
+                if (cursor.seq == _nextSeq - 1 && _pendingRun > 0) {
+                    cursor.tailLength = _encodeVarint((_pendingRun << 2) | TAG_RUN, cursor.tail);
+                    cursor.blockHeader.length += cursor.tailLength;
+                    cursor.blockHeader.sampleCount += _pendingRun;
+                }
+                cursor.stage = STAGE_BLOCK_HEADER;
+                cursor.position = 0;
+                break;
+            }
+
+            case STAGE_BLOCK_DATA: {
+                const Block* block = _findBlock(cursor.seq);
+                if (!block) {
+                    // Блок затёрт во время отдачи - поток обрывается
+                    cursor.stage = STAGE_DONE;
+                    break;
+                }
+
+                uint16_t dataLength = cursor.blockHeader.length - cursor.tailLength;
+                size_t chunk;
+                if (cursor.position < dataLength) {
+                    chunk = dataLength - cursor.position;
+                    if (chunk > maxLen - written) chunk = maxLen - written;
+                    memcpy(buffer + written, block->data + cursor.position, chunk);
+                } else {
+                    chunk = cursor.blockHeader.length - cursor.position;
+                    if (chunk > maxLen - written) chunk = maxLen - written;
+                    memcpy(buffer + written, cursor.tail + (cursor.position - dataLength), chunk);
+                }
+                written += chunk;
+                cursor.position += chunk;
+
+                if (cursor.position == cursor.blockHeader.length) {
+                    cursor.seq++;
+                    cursor.stage = STAGE_BLOCK_START;
+                }
+                break;
+            }
+        }
+    }
+    return written;
+}
+
+uint8_t HistoryManager::_encodeVarint(uint32_t value, uint8_t* out) {
+    uint8_t length = 0;
+    while (value >= 0x80) {
+        out[length++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    out[length++] = value;
+    return length;
+}
+
+HistoryReader::HistoryReader(const HistoryManager& history) : _history(&history) {}
+
+bool HistoryReader::seek(uint32_t sec) {
+    const HistoryManager& history = *_history;
+    _hasCarry = false;
+    _isFinished = true;
+    if (history._blockCount == 0) return false;
+
+    uint32_t seq = history._nextSeq - history._blockCount;
+    for (uint32_t s = seq + 1; s != history._nextSeq; s++) {
+        const HistoryManager::Block* block = history._findBlock(s);
+        if (!block || block->header.startSec > sec) break;
+        seq = s;
+    }
+    _startBlock(seq);
+
+    HistorySpan span;
+    while (_decode(span)) {
+        if (span.startSec + span.length <= sec) continue;
+        if (span.startSec < sec) {
+            span.length -= sec - span.startSec;
+            span.startSec = sec;
+        }
+        _carry = span;
+        _hasCarry = true;
+        return true;
+    }
+    return false;
+}
+
+bool HistoryReader::next(HistorySpan& span, uint32_t endSec) {
+    if (!_hasCarry) {
+        if (!_decode(_carry)) return false;
+        _hasCarry = true;
+    }
+    if (_carry.startSec >= endSec) return false;
+
+    span = _carry;
+    if (span.startSec + span.length > endSec) {
+        span.length = endSec - span.startSec;
+        _carry.startSec = endSec;
+        _carry.length -= span.length;
+    } else {
+        _hasCarry = false;
+    }
+    return true;
+}
+
+void HistoryReader::_startBlock(uint32_t seq) {
+    const HistoryManager::Block* block = _history->_findBlock(seq);
+    _isFinished = (block == nullptr);
+    if (!block) return;
+
+    _seq = seq;
+    _offset = 0;
+    _sec = block->header.startSec;
+    _value = block->header.startValue;
+    _isPumpOn = block->header.flags & HISTORY_FLAG_PUMP;
+    _pendingStep = 0;
+    _isHeaderPending = true;
+    _isTailDone = false;
+}
+
+bool HistoryReader::_decode(HistorySpan& span) {
+    const HistoryManager& history = *_history;
+
+    while (!_isFinished) {
+        if (_isHeaderPending || _pendingStep != 0) {
+            if (!_isHeaderPending) {
+                _value += _pendingStep;
+                _sec++;
+            }
+            _isHeaderPending = false;
+            _pendingStep = 0;
+            span = { _sec, 1, _value, _isPumpOn };
+            return true;
+        }
+
+        const HistoryManager::Block* block = history._findBlock(_seq);
+        if (!block) {
+            // Блок затёрт новыми данными - чтение обрывается
+            _isFinished = true;
+            return false;
+        }
+
+        if (_offset < block->header.length) {
+            uint32_t token = 0;
+            uint8_t shift = 0;
+            uint8_t byte;
+            do {
+                byte = block->data[_offset++];
+                token |= (uint32_t)(byte & 0x7F) << shift;
+                shift += 7;
+            } while ((byte & 0x80) && _offset < block->header.length);
+
+            uint8_t tag = token & 3;
+            if (tag == TAG_SAMPLE) {
+                uint32_t zz = token >> 3;
+                int32_t delta = (int32_t)(zz >> 1) ^ -(int32_t)(zz & 1);
+                _value += delta;
+                _isPumpOn = token & 4;
+                _sec++;
+                span = { _sec, 1, _value, _isPumpOn };
+                return true;
+            }
+
+            uint32_t run = token >> 2;
+            if (tag != TAG_RUN) _pendingStep = (tag == TAG_STEP_UP) ? 1 : -1;
+            if (run == 0) continue;
+            span = { _sec + 1, run, _value, _isPumpOn };
+            _sec += run;
+            return true;
+        }
+
+        if (_seq + 1 != history._nextSeq) {
+            _startBlock(_seq + 1);
+            continue;
+        }
+
+        // Конец последнего блока: ещё не записанная серия
+        _isFinished = true;
+        if (!_isTailDone && history._pendingRun > 0) {
+            _isTailDone = true;
+            span = { _sec + 1, history._pendingRun, _value, _isPumpOn };
+            _sec += history._pendingRun;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,153 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 40 блоков: сутки отсчётов даже у часто качающего приямка (tests/test_history.cpp)
+#ifndef HISTORY_BUFFER_BYTES
+#define HISTORY_BUFFER_BYTES 10240
+#endif
+
+#ifndef HISTORY_RESOLUTION_MM
+#define HISTORY_RESOLUTION_MM 10
+#endif
+
+// История уровня и насоса с шагом 1 с, сжатая в кольцо блоков в RAM.
+// Каждый блок начинается с абсолютного отсчёта (заголовок), дальше идут
+// токены varint, младшие два бита - тип:
+//   0 - новый отсчёт: бит 2 - насос, x >> 3 - zigzag(разница уровня);
+//   1 - ещё (x >> 2) секунд с тем же значением и насосом;
+//   2/3 - (x >> 2) секунд без изменений, затем уровень +1/-1 единица.
+// Уровень хранится в единицах HISTORY_RESOLUTION_MM с гистерезисом в одну
+// единицу, поэтому шум датчика не порождает токенов. При заполнении кольца
+// затирается самый старый блок.
+//
+// Поток /history: HistoryStreamHeader, затем блоки - HistoryBlockHeader и
+// length байт токенов. Все поля little-endian.
+
+struct HistoryStreamHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t resolutionMm;
+    uint32_t lastSec;
+};
+
+struct HistoryBlockHeader {
+    uint32_t startSec;
+    uint16_t startValue;
+    uint8_t flags;
+    uint8_t reserved;
+    uint16_t length;
+    uint16_t sampleCount;
+};
+
+static const uint16_t HISTORY_VERSION = 1;
+static const uint8_t HISTORY_FLAG_PUMP = 0x01;
+
+struct HistoryCursor {
+    uint8_t stage;
+    uint16_t position;
+    uint32_t seq;
+    uint32_t endSeq;
+    HistoryStreamHeader streamHeader;
+    HistoryBlockHeader blockHeader;
+    uint8_t tail[3];
+    uint8_t tailLength;
+};
+
+// Отрезок одинаковых отсчётов: length секунд подряд начиная с startSec
+struct HistorySpan {
+    uint32_t startSec;
+    uint32_t length;
+    uint16_t value;
+    bool isPumpOn;
+};
+
+class HistoryManager;
+
+// Последовательный декодер кольца: отдаёт серии целиком, а не посекундно.
+// Состояние - несколько байт, его можно копировать для повторного прохода.
+class HistoryReader {
+public:
+    explicit HistoryReader(const HistoryManager& history);
+
+    // Встаёт на секунду sec (или на самую старую, если sec уже затёрта)
+    bool seek(uint32_t sec);
+    // Следующий отрезок, обрезанный до endSec (не включая); остаток
+    // сохраняется до следующего вызова
+    bool next(HistorySpan& span, uint32_t endSec);
+
+private:
+    const HistoryManager* _history;
+    uint32_t _seq = 0;
+    uint16_t _offset = 0;
+    uint32_t _sec = 0;
+    uint16_t _value = 0;
+    bool _isPumpOn = false;
+    int8_t _pendingStep = 0;
+    bool _isHeaderPending = false;
+    bool _isTailDone = false;
+    bool _isFinished = true;
+    bool _hasCarry = false;
+    HistorySpan _carry;
+
+    void _startBlock(uint32_t seq);
+    bool _decode(HistorySpan& span);
+};
+
+class HistoryManager {
+    friend class HistoryReader;
+
+public:
+    static const uint16_t BLOCK_BYTES = 256;
+    static const uint16_t BLOCK_COUNT = HISTORY_BUFFER_BYTES / BLOCK_BYTES;
+    static const uint16_t RESOLUTION_MM = HISTORY_RESOLUTION_MM;
+    static_assert(BLOCK_COUNT >= 2, "HISTORY_BUFFER_BYTES is too small");
+
+    HistoryManager();
+
+    // Вызывается раз в секунду; пропущенные секунды считаются повтором
+    void addSample(unsigned long nowMs, uint16_t distanceMm, bool isPumpOn);
+
+    uint32_t getUptimeSec() const;
+    uint32_t getOldestSec() const;
+    size_t getBytesUsed() const;
+
+    void openCursor(HistoryCursor& cursor) const;
+    size_t read(HistoryCursor& cursor, uint8_t* buffer, size_t maxLen) const;
+
+private:
+    static const uint16_t DATA_BYTES = BLOCK_BYTES - sizeof(uint32_t) - sizeof(HistoryBlockHeader);
+    static const uint32_t MAX_RUN = 8191;
+
+    struct Block {
+        uint32_t seq;
+        HistoryBlockHeader header;
+        uint8_t data[DATA_BYTES];
+    };
+
+    Block _blocks[BLOCK_COUNT];
+    uint32_t _nextSeq = 0;
+    uint16_t _blockCount = 0;
+
+    bool _hasSample = false;
+    uint16_t _lastValue = 0;
+    bool _lastPump = false;
+    uint32_t _pendingRun = 0;
+    uint32_t _lastSec = 0;
+
+    unsigned long _lastMs = 0;
+    unsigned long _msRemainder = 0;
+    uint32_t _uptimeSec = 0;
+
+    uint16_t _quantize(uint16_t distanceMm) const;
+    void _openBlock(uint32_t startSec, uint16_t value, bool isPumpOn);
+    bool _appendToken(uint32_t token, uint16_t samples);
+    void _flushRun();
+    const Block* _findBlock(uint32_t seq) const;
+
+    static uint8_t _encodeVarint(uint32_t value, uint8_t* out);
+};
+
+#endif
@@ -1,650 +0,0 @@
-#ifndef INDEX_HTML_GZ_H
-  #define INDEX_HTML_GZ_H
-
-  #include <stdint.h>
-
-  static const uint8_t index_html_gz[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x08, 0x20, 0xaf, 0x3c, 0x69, 0x02, 0x03, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x00, 0xd5, 0x3d, 0x6b,
-  0x73, 0x1b, 0xc7, 0x91, 0xdf, 0xf9, 0x2b, 0x46, 0xb0, 0x63, 0x00, 0x31,
-  0x01, 0x82, 0x92, 0x69, 0xcb, 0x24, 0xc1, 0x44, 0x91, 0xac, 0x44, 0x29,
-  0x3b, 0x52, 0x85, 0xf2, 0xb9, 0xae, 0x5c, 0xae, 0x68, 0x09, 0x2c, 0xc8,
-  0x8d, 0x96, 0x58, 0xdc, 0xee, 0x42, 0x14, 0xa3, 0xb0, 0x4a, 0xf2, 0x23,
-  0x72, 0x4e, 0x3a, 0x4b, 0x7e, 0xe8, 0xa2, 0x58, 0xb6, 0x1e, 0x76, 0xee,
-  0x2e, 0x57, 0x4e, 0x95, 0x29, 0xda, 0xb4, 0xa8, 0x87, 0xa9, 0xbf, 0xb0,
-  0xf8, 0x0b, 0xf9, 0x25, 0xd7, 0xdd, 0x33, 0xbb, 0x3b, 0x33, 0x3b, 0x0b,
-  0x2c, 0x28, 0xdb, 0xc9, 0x89, 0x22, 0x01, 0xec, 0xce, 0xf6, 0xf4, 0xf4,
-  0x7b, 0xba, 0x67, 0x06, 0xf3, 0xfb, 0x8e, 0x1c, 0x3f, 0x7c, 0xf2, 0x5f,
-  0x4f, 0xbc, 0xc4, 0x56, 0xc2, 0x55, 0x77, 0x61, 0x62, 0x1e, 0x5f, 0x98,
-  0x6b, 0x75, 0x97, 0x9b, 0x25, 0xbf, 0x5f, 0xc2, 0x0b, 0xb6, 0xd5, 0x5e,
-  0x98, 0x60, 0xf0, 0x6f, 0x7e, 0xd5, 0x0e, 0x2d, 0xd6, 0x5a, 0xb1, 0xfc,
-  0xc0, 0x0e, 0x9b, 0xa5, 0x57, 0x4f, 0x1e, 0xad, 0x1d, 0x2c, 0xc9, 0xb7,
-  0xba, 0xd6, 0xaa, 0xdd, 0x2c, 0x9d, 0x71, 0xec, 0xb5, 0x9e, 0xe7, 0x87,
-  0x25, 0xd6, 0xf2, 0xba, 0xa1, 0xdd, 0x85, 0xa6, 0x6b, 0x4e, 0x3b, 0x5c,
-  0x69, 0xb6, 0xed, 0x33, 0x4e, 0xcb, 0xae, 0xd1, 0x87, 0x49, 0xe6, 0x74,
-  0x9d, 0xd0, 0xb1, 0xdc, 0x5a, 0xd0, 0xb2, 0x5c, 0xbb, 0x39, 0x5d, 0x6f,
-  0xc4, 0xa0, 0x42, 0x27, 0x74, 0xed, 0x85, 0xe8, 0xf3, 0xe8, 0xf1, 0xe0,
-  0x7c, 0xb4, 0x19, 0x6d, 0x45, 0x0f, 0xa3, 0xed, 0xe8, 0xdb, 0x68, 0x27,
-  0xda, 0x66, 0xf0, 0xb2, 0x39, 0xb8, 0x10, 0xed, 0xe2, 0x6f, 0xf4, 0x68,
-  0x7e, 0x8a, 0x37, 0xe5, 0x8f, 0x05, 0xe1, 0x7a, 0xfc, 0x1e, 0xff, 0x4d,
-  0xfd, 0x98, 0xd5, 0x6a, 0x35, 0x16, 0xdd, 0x8c, 0xee, 0x0e, 0xfe, 0x48,
-  0x0f, 0x0f, 0x2e, 0x0c, 0xde, 0x84, 0x37, 0x0f, 0xa3, 0x1d, 0xba, 0xf3,
-  0xe3, 0xa9, 0xa4, 0xed, 0x92, 0xd7, 0x5e, 0x67, 0xe7, 0x92, 0x8f, 0xf8,
-  0xaf, 0x03, 0xa8, 0xd7, 0x3a, 0xd6, 0xaa, 0xe3, 0xae, 0xcf, 0xb2, 0x9a,
-  0xd5, 0xeb, 0xb9, 0x76, 0x2d, 0x58, 0x0f, 0x42, 0x7b, 0x75, 0x92, 0xfd,
-  0xcc, 0x75, 0xba, 0xa7, 0x5f, 0xb1, 0x5a, 0x8b, 0xf4, 0xf9, 0x28, 0xb4,
-  0x9c, 0x64, 0xa5, 0x45, 0x7b, 0xd9, 0xb3, 0xd9, 0xab, 0xc7, 0x4a, 0x93,
-  0xec, 0xd7, 0xde, 0x92, 0x17, 0x7a, 0x93, 0xec, 0x17, 0xb6, 0x7b, 0xc6,
-  0x0e, 0x9d, 0x96, 0x35, 0xc9, 0x0e, 0xf9, 0x30, 0xd4, 0x49, 0x16, 0x58,
-  0xdd, 0xa0, 0x16, 0xd8, 0xbe, 0xd3, 0x99, 0x53, 0x7a, 0x5b, 0xb2, 0x5a,
-  0xa7, 0x97, 0x7d, 0xaf, 0xdf, 0x6d, 0xd7, 0x5a, 0x9e, 0xeb, 0xf9, 0xb3,
-  0xec, 0xa9, 0x4e, 0xa3, 0xb3, 0xbf, 0x33, 0xa3, 0x36, 0x8b, 0xef, 0x1d,
-  0x38, 0x70, 0x40, 0xbd, 0xb1, 0x6a, 0xf9, 0xcb, 0x4e, 0x77, 0x96, 0x35,
-  0xd4, 0xcb, 0x3d, 0xab, 0xdd, 0x76, 0xba, 0xcb, 0xb3, 0x6c, 0x7f, 0xa3,
-  0x77, 0x56, 0xbd, 0xd5, 0x76, 0x82, 0x9e, 0x6b, 0xc1, 0xd8, 0x3a, 0xae,
-  0xad, 0xdd, 0xfa, 0x6d, 0x3f, 0x08, 0x9d, 0xce, 0x7a, 0x4d, 0x70, 0x6f,
-  0x96, 0xb5, 0xe0, 0xaf, 0xed, 0xab, 0x8d, 0x2c, 0xd7, 0x59, 0xee, 0xd6,
-  0x1c, 0x18, 0x7f, 0xc0, 0x61, 0xd4, 0x82, 0xd0, 0xf2, 0x43, 0x0d, 0x2d,
-  0xa7, 0x5b, 0x5b, 0xb1, 0x9d, 0xe5, 0x15, 0x00, 0x32, 0xdd, 0x68, 0x9c,
-  0x59, 0x99, 0xcb, 0xd2, 0x38, 0x70, 0x7e, 0x67, 0xc3, 0xdd, 0xe7, 0x00,
-  0x41, 0xe4, 0xd9, 0x3c, 0xf2, 0xec, 0xf3, 0xe8, 0x93, 0xe8, 0x5a, 0xf4,
-  0x69, 0xf4, 0xb7, 0xe8, 0xaf, 0xf8, 0xca, 0xe0, 0xe5, 0x76, 0x74, 0x3d,
-  0xfa, 0x4b, 0xf4, 0x99, 0xcc, 0xb5, 0x8d, 0x89, 0xe4, 0x6d, 0x1d, 0x71,
-  0xb5, 0x9c, 0xae, 0xed, 0x6b, 0x6c, 0x34, 0x11, 0xb6, 0xd3, 0xc9, 0xa3,
-  0xd2, 0x8c, 0x4e, 0xa5, 0x25, 0xcf, 0x6f, 0xdb, 0x7e, 0xcd, 0xb7, 0xda,
-  0x4e, 0x3f, 0xc0, 0x31, 0x64, 0x1b, 0xc0, 0xc0, 0x57, 0xac, 0xb6, 0xb7,
-  0x06, 0xc4, 0x67, 0x30, 0x08, 0x36, 0xbd, 0x1f, 0xfe, 0xf8, 0xcb, 0x4b,
-  0x56, 0xa5, 0x31, 0xc9, 0xc4, 0xff, 0xfa, 0x74, 0x55, 0x7d, 0x8c, 0x54,
-  0x80, 0x68, 0xf2, 0x23, 0x9d, 0x91, 0x67, 0x6b, 0xe2, 0xe6, 0x4c, 0xc3,
-  0xdc, 0x9b, 0xf3, 0x3b, 0x42, 0x56, 0xa0, 0x06, 0x97, 0xe6, 0x4c, 0x14,
-  0x59, 0x99, 0xd6, 0x28, 0x11, 0xda, 0x67, 0xc3, 0x1a, 0x71, 0xcd, 0xcc,
-  0xd0, 0x98, 0x3c, 0xd3, 0xd6, 0xfe, 0xa5, 0xe7, 0xda, 0x26, 0xf1, 0xaa,
-  0x85, 0x5e, 0x2f, 0x23, 0x62, 0xe2, 0x16, 0x08, 0x7c, 0xe8, 0xad, 0x02,
-  0xd2, 0x82, 0x8d, 0xc0, 0xc2, 0x47, 0xa8, 0xb5, 0x83, 0xcb, 0x83, 0x77,
-  0xf1, 0x95, 0x81, 0xce, 0xbe, 0x89, 0x0a, 0x38, 0x78, 0x2b, 0x7a, 0x0c,
-  0x9a, 0x48, 0xfa, 0x7c, 0x6f, 0xf0, 0x56, 0x0e, 0x3f, 0x63, 0xe5, 0xfd,
-  0x14, 0xd4, 0xf7, 0x83, 0xe8, 0x8b, 0xe8, 0xcf, 0x2c, 0xba, 0x13, 0x7d,
-  0x06, 0x22, 0x70, 0x23, 0xfa, 0x1b, 0x8b, 0x3e, 0x82, 0x97, 0x2f, 0x19,
-  0xdc, 0xb8, 0x06, 0x62, 0xf1, 0x5f, 0xd0, 0xe8, 0x1a, 0x6f, 0x70, 0x07,
-  0x5a, 0xde, 0x88, 0x3e, 0x8e, 0xae, 0xeb, 0xfa, 0x5d, 0xef, 0xda, 0xe1,
-  0x9a, 0xe7, 0x9f, 0xae, 0x59, 0xad, 0x96, 0x1d, 0x04, 0x35, 0xd4, 0xdf,
-  0x31, 0xc9, 0x23, 0xcb, 0xea, 0x7e, 0x9d, 0x2f, 0x31, 0xed, 0x9e, 0x7f,
-  0xfe, 0xf9, 0xa1, 0xd4, 0x51, 0xd5, 0x50, 0x96, 0x5f, 0x13, 0x82, 0x96,
-  0x86, 0x62, 0xdc, 0x4b, 0xa3, 0xf1, 0xc2, 0x92, 0x2e, 0xc3, 0x84, 0x7e,
-  0xdb, 0x6e, 0x79, 0xbe, 0x15, 0x3a, 0x1e, 0x8c, 0xa1, 0xeb, 0x75, 0xed,
-  0x31, 0xba, 0x9a, 0x5d, 0xf1, 0xce, 0x64, 0x94, 0x27, 0x03, 0x14, 0xd4,
-  0xc8, 0xf6, 0xe1, 0x01, 0x33, 0xe4, 0x98, 0x69, 0x77, 0x12, 0x33, 0x0b,
-  0xb6, 0xfb, 0x01, 0xbc, 0xd9, 0x8c, 0xbe, 0x06, 0x73, 0xfd, 0x20, 0xc3,
-  0x95, 0xd0, 0x5a, 0x0a, 0xb4, 0x2e, 0x87, 0x98, 0xa5, 0xa1, 0xb4, 0x94,
-  0x94, 0x35, 0x69, 0x00, 0x7a, 0x18, 0x78, 0xae, 0xd3, 0x66, 0x4f, 0xd9,
-  0x0d, 0xfc, 0x31, 0x93, 0x03, 0x90, 0xa8, 0x2d, 0xf5, 0xe1, 0x91, 0xae,
-  0xee, 0x01, 0xd0, 0xa8, 0x81, 0xed, 0x00, 0xcd, 0x9e, 0x1e, 0x65, 0xad,
-  0x43, 0x1f, 0x0c, 0x7b, 0xcf, 0xf2, 0x41, 0x70, 0x4c, 0x38, 0xe9, 0xec,
-  0x50, 0xac, 0xce, 0x74, 0xc6, 0xea, 0xc8, 0xb2, 0xf6, 0xbc, 0xf1, 0xe6,
-  0x9a, 0x30, 0xaa, 0x60, 0x23, 0x34, 0x49, 0xec, 0xfb, 0x01, 0x22, 0xd4,
-  0xf3, 0x9c, 0x7c, 0x15, 0xcf, 0x88, 0x29, 0xa1, 0xef, 0x70, 0x1e, 0x5b,
-  0xae, 0x0b, 0x06, 0xeb, 0x40, 0xc0, 0x6c, 0x2b, 0xb0, 0x87, 0x12, 0xf8,
-  0x40, 0x42, 0x60, 0xe3, 0xf0, 0xcd, 0x44, 0x36, 0x0a, 0x9a, 0xc9, 0x4a,
-  0xbf, 0x80, 0x3f, 0xa3, 0xa0, 0xd5, 0xad, 0x56, 0xe8, 0x9c, 0xb1, 0xc7,
-  0x50, 0x14, 0x65, 0x0c, 0xb5, 0xbc, 0x96, 0x7a, 0x6f, 0xc2, 0x15, 0xe6,
-  0x09, 0x6b, 0xbe, 0xb2, 0x49, 0x0f, 0x9b, 0x71, 0x4d, 0x60, 0x2c, 0xb9,
-  0x5e, 0xeb, 0x74, 0x41, 0xbd, 0x1a, 0xbc, 0x0d, 0xe6, 0xf4, 0x7c, 0xf4,
-  0x28, 0xa3, 0x51, 0x1d, 0xcf, 0x5f, 0x45, 0x99, 0xed, 0xf7, 0xb4, 0x6e,
-  0x34, 0xe5, 0x51, 0x65, 0x4e, 0xea, 0xcb, 0xb5, 0x96, 0x6c, 0xb7, 0x20,
-  0x8a, 0x39, 0xe6, 0xbf, 0xa0, 0xb4, 0x4a, 0x9d, 0x3a, 0xdd, 0x5e, 0x3f,
-  0x7c, 0x3d, 0x5c, 0xef, 0x41, 0xf0, 0x88, 0x36, 0xa7, 0xf4, 0xc6, 0xe4,
-  0xd8, 0xf7, 0xba, 0xfd, 0xd5, 0x25, 0xdb, 0x2f, 0xbd, 0xa1, 0xe1, 0x9e,
-  0xeb, 0x68, 0x53, 0xf5, 0xcb, 0xb1, 0x23, 0x70, 0x27, 0x35, 0x20, 0xad,
-  0x56, 0x6b, 0x68, 0x60, 0x30, 0x33, 0xae, 0xa7, 0x36, 0xa9, 0x39, 0xf9,
-  0xcd, 0x9b, 0x14, 0xa5, 0x26, 0x51, 0x2f, 0xdd, 0x61, 0x60, 0x3f, 0x1f,
-  0x0e, 0xae, 0x30, 0xf0, 0x9d, 0x68, 0x48, 0xef, 0x52, 0x93, 0xad, 0x68,
-  0x93, 0xc2, 0x61, 0x06, 0x8e, 0x16, 0xae, 0xa1, 0x64, 0x0c, 0x2e, 0x83,
-  0xc3, 0xbd, 0x34, 0x78, 0x27, 0xc7, 0xa9, 0xca, 0xe4, 0x6a, 0xad, 0xd8,
-  0xad, 0xd3, 0x80, 0x51, 0x86, 0x60, 0x82, 0xa1, 0x7e, 0x1c, 0xb4, 0xe9,
-  0x03, 0x23, 0x55, 0x47, 0x31, 0x9b, 0x65, 0x14, 0xb8, 0x57, 0xa6, 0xeb,
-  0xfb, 0xab, 0x66, 0xd9, 0x8f, 0xfb, 0x10, 0x02, 0x39, 0x54, 0xb4, 0x9c,
-  0x2e, 0xba, 0x95, 0x5a, 0xd6, 0xea, 0x2b, 0x71, 0xa6, 0x31, 0x6e, 0xc9,
-  0xb3, 0x78, 0x5a, 0x78, 0xd8, 0x26, 0xfb, 0x06, 0xf3, 0x8d, 0x21, 0xea,
-  0xe1, 0xda, 0x9d, 0xd0, 0xe4, 0x59, 0x84, 0xb0, 0xf0, 0x00, 0x28, 0x4f,
-  0x60, 0xe2, 0xa7, 0x25, 0xb7, 0x63, 0x17, 0x76, 0x94, 0x0f, 0x80, 0x95,
-  0xbb, 0xd1, 0x63, 0x72, 0x93, 0xa8, 0xe0, 0x24, 0x04, 0x18, 0x2d, 0x41,
-  0xa8, 0xb4, 0x99, 0x51, 0x73, 0x6e, 0xfc, 0x8c, 0x23, 0x19, 0xe2, 0x40,
-  0x97, 0x2d, 0x23, 0xf6, 0x85, 0x63, 0x94, 0xa5, 0x50, 0x77, 0x91, 0x8a,
-  0x12, 0xe5, 0x7a, 0x64, 0x93, 0xf7, 0x1b, 0xa5, 0x3f, 0x43, 0xfd, 0xd8,
-  0x13, 0xf8, 0x47, 0xd9, 0xd3, 0xe9, 0x5e, 0x87, 0xdc, 0x5e, 0xee, 0xd0,
-  0x6b, 0x3d, 0xdf, 0x01, 0x52, 0xad, 0x8f, 0x76, 0x5d, 0x26, 0xb7, 0x23,
-  0xee, 0xad, 0xad, 0x80, 0x24, 0x8f, 0xec, 0xa2, 0xa8, 0x8f, 0x6c, 0x34,
-  0x66, 0x9e, 0x5f, 0x3a, 0x90, 0x0f, 0x2e, 0xe8, 0x53, 0x88, 0x37, 0x1a,
-  0xd0, 0xfe, 0x83, 0xd6, 0x0b, 0xcf, 0xcd, 0x14, 0xc3, 0x38, 0x7e, 0xa7,
-  0x76, 0xd5, 0xb6, 0xba, 0xcb, 0x45, 0x50, 0x6e, 0xb7, 0x0e, 0xcc, 0x14,
-  0xed, 0x49, 0xe9, 0x61, 0x16, 0x04, 0xdb, 0x5a, 0x72, 0xed, 0xf6, 0xe8,
-  0x3e, 0x32, 0xc6, 0x3a, 0x16, 0xa6, 0xae, 0x87, 0x21, 0xbe, 0xeb, 0xad,
-  0xd9, 0x6d, 0x73, 0x3f, 0x30, 0x85, 0x0d, 0xfb, 0x41, 0x4d, 0xe8, 0x50,
-  0xae, 0xb0, 0x67, 0xad, 0x7d, 0x16, 0x09, 0xfb, 0x45, 0xbb, 0x65, 0x77,
-  0xc6, 0x13, 0x7a, 0x45, 0x74, 0x97, 0x3c, 0xb7, 0x3d, 0x37, 0xd6, 0x14,
-  0xa5, 0xa8, 0x8f, 0xaf, 0x07, 0x76, 0x17, 0xe8, 0x91, 0x33, 0xcc, 0x31,
-  0x26, 0x42, 0xfb, 0x9f, 0x1b, 0x73, 0x04, 0x31, 0x71, 0x9e, 0x7b, 0x71,
-  0xa6, 0x31, 0xf3, 0x82, 0x39, 0x85, 0x81, 0x56, 0x84, 0x35, 0x86, 0xda,
-  0xcd, 0xab, 0xe0, 0x06, 0x37, 0xa3, 0xc7, 0x64, 0x3d, 0xb7, 0xd0, 0x70,
-  0xd2, 0xc4, 0xf2, 0xb2, 0x6e, 0x26, 0x7f, 0xba, 0x6a, 0xb7, 0x1d, 0x8b,
-  0x55, 0xa4, 0x39, 0xf5, 0x73, 0x07, 0x01, 0x7a, 0x55, 0x17, 0xa1, 0x6c,
-  0xf6, 0x47, 0xe1, 0xb7, 0x66, 0x42, 0x36, 0x94, 0x4f, 0xb9, 0x99, 0x07,
-  0x03, 0xc3, 0x35, 0x40, 0x7a, 0xfe, 0x20, 0x6b, 0x25, 0x37, 0x86, 0xea,
-  0x9d, 0xb5, 0xe4, 0xf5, 0xc3, 0x9a, 0xd3, 0x4a, 0x66, 0x2e, 0x3d, 0x2f,
-  0x09, 0xe2, 0x97, 0xc0, 0x05, 0xf5, 0x63, 0x75, 0xe2, 0x6e, 0x2b, 0x11,
-  0x87, 0xd8, 0xb7, 0x27, 0x17, 0x74, 0x96, 0x52, 0x20, 0x72, 0x1b, 0x48,
-  0x7c, 0x0f, 0x27, 0xf1, 0x83, 0xf3, 0xe0, 0x91, 0xc0, 0x41, 0xed, 0x02,
-  0xa5, 0x1f, 0x80, 0x6f, 0x12, 0x14, 0x4e, 0x26, 0x13, 0xad, 0x17, 0x66,
-  0x5e, 0x68, 0xcf, 0x11, 0x77, 0x60, 0x2a, 0x8e, 0x99, 0x3a, 0x88, 0x5e,
-  0x06, 0x57, 0x60, 0x76, 0x7f, 0x11, 0xf9, 0x33, 0xb8, 0x14, 0xdd, 0x67,
-  0x83, 0x3f, 0x00, 0xa3, 0xb6, 0x07, 0x6f, 0x32, 0x74, 0x71, 0x18, 0xc7,
-  0x60, 0xcc, 0xf2, 0x10, 0x1a, 0x6c, 0x62, 0x22, 0x60, 0xf0, 0x5e, 0x02,
-  0xd4, 0x64, 0xf6, 0x65, 0x9b, 0x1d, 0x1b, 0xea, 0xfd, 0x01, 0xc7, 0xf2,
-  0x16, 0x4d, 0x2f, 0xb7, 0x30, 0xee, 0x81, 0x6e, 0x00, 0x3a, 0xa0, 0x0b,
-  0xbf, 0xef, 0x00, 0xf8, 0xaf, 0x93, 0x5e, 0xc1, 0x83, 0x02, 0x7c, 0x10,
-  0x24, 0x89, 0x64, 0x8a, 0x8d, 0xd5, 0x2c, 0xb7, 0x80, 0x0c, 0x20, 0xc0,
-  0xfb, 0x22, 0x04, 0x1a, 0x08, 0xf4, 0xb3, 0x0d, 0x21, 0x37, 0x65, 0x25,
-  0x77, 0x18, 0x1f, 0x26, 0x5c, 0xf9, 0x5a, 0x24, 0x27, 0x77, 0x44, 0x1f,
-  0xf8, 0xec, 0x1d, 0xb8, 0x07, 0x23, 0xe4, 0xa1, 0x19, 0xca, 0x2a, 0x85,
-  0x66, 0xf0, 0x7e, 0x9b, 0xa1, 0x87, 0xc7, 0xb7, 0xac, 0x82, 0x09, 0x10,
-  0xca, 0x67, 0x5e, 0x4c, 0x1b, 0x60, 0x66, 0xe4, 0xc1, 0xe0, 0x3c, 0x04,
-  0x71, 0x6f, 0x46, 0xbb, 0x55, 0x84, 0x58, 0x5f, 0xf5, 0xda, 0x56, 0x1c,
-  0x36, 0xa9, 0x13, 0x8e, 0x18, 0x4d, 0x13, 0x3d, 0x65, 0x38, 0x31, 0x71,
-  0x53, 0xf1, 0xe8, 0x38, 0x67, 0xc1, 0x04, 0x72, 0x51, 0xfa, 0x5d, 0xcd,
-  0x81, 0x59, 0xfd, 0x59, 0x8a, 0x91, 0x1b, 0xe2, 0x1a, 0x8f, 0x64, 0x1a,
-  0x92, 0xf4, 0x88, 0xf7, 0x99, 0x70, 0x5a, 0xca, 0xee, 0x89, 0x2b, 0x59,
-  0x5b, 0x28, 0x92, 0x61, 0xf4, 0x53, 0x9f, 0xa9, 0xc6, 0x78, 0x13, 0xa7,
-  0x00, 0xdd, 0x6d, 0xc0, 0x35, 0x9e, 0xd4, 0x60, 0xa2, 0x08, 0xc8, 0xc2,
-  0x68, 0xd0, 0x35, 0xe4, 0x10, 0x1a, 0x28, 0x50, 0xef, 0xf7, 0x90, 0x8c,
-  0xf1, 0x40, 0xb8, 0xa4, 0x61, 0x66, 0xe8, 0x66, 0x74, 0x6d, 0x96, 0x45,
-  0xd7, 0x01, 0xc2, 0x63, 0x22, 0xc0, 0x65, 0xcc, 0x29, 0x11, 0x9b, 0x8e,
-  0x42, 0xf8, 0x03, 0xca, 0x15, 0x87, 0xce, 0x00, 0x15, 0x19, 0x95, 0x72,
-  0xe2, 0x2b, 0xa4, 0xdb, 0x1f, 0x28, 0x45, 0xf5, 0x26, 0x32, 0x14, 0x7e,
-  0x77, 0x89, 0xc7, 0x48, 0xbf, 0x2b, 0x71, 0x4f, 0xb9, 0xd1, 0xe7, 0xd0,
-  0x1c, 0xa9, 0x9a, 0x76, 0x15, 0x61, 0x7d, 0x92, 0xfd, 0x1a, 0x5c, 0xa2,
-  0x64, 0x18, 0x43, 0x06, 0x91, 0x4c, 0x6d, 0xb1, 0xc1, 0x7f, 0x88, 0x0f,
-  0xdf, 0xa6, 0x83, 0xcc, 0x9b, 0x41, 0x08, 0x11, 0x7b, 0x1f, 0x1e, 0x7c,
-  0xa8, 0x4a, 0xd4, 0xe0, 0x02, 0xe3, 0x6a, 0x0a, 0x4c, 0xa7, 0x71, 0x61,
-  0x8e, 0x3c, 0x95, 0x21, 0x6d, 0x12, 0x9b, 0x4a, 0x83, 0x6f, 0xbb, 0x16,
-  0xce, 0x4c, 0xf3, 0xf8, 0xf7, 0x54, 0xc7, 0xc6, 0x9f, 0xb9, 0x84, 0xf6,
-  0x9f, 0x43, 0xef, 0xb7, 0xc1, 0x0a, 0xdf, 0x88, 0xae, 0xcf, 0x26, 0x76,
-  0x7b, 0x7a, 0xe6, 0x47, 0xcc, 0xea, 0x87, 0xde, 0x1c, 0x03, 0x0b, 0x7d,
-  0x97, 0x73, 0x03, 0x73, 0x7f, 0xa8, 0x29, 0xf8, 0x07, 0x86, 0xfe, 0x0d,
-  0xa1, 0x19, 0x4b, 0x63, 0x36, 0xeb, 0x6a, 0x98, 0x78, 0x1d, 0x3c, 0x78,
-  0x30, 0xed, 0xf7, 0x6a, 0xf4, 0x11, 0xfc, 0xde, 0xa2, 0x44, 0xe0, 0x07,
-  0x20, 0x01, 0x94, 0x17, 0x44, 0x44, 0xfe, 0x44, 0xf9, 0xe2, 0xdb, 0x31,
-  0xe8, 0x8c, 0x94, 0xca, 0x1e, 0xa0, 0x91, 0xf0, 0xe4, 0x13, 0x20, 0xf8,
-  0x03, 0x10, 0x9d, 0x1d, 0xd0, 0x9e, 0x58, 0x30, 0x36, 0x71, 0x9a, 0xf5,
-  0x2e, 0x89, 0xc3, 0x0e, 0x9f, 0x5d, 0xd1, 0x9f, 0x74, 0x3c, 0x3b, 0x30,
-  0xbd, 0x92, 0xd9, 0x95, 0xce, 0xb6, 0xb0, 0x93, 0x58, 0x1d, 0x5e, 0xc4,
-  0x5c, 0xf7, 0xd0, 0x4e, 0xd0, 0x30, 0x52, 0x25, 0x03, 0xac, 0xd3, 0x24,
-  0x1b, 0x5c, 0x24, 0x6e, 0xdd, 0x45, 0xd9, 0x20, 0x72, 0xe1, 0x5d, 0x32,
-  0x62, 0xd0, 0x21, 0xba, 0x36, 0x30, 0x15, 0x9b, 0x52, 0xbf, 0xa9, 0x90,
-  0xe4, 0xe4, 0xa7, 0x0d, 0x79, 0xe9, 0x99, 0x34, 0x2f, 0xcd, 0x55, 0x31,
-  0x9e, 0xb7, 0x59, 0x5d, 0x88, 0x3a, 0x85, 0x61, 0xb0, 0xda, 0xf6, 0xb1,
-  0xae, 0x14, 0x08, 0xeb, 0xaa, 0x76, 0x4d, 0x28, 0xab, 0x2a, 0x68, 0x02,
-  0x69, 0xd4, 0x41, 0x74, 0x18, 0x7f, 0x44, 0xb1, 0x26, 0x81, 0xbf, 0x32,
-  0x49, 0x57, 0xc1, 0x1b, 0x6c, 0xd1, 0x40, 0x2e, 0x20, 0x79, 0xc9, 0x34,
-  0x21, 0x41, 0xa3, 0x87, 0x8c, 0x4c, 0xf7, 0x5b, 0x5c, 0x05, 0x63, 0x49,
-  0x4e, 0x54, 0x00, 0xf5, 0xbf, 0x03, 0xe1, 0x5a, 0x0d, 0x2c, 0x1e, 0x17,
-  0xad, 0x58, 0xfa, 0x15, 0x09, 0xac, 0xab, 0xd6, 0x02, 0xc4, 0x6f, 0x9b,
-  0xab, 0xf7, 0xdb, 0x20, 0x73, 0xe0, 0xb3, 0x40, 0xcd, 0xd1, 0x3c, 0x13,
-  0xb2, 0xe4, 0x20, 0x90, 0x9e, 0xe8, 0x97, 0xc8, 0x66, 0x40, 0xff, 0x57,
-  0xc8, 0x35, 0xe1, 0x4c, 0x0b, 0xf4, 0x45, 0x18, 0x5c, 0x40, 0x61, 0x82,
-  0xcb, 0xdc, 0xb7, 0x9c, 0x77, 0x08, 0x05, 0xf9, 0x16, 0x0f, 0x47, 0x14,
-  0xa5, 0xb8, 0xad, 0xf8, 0xe9, 0x69, 0x7b, 0xbd, 0xe3, 0x5b, 0xab, 0x76,
-  0x10, 0x93, 0x90, 0x2b, 0x59, 0xc7, 0xf7, 0x56, 0xd9, 0x39, 0xaf, 0x67,
-  0xb5, 0x9c, 0x70, 0x1d, 0xad, 0x68, 0x76, 0xfe, 0xdc, 0xa8, 0xbf, 0x58,
-  0x9d, 0xdb, 0x10, 0x96, 0x56, 0x6a, 0x3b, 0x6d, 0x68, 0x3b, 0x8d, 0x2d,
-  0x05, 0x09, 0x3e, 0x16, 0x33, 0xc6, 0x07, 0x28, 0x9f, 0xf7, 0x48, 0xca,
-  0xb8, 0xbd, 0x47, 0x94, 0x2a, 0x44, 0xe2, 0x6d, 0x51, 0xf1, 0x7a, 0x50,
-  0x95, 0xad, 0x80, 0xeb, 0x05, 0xb6, 0xe6, 0xf7, 0x2c, 0xcb, 0x9a, 0x2b,
-  0x10, 0x41, 0x34, 0xb4, 0x08, 0x22, 0x9d, 0xf0, 0xc9, 0x11, 0xc4, 0x41,
-  0xe5, 0x62, 0x36, 0x18, 0xcc, 0xf8, 0x78, 0x74, 0xcc, 0x12, 0x6e, 0xdc,
-  0x33, 0x4f, 0xaa, 0xd7, 0x3a, 0x5e, 0xab, 0x1f, 0x64, 0xbc, 0x75, 0x23,
-  0x31, 0x87, 0xd2, 0x54, 0x5a, 0xe4, 0x4a, 0x90, 0xdb, 0x0f, 0xf8, 0x3c,
-  0x5a, 0x93, 0x32, 0xdd, 0x29, 0xa3, 0xac, 0xc8, 0xa2, 0xa7, 0x99, 0xcb,
-  0x95, 0xfd, 0xa2, 0x5f, 0x43, 0x15, 0x44, 0x2f, 0x9a, 0x48, 0x43, 0x11,
-  0x4f, 0xc7, 0xf3, 0x73, 0x4a, 0x6f, 0x24, 0xde, 0xb2, 0xfe, 0xbc, 0xa9,
-  0xad, 0x65, 0x0e, 0x47, 0x26, 0x86, 0x24, 0xf8, 0x0d, 0x40, 0x94, 0xc8,
-  0x66, 0x58, 0x0a, 0x9f, 0x93, 0x6e, 0x68, 0x44, 0x5d, 0x21, 0x62, 0x71,
-  0xbb, 0x4d, 0xbe, 0xeb, 0x3c, 0xbf, 0xc5, 0xad, 0x52, 0x35, 0x8e, 0xb8,
-  0x47, 0x45, 0xda, 0x4a, 0x10, 0x93, 0xcd, 0xbe, 0x09, 0x43, 0x99, 0x94,
-  0x8b, 0x94, 0x62, 0x11, 0xba, 0xe5, 0x51, 0x89, 0xae, 0x0d, 0xa9, 0x17,
-  0x43, 0xae, 0xd6, 0x50, 0x06, 0x45, 0x35, 0xa2, 0xaa, 0xf1, 0x94, 0x28,
-  0x1b, 0xcf, 0x4f, 0xf1, 0x3a, 0xf7, 0x3c, 0xce, 0x06, 0x16, 0xf8, 0x9c,
-  0x63, 0xbe, 0xed, 0x9c, 0x61, 0x2d, 0xd7, 0x0a, 0x82, 0x66, 0x29, 0x09,
-  0xf3, 0x4b, 0x69, 0x89, 0x79, 0x7e, 0x65, 0x7a, 0x01, 0xdc, 0x11, 0xfa,
-  0x81, 0x6d, 0x44, 0x2a, 0x26, 0xd1, 0xa6, 0x6c, 0x1e, 0x00, 0xf0, 0xb4,
-  0xf4, 0xc8, 0x3e, 0xad, 0xac, 0xf5, 0x3e, 0xd8, 0xb0, 0x9b, 0xd1, 0xc7,
-  0x20, 0xc1, 0x72, 0x05, 0xeb, 0x26, 0xde, 0xfa, 0x20, 0xa9, 0x70, 0x7d,
-  0x0e, 0x84, 0x96, 0x60, 0x04, 0x3d, 0xab, 0x1b, 0xe3, 0x95, 0x46, 0xb4,
-  0x25, 0xe6, 0x75, 0x5b, 0xae, 0xd3, 0x3a, 0xdd, 0x2c, 0x79, 0x3d, 0xbb,
-  0xfb, 0x0a, 0x12, 0xa3, 0x52, 0x2d, 0x2d, 0xfc, 0xfd, 0xc3, 0xeb, 0x30,
-  0x4a, 0x78, 0x44, 0x82, 0x20, 0x0d, 0xcc, 0x50, 0x0e, 0x92, 0x86, 0x88,
-  0xff, 0xc0, 0xeb, 0xee, 0x26, 0xa5, 0x3b, 0x0a, 0xcf, 0xc0, 0x54, 0x62,
-  0x58, 0xbd, 0x33, 0xcb, 0xe6, 0x2d, 0xb6, 0xe2, 0xdb, 0x9d, 0x66, 0xe9,
-  0xa9, 0x12, 0x73, 0xda, 0xcd, 0x12, 0x28, 0xc7, 0x2b, 0xed, 0x6e, 0xf0,
-  0x32, 0x42, 0x61, 0x21, 0x28, 0x0c, 0x2e, 0x14, 0xf8, 0xcd, 0x92, 0x6b,
-  0x21, 0xd4, 0xf9, 0x29, 0x4b, 0xc2, 0x61, 0x0a, 0x90, 0x58, 0x98, 0x30,
-  0xe2, 0x84, 0x85, 0x21, 0x0d, 0x89, 0x79, 0x51, 0xa3, 0x49, 0x5b, 0xc4,
-  0x55, 0x1b, 0x9e, 0x56, 0x97, 0x46, 0x1f, 0xac, 0x78, 0x6b, 0x27, 0xad,
-  0xa5, 0x4a, 0x79, 0xcd, 0xe9, 0x38, 0x65, 0xa0, 0xc0, 0x6b, 0xce, 0x51,
-  0x67, 0x7e, 0x8a, 0x37, 0x2f, 0x08, 0xd5, 0x04, 0x0e, 0x45, 0xc0, 0xf7,
-  0x5c, 0x84, 0x68, 0x5a, 0x9c, 0x90, 0xed, 0x21, 0x33, 0x44, 0x62, 0xfe,
-  0x07, 0x49, 0x4d, 0x0c, 0x4d, 0x37, 0xe2, 0xa6, 0x72, 0x17, 0xe9, 0x80,
-  0xa4, 0x44, 0xec, 0x4b, 0x32, 0x66, 0x89, 0x86, 0xf3, 0x01, 0x6b, 0x23,
-  0x91, 0xc8, 0x97, 0x56, 0x01, 0xb4, 0x46, 0x19, 0xa1, 0x56, 0x32, 0xb4,
-  0x86, 0xc6, 0xf4, 0x00, 0xe5, 0x8d, 0x99, 0x96, 0x37, 0x26, 0x14, 0x9d,
-  0xe0, 0x35, 0x40, 0xf2, 0x64, 0xdf, 0xef, 0xda, 0xed, 0xe3, 0x9c, 0x66,
-  0x2b, 0x98, 0x08, 0x6a, 0x96, 0xfa, 0xbd, 0xb6, 0x15, 0xda, 0x3f, 0x77,
-  0xbd, 0x25, 0xcb, 0x5d, 0xb4, 0xc3, 0x10, 0xd4, 0xaf, 0x52, 0x56, 0x9b,
-  0x97, 0x27, 0x59, 0xb8, 0xe2, 0x04, 0x3c, 0x4d, 0x6c, 0xb7, 0xab, 0x79,
-  0xdd, 0xf3, 0xbc, 0x31, 0x8c, 0x29, 0xd3, 0xdf, 0x82, 0x1a, 0xf9, 0xf3,
-  0x00, 0x9e, 0xec, 0xd6, 0x6b, 0x4e, 0x0d, 0x59, 0x4e, 0x8f, 0x1a, 0x48,
-  0xc0, 0xf9, 0x32, 0xe2, 0xd2, 0x1e, 0xc9, 0xcb, 0xfb, 0x04, 0xb5, 0xdd,
-  0x06, 0xbb, 0x09, 0x91, 0x03, 0x23, 0x39, 0xb9, 0x4b, 0x26, 0xed, 0xd2,
-  0x6c, 0x3e, 0x4e, 0x4f, 0xc4, 0x16, 0x0c, 0x00, 0xbd, 0x92, 0x58, 0x7f,
-  0x83, 0x82, 0x03, 0xda, 0x6f, 0x73, 0x1e, 0x81, 0x51, 0xb4, 0x0f, 0xbb,
-  0x0e, 0x08, 0x4e, 0x89, 0x9d, 0xb1, 0xdc, 0x3e, 0x34, 0xe8, 0x58, 0x6e,
-  0x60, 0x17, 0xe0, 0xd6, 0xa1, 0x13, 0xc0, 0x23, 0x6a, 0x0c, 0x93, 0xb6,
-  0xd0, 0x5b, 0x5e, 0x76, 0xed, 0xd7, 0x04, 0xec, 0x4a, 0x11, 0x76, 0x49,
-  0x5d, 0x2f, 0x80, 0x51, 0x7b, 0x88, 0x5a, 0x82, 0xe1, 0xe2, 0x38, 0x8c,
-  0xf9, 0xde, 0x69, 0x73, 0xe8, 0x44, 0x42, 0x97, 0xd0, 0xef, 0x17, 0x26,
-  0x0b, 0xb6, 0xdd, 0x3b, 0x55, 0xa0, 0xd3, 0x05, 0x98, 0xc6, 0xec, 0xc2,
-  0x8c, 0x9d, 0xe2, 0xb7, 0xaf, 0x53, 0x0b, 0x1b, 0x6d, 0xee, 0x41, 0x6e,
-  0xb3, 0xb2, 0x8a, 0xc3, 0x6b, 0x11, 0xed, 0x05, 0xe6, 0xc1, 0x08, 0x5b,
-  0x30, 0x54, 0xaa, 0xf5, 0x31, 0x04, 0x81, 0xd3, 0x86, 0x11, 0x7c, 0x4a,
-  0x39, 0x22, 0x31, 0x6b, 0xa6, 0x15, 0x56, 0xdc, 0x2f, 0xb0, 0xca, 0xe2,
-  0xe2, 0xb1, 0x23, 0xd5, 0x7c, 0x69, 0xcf, 0x30, 0x89, 0x4a, 0x7b, 0x84,
-  0x34, 0x81, 0x1e, 0xc5, 0x04, 0xe1, 0xb4, 0xe2, 0xa1, 0xd5, 0x1b, 0x75,
-  0x7c, 0x2c, 0xb6, 0x28, 0xc4, 0x4e, 0x13, 0x2b, 0x0a, 0xc8, 0xd7, 0x58,
-  0x64, 0xe8, 0xc1, 0x23, 0x80, 0x07, 0x92, 0x02, 0xc2, 0x00, 0x3e, 0xa9,
-  0x19, 0x5c, 0xde, 0xd3, 0xb0, 0x13, 0x50, 0xe3, 0x0f, 0x3d, 0x7e, 0xf4,
-  0x87, 0x19, 0xfe, 0xb8, 0xba, 0x38, 0xc2, 0x85, 0xf4, 0x03, 0x7b, 0x31,
-  0x84, 0xd8, 0xb4, 0x75, 0xec, 0xc4, 0x1e, 0x86, 0x2e, 0x3d, 0xad, 0xbb,
-  0x93, 0x58, 0x37, 0xc5, 0xfd, 0xde, 0x51, 0xc7, 0x76, 0xdb, 0x41, 0xae,
-  0x86, 0xea, 0xac, 0x95, 0xf1, 0xca, 0xf7, 0x33, 0x71, 0x9d, 0x0e, 0x02,
-  0xbd, 0x8b, 0x94, 0xc8, 0x7a, 0x00, 0x7a, 0x70, 0x9f, 0x1d, 0x3b, 0x51,
-  0x43, 0x07, 0xcf, 0xa7, 0x60, 0xc3, 0xa5, 0x21, 0x87, 0x25, 0x43, 0x38,
-  0x45, 0x4a, 0xa2, 0x0c, 0xaa, 0x24, 0x05, 0xa9, 0x6a, 0x99, 0xb3, 0xc4,
-  0x28, 0xbc, 0x6d, 0x96, 0xd4, 0xcc, 0x61, 0x01, 0xde, 0x8e, 0x14, 0x84,
-  0x8c, 0x49, 0x48, 0xa8, 0xa5, 0x8c, 0x7e, 0xb8, 0x32, 0x0c, 0xb3, 0x03,
-  0x7b, 0x97, 0x8a, 0x40, 0x13, 0x89, 0x5c, 0x85, 0x18, 0x42, 0xea, 0xef,
-  0x88, 0x1e, 0x3f, 0x07, 0x7c, 0xd7, 0xac, 0x75, 0x10, 0xa1, 0xbf, 0x82,
-  0xf0, 0xbc, 0x17, 0xdd, 0x7b, 0x42, 0x7a, 0xc4, 0xf0, 0xf6, 0x4a, 0x14,
-  0xf1, 0xfc, 0x3f, 0x01, 0x65, 0x16, 0xfb, 0x4b, 0x80, 0x24, 0x10, 0xe6,
-  0x13, 0x5a, 0xd2, 0x4b, 0x6e, 0xf0, 0xb1, 0xc8, 0xb9, 0xf3, 0xc9, 0xc5,
-  0x93, 0x51, 0x4a, 0xc0, 0xdf, 0x2b, 0xa1, 0xf8, 0xe3, 0xff, 0x04, 0x74,
-  0x3a, 0xf2, 0xab, 0xc5, 0xd2, 0x02, 0xfc, 0x79, 0x42, 0x72, 0x20, 0x98,
-  0xbd, 0xd2, 0x02, 0x9e, 0x7d, 0x12, 0x42, 0xec, 0x21, 0xdc, 0x4e, 0xe6,
-  0xc9, 0x9b, 0x14, 0x16, 0xa1, 0x63, 0xbd, 0x4f, 0xc5, 0x27, 0xaa, 0x19,
-  0x7c, 0xc3, 0x33, 0x72, 0x2c, 0x89, 0xa0, 0x76, 0xb4, 0x08, 0x4a, 0x99,
-  0x50, 0x29, 0x86, 0xd3, 0xea, 0x25, 0xe1, 0x50, 0x61, 0xd3, 0xf8, 0x44,
-  0x51, 0x12, 0x45, 0x7a, 0xd7, 0xa3, 0x47, 0x3c, 0x25, 0x95, 0x83, 0xee,
-  0x13, 0x86, 0x4b, 0x87, 0x46, 0x1b, 0x49, 0xde, 0xec, 0x1f, 0x16, 0x20,
-  0x11, 0x15, 0xa4, 0x10, 0x29, 0x9f, 0x16, 0x4f, 0x14, 0x3c, 0x15, 0x20,
-  0x44, 0xda, 0x74, 0x2f, 0xc4, 0x18, 0x39, 0x4d, 0x54, 0xf3, 0x09, 0xb8,
-  0x62, 0x46, 0x5a, 0xd7, 0x21, 0x27, 0x15, 0xac, 0x33, 0x76, 0x2c, 0x89,
-  0x18, 0x93, 0x44, 0x77, 0x80, 0x08, 0xef, 0x88, 0xa2, 0x82, 0x48, 0xf9,
-  0x7f, 0x9b, 0x91, 0x7e, 0x31, 0xad, 0xdd, 0x4b, 0x9e, 0xc1, 0xb8, 0x9d,
-  0xc2, 0x98, 0x77, 0x10, 0x69, 0x0e, 0x53, 0xea, 0x61, 0x48, 0xce, 0x41,
-  0x5e, 0x92, 0x64, 0xa2, 0xa5, 0x99, 0x30, 0x62, 0x85, 0x0a, 0xe7, 0x22,
-  0x5c, 0x38, 0xd1, 0x5f, 0xed, 0x1d, 0x57, 0x92, 0x2f, 0x76, 0x88, 0xd7,
-  0x30, 0x14, 0xb3, 0x2b, 0x34, 0xe7, 0x02, 0x5a, 0xd1, 0xc8, 0xcc, 0x09,
-  0x9d, 0x21, 0x7d, 0xf1, 0x25, 0x2a, 0x6a, 0x57, 0x9d, 0x4e, 0x5e, 0x5f,
-  0x7c, 0xda, 0x8b, 0x9d, 0x0d, 0x2e, 0xed, 0xa9, 0xbb, 0x84, 0xe7, 0xa2,
-  0xbf, 0x5f, 0xdb, 0x00, 0xff, 0x15, 0xab, 0xdb, 0xb7, 0x5c, 0xa9, 0x4f,
-  0x3f, 0xbd, 0x1a, 0x4f, 0x20, 0xff, 0xfe, 0x87, 0x07, 0x39, 0xc9, 0x2a,
-  0x83, 0x3c, 0x4a, 0x1c, 0x50, 0x17, 0xaf, 0xa4, 0xb6, 0xbf, 0x1f, 0x1c,
-  0x11, 0x97, 0x0c, 0xb8, 0xef, 0x8b, 0xd7, 0xa1, 0x89, 0xc5, 0x66, 0x2c,
-  0xba, 0x4b, 0xab, 0x0c, 0xa9, 0x56, 0x8f, 0xd9, 0xd6, 0x6f, 0x29, 0xda,
-  0xe5, 0x6b, 0x11, 0x29, 0xc6, 0x45, 0x03, 0x7c, 0x8f, 0xfd, 0x72, 0x31,
-  0x6b, 0x63, 0xc7, 0x48, 0xa1, 0xa8, 0x2b, 0x50, 0x04, 0xae, 0x74, 0x2d,
-  0x1f, 0x57, 0x5c, 0x91, 0x00, 0xfa, 0x70, 0x81, 0x4c, 0xc7, 0x15, 0x2e,
-  0xc1, 0xb3, 0x80, 0x05, 0xce, 0x3a, 0x1f, 0x15, 0x9b, 0x14, 0x17, 0x4f,
-  0xe0, 0x88, 0xa9, 0xba, 0xd3, 0x3d, 0xe9, 0x3b, 0xcb, 0x28, 0x36, 0x18,
-  0xa7, 0xec, 0xc4, 0xb5, 0x20, 0xb9, 0x9e, 0x1f, 0xd7, 0xf0, 0x63, 0x9d,
-  0xaa, 0xf0, 0x45, 0xef, 0xf2, 0x56, 0x25, 0x2c, 0xf0, 0x01, 0x8e, 0x43,
-  0x0c, 0xbc, 0x62, 0xd7, 0xc4, 0x52, 0x56, 0x9e, 0xa1, 0x48, 0x31, 0x00,
-  0x7f, 0x65, 0xf7, 0x9a, 0xa5, 0x46, 0x7d, 0x7a, 0xa4, 0x91, 0x13, 0x2a,
-  0x5c, 0x4f, 0x9f, 0x1e, 0x6a, 0xec, 0x46, 0x08, 0x56, 0x71, 0x72, 0x59,
-  0x67, 0x65, 0x72, 0x65, 0x0b, 0x9f, 0x79, 0x04, 0xe3, 0x2a, 0xf6, 0x5d,
-  0x91, 0x2c, 0xc5, 0x62, 0x2f, 0x24, 0x4b, 0x9e, 0x2e, 0x42, 0xb2, 0x1f,
-  0xd2, 0xf8, 0x9b, 0x8b, 0x0b, 0x39, 0xbe, 0x40, 0x7b, 0x3b, 0xa1, 0x45,
-  0x41, 0x58, 0x34, 0xa0, 0x02, 0x41, 0x62, 0xe5, 0xa9, 0x76, 0x52, 0xd2,
-  0x0b, 0x15, 0xb7, 0xc8, 0x5d, 0x8b, 0xc2, 0x4f, 0x74, 0x0f, 0xbb, 0x07,
-  0xce, 0xf1, 0xc5, 0x36, 0x7c, 0xbd, 0xc6, 0x24, 0x23, 0x37, 0xb3, 0x83,
-  0xeb, 0x56, 0xa9, 0x48, 0xf3, 0x80, 0x6a, 0xda, 0xbb, 0x58, 0x8c, 0xc4,
-  0x15, 0x39, 0xa2, 0x32, 0x89, 0xac, 0xe7, 0x26, 0x85, 0xaf, 0x55, 0xc8,
-  0x78, 0x1e, 0x19, 0x8d, 0xb8, 0x94, 0x2b, 0x91, 0x8c, 0xaa, 0x80, 0x49,
-  0x49, 0x43, 0x13, 0x58, 0x0d, 0xe9, 0x9c, 0xa5, 0x11, 0xa0, 0xbd, 0xf1,
-  0xba, 0x79, 0x5e, 0xcd, 0x85, 0x66, 0xf7, 0x47, 0x20, 0x92, 0xe3, 0xf7,
-  0xa8, 0x9b, 0xa1, 0x05, 0xd8, 0x8c, 0x71, 0x94, 0x6b, 0x36, 0x52, 0x61,
-  0x33, 0x77, 0x88, 0xcf, 0x84, 0xce, 0xaa, 0x1d, 0xcc, 0x19, 0x2b, 0x37,
-  0x09, 0x0b, 0x0f, 0x9b, 0xd1, 0x5b, 0xd9, 0xbf, 0x10, 0xdd, 0x64, 0x82,
-  0x69, 0x5f, 0x91, 0xcc, 0x3c, 0xc2, 0xc2, 0xfc, 0xfc, 0x14, 0xdc, 0x51,
-  0x9b, 0xf6, 0x16, 0xe6, 0x03, 0x90, 0xfb, 0xee, 0x32, 0x84, 0x67, 0x5a,
-  0xf3, 0x4d, 0xa3, 0xc4, 0x69, 0x5b, 0x30, 0xa9, 0x54, 0x87, 0x24, 0x88,
-  0x83, 0xb9, 0x2d, 0x9a, 0xc2, 0x5d, 0xc2, 0xba, 0x1a, 0x81, 0x9d, 0x9f,
-  0xea, 0x65, 0xba, 0xc4, 0x82, 0x12, 0x40, 0xfc, 0x4a, 0xac, 0x78, 0x7e,
-  0xc8, 0x4b, 0x7c, 0xb7, 0xc4, 0x82, 0xaa, 0x87, 0xc6, 0x47, 0x3e, 0x44,
-  0xb8, 0x58, 0xc1, 0xdb, 0x3f, 0x63, 0xba, 0x9f, 0xd4, 0xa1, 0x56, 0x2d,
-  0xc7, 0x0d, 0xbd, 0xd9, 0xb6, 0x5b, 0xef, 0x81, 0x96, 0xb9, 0x3f, 0xc5,
-  0xcf, 0x75, 0xdc, 0xc8, 0xaa, 0x5f, 0xc1, 0x62, 0x94, 0x02, 0x49, 0x13,
-  0xaa, 0x3c, 0x19, 0x4b, 0xbd, 0x66, 0xcc, 0x70, 0x2e, 0xe8, 0xda, 0x82,
-  0x08, 0xb1, 0xec, 0x08, 0xe5, 0x02, 0x48, 0x0a, 0x94, 0xbc, 0xc7, 0x95,
-  0xf8, 0x6d, 0xb8, 0x70, 0x1f, 0xe3, 0xb2, 0xac, 0x88, 0xc8, 0x06, 0xad,
-  0xe3, 0xb8, 0x76, 0xde, 0x0c, 0x45, 0x78, 0xcb, 0x96, 0x6f, 0x87, 0x47,
-  0xa1, 0xd9, 0x31, 0x7c, 0x8c, 0x44, 0x60, 0x42, 0xb7, 0x4c, 0xf3, 0x41,
-  0xcb, 0x77, 0x7a, 0xa1, 0xb4, 0x29, 0x76, 0x8a, 0xd7, 0x7b, 0x3f, 0x24,
-  0xa2, 0xdf, 0x8d, 0x0d, 0x33, 0x1f, 0x01, 0xae, 0x3f, 0xf9, 0x77, 0xaa,
-  0x9a, 0x27, 0xf8, 0x27, 0x56, 0x29, 0xe1, 0xfe, 0x16, 0x4d, 0xcf, 0xdf,
-  0x51, 0x0d, 0xd4, 0x36, 0xdf, 0xdc, 0x95, 0xee, 0x22, 0xb1, 0x43, 0xb6,
-  0x2c, 0xdb, 0xd7, 0x80, 0x35, 0xd9, 0xb9, 0x8d, 0xb9, 0x89, 0x0c, 0x22,
-  0xc6, 0x4d, 0xbe, 0x5b, 0x72, 0xe4, 0x0a, 0x92, 0xb8, 0xc3, 0xb8, 0x64,
-  0xe1, 0x1a, 0x2e, 0x74, 0x27, 0xa2, 0x3a, 0x3d, 0x78, 0x4f, 0xe9, 0xb4,
-  0xd3, 0xef, 0xb6, 0x30, 0xf7, 0xc5, 0xe2, 0x82, 0x1d, 0x04, 0xae, 0xbf,
-  0xb2, 0x56, 0xed, 0x6a, 0x66, 0x77, 0x50, 0x37, 0x00, 0x32, 0xe3, 0xde,
-  0xb3, 0x26, 0x6b, 0x7b, 0xad, 0xfe, 0x2a, 0x6e, 0xce, 0xf9, 0xb7, 0xbe,
-  0xed, 0xaf, 0x2f, 0xda, 0xae, 0xdd, 0x0a, 0x3d, 0xff, 0x90, 0xeb, 0x56,
-  0xca, 0xf2, 0xde, 0x9d, 0x72, 0x75, 0xce, 0x00, 0x83, 0xdb, 0xde, 0x22,
-  0x60, 0x78, 0x4b, 0x1d, 0x0a, 0xe2, 0x80, 0x5b, 0x76, 0x5e, 0xb2, 0x5a,
-  0x2b, 0x88, 0x2d, 0x6b, 0x2e, 0xe0, 0xb5, 0x3a, 0x99, 0x89, 0x97, 0x9d,
-  0x20, 0xac, 0xfb, 0xf6, 0x2a, 0xd8, 0xc2, 0x4a, 0x99, 0x97, 0xfc, 0xca,
-  0x55, 0x0d, 0x80, 0x40, 0x20, 0x81, 0x81, 0x2e, 0x07, 0x60, 0xc0, 0x4b,
-  0x71, 0x18, 0x09, 0xea, 0xcb, 0x76, 0xf8, 0x92, 0x6b, 0xe3, 0xdb, 0x9f,
-  0xad, 0x1f, 0x6b, 0x27, 0xd4, 0x93, 0x20, 0x59, 0xed, 0x76, 0x0a, 0x46,
-  0x85, 0x62, 0x9f, 0x41, 0x10, 0xbc, 0xe0, 0x3b, 0xfa, 0x09, 0x69, 0x4d,
-  0x6f, 0xc2, 0x35, 0xbd, 0x92, 0x62, 0xe4, 0x1a, 0x16, 0x5f, 0xf0, 0xb6,
-  0x4c, 0x72, 0x0d, 0xef, 0x32, 0xaf, 0xaf, 0x94, 0xab, 0x71, 0x26, 0xb8,
-  0xd8, 0x70, 0xcb, 0x6a, 0xb1, 0x04, 0x1e, 0x27, 0xe5, 0xab, 0xc7, 0x8b,
-  0xa4, 0x9b, 0x69, 0xdf, 0x3f, 0x61, 0x65, 0x54, 0xc4, 0x32, 0x9b, 0x65,
-  0x65, 0xda, 0x12, 0x55, 0x2e, 0xd8, 0x45, 0x9a, 0x7c, 0x18, 0x01, 0x9e,
-  0x43, 0x45, 0xf8, 0xd4, 0x51, 0x11, 0xc2, 0xe9, 0x69, 0x6e, 0x23, 0xf9,
-  0x92, 0xa4, 0xf6, 0x30, 0xfa, 0xc9, 0x39, 0xf5, 0x71, 0x89, 0xa8, 0xe6,
-  0xa5, 0x0d, 0xa3, 0x4c, 0x31, 0x28, 0x38, 0xcc, 0xd8, 0x50, 0xfc, 0x45,
-  0x59, 0xcb, 0x15, 0x9b, 0x27, 0xa9, 0xb4, 0x8a, 0x3e, 0x9e, 0x6c, 0xd3,
-  0x79, 0x5a, 0xb2, 0x7b, 0x9e, 0x7b, 0x27, 0x6a, 0x8a, 0x06, 0x0c, 0x6d,
-  0xdc, 0x23, 0xbe, 0xf3, 0x5f, 0x01, 0x1e, 0xfd, 0x29, 0xb1, 0xd0, 0xdf,
-  0xf0, 0x65, 0x6b, 0xc6, 0xd8, 0x4b, 0x83, 0xbd, 0x49, 0x90, 0xd1, 0xb8,
-  0xab, 0x6b, 0xc8, 0xc0, 0xa7, 0x8d, 0x32, 0xac, 0xe9, 0xee, 0xbd, 0xc1,
-  0x5b, 0x59, 0x66, 0xba, 0x9e, 0xd5, 0x4e, 0x43, 0x43, 0x7d, 0x47, 0xaa,
-  0x1d, 0x82, 0x92, 0x97, 0xa7, 0x80, 0xea, 0x60, 0x5a, 0x52, 0x59, 0xca,
-  0xc4, 0xc6, 0xf5, 0x70, 0xc5, 0xee, 0x56, 0x60, 0x6e, 0xd9, 0x03, 0xb6,
-  0xdb, 0x68, 0x12, 0xe2, 0xf7, 0xf5, 0xdf, 0x06, 0x5e, 0xb7, 0x52, 0xcd,
-  0x7b, 0x04, 0x02, 0x63, 0x0b, 0x9b, 0x9f, 0x33, 0x66, 0x5f, 0x50, 0x88,
-  0x3c, 0x60, 0xa7, 0xeb, 0x41, 0xc0, 0xfc, 0x32, 0x60, 0x6a, 0xb7, 0x59,
-  0x10, 0x1b, 0x78, 0x5a, 0xea, 0x16, 0xd8, 0x3e, 0x84, 0x6e, 0xb3, 0x10,
-  0x3a, 0x23, 0xa4, 0xea, 0x9c, 0x11, 0x4c, 0xc6, 0x33, 0x60, 0x5b, 0x73,
-  0xd3, 0x9e, 0xd7, 0xeb, 0xbb, 0x10, 0xac, 0x1f, 0x85, 0x29, 0x48, 0x25,
-  0x07, 0x1c, 0x0f, 0xe7, 0xe3, 0x55, 0x27, 0xa6, 0x56, 0x1b, 0x86, 0xe1,
-  0xb6, 0x2c, 0xa4, 0xa5, 0xed, 0xfb, 0x9e, 0x8f, 0x03, 0x8e, 0x87, 0x46,
-  0x17, 0x2a, 0xe5, 0x97, 0xe8, 0x3a, 0x32, 0x03, 0x50, 0x4c, 0xc6, 0x88,
-  0xe3, 0xa2, 0x06, 0xd5, 0x6a, 0x9e, 0xac, 0x92, 0x38, 0x69, 0x32, 0xc1,
-  0x0b, 0x47, 0x57, 0x52, 0xbe, 0x5f, 0x12, 0xa1, 0xf2, 0x2e, 0xed, 0x83,
-  0xc7, 0xf9, 0xf5, 0x76, 0x46, 0x72, 0xd2, 0x75, 0x69, 0x89, 0xec, 0x44,
-  0x9b, 0x59, 0x79, 0x51, 0x09, 0xa4, 0xf1, 0x0d, 0xf0, 0xc1, 0xe5, 0x25,
-  0xc5, 0x54, 0x57, 0x5b, 0x9c, 0x91, 0x68, 0x3e, 0xf0, 0x47, 0x65, 0x58,
-  0x5d, 0x6d, 0x59, 0xcc, 0x32, 0x64, 0x40, 0x1c, 0x3a, 0x81, 0x16, 0x40,
-  0xd8, 0x6a, 0x34, 0x01, 0xe9, 0x62, 0x01, 0xa5, 0x6f, 0xcc, 0xf9, 0x68,
-  0x5e, 0x53, 0x73, 0x14, 0x73, 0xf9, 0x29, 0x07, 0xa7, 0xc3, 0xf4, 0x9e,
-  0xb5, 0x1c, 0x37, 0x7b, 0xe6, 0x19, 0x36, 0xbc, 0x45, 0xdd, 0xb5, 0xbb,
-  0xcb, 0xe1, 0x0a, 0x5b, 0x60, 0x8d, 0xaa, 0x41, 0x2f, 0xb8, 0x61, 0x85,
-  0x67, 0xb2, 0x74, 0xd2, 0x00, 0xbd, 0xde, 0x78, 0x23, 0x2b, 0x9a, 0xf9,
-  0x96, 0x14, 0xeb, 0xd9, 0x55, 0x3e, 0xf9, 0x04, 0xd0, 0x00, 0x8b, 0x4a,
-  0xdc, 0xec, 0xf7, 0xbf, 0x67, 0xe5, 0xf2, 0x18, 0x70, 0x92, 0xe2, 0xb0,
-  0x0a, 0x2b, 0xbe, 0x3c, 0x36, 0x3c, 0xa3, 0x77, 0x10, 0x40, 0xa5, 0x7b,
-  0x08, 0x97, 0x52, 0x68, 0x59, 0xd0, 0x66, 0x7f, 0x35, 0x0e, 0x69, 0xd2,
-  0xfe, 0x15, 0xf2, 0x48, 0x5d, 0x8f, 0x35, 0x24, 0xb5, 0x32, 0x66, 0x02,
-  0x2a, 0xee, 0xed, 0x11, 0xb2, 0x28, 0x25, 0x99, 0x00, 0xf3, 0x5b, 0x7b,
-  0x84, 0x8b, 0x65, 0x19, 0x13, 0x50, 0xb8, 0x6e, 0x82, 0xb8, 0x31, 0xa1,
-  0x1b, 0x07, 0xdd, 0x58, 0xa1, 0xc3, 0x34, 0xf8, 0xbe, 0xbc, 0x54, 0xfd,
-  0x44, 0x61, 0x41, 0x3e, 0x24, 0xf3, 0x4a, 0xd3, 0x12, 0x7e, 0xdf, 0x84,
-  0xf0, 0x48, 0x99, 0x1e, 0x06, 0x36, 0x6d, 0x13, 0x83, 0xce, 0x8c, 0xde,
-  0x30, 0xf7, 0x28, 0xd6, 0xbf, 0x94, 0x56, 0xcb, 0xed, 0x3f, 0x9b, 0x82,
-  0x43, 0x3c, 0x1a, 0x05, 0x47, 0x28, 0x65, 0xa1, 0x46, 0xf7, 0x90, 0xb4,
-  0xd5, 0x7a, 0x30, 0xec, 0x19, 0xc3, 0x61, 0xdf, 0x4c, 0xb3, 0xba, 0xe9,
-  0xca, 0x77, 0x9c, 0xb6, 0xdf, 0x17, 0xfb, 0xca, 0xc1, 0xeb, 0x6c, 0x99,
-  0xfc, 0xd1, 0x23, 0xd5, 0x1b, 0x6d, 0xd7, 0x19, 0x25, 0xc7, 0xef, 0xc1,
-  0xef, 0x56, 0xba, 0xe2, 0x9f, 0xaf, 0x10, 0x3d, 0x15, 0xa7, 0xdb, 0x4e,
-  0x21, 0xb0, 0x5f, 0x9c, 0x7c, 0xe5, 0xe5, 0x7a, 0xd6, 0x79, 0x99, 0x12,
-  0x71, 0x3d, 0x0b, 0xcf, 0x86, 0xe2, 0x39, 0x37, 0x63, 0x0c, 0x7b, 0xda,
-  0x5e, 0xc7, 0x98, 0x01, 0xdb, 0xd5, 0x21, 0xaa, 0x74, 0x42, 0x98, 0x62,
-  0xe9, 0xb3, 0x11, 0x9c, 0x7f, 0xb6, 0xfa, 0x3e, 0x9e, 0x47, 0x91, 0xa1,
-  0x9b, 0x26, 0x08, 0x30, 0x75, 0x62, 0x15, 0x6c, 0xef, 0x40, 0xcb, 0xc6,
-  0x1c, 0xbc, 0xcc, 0x53, 0x17, 0xb1, 0xd9, 0xaf, 0xe1, 0x42, 0x7c, 0xe7,
-  0xd9, 0x67, 0x4d, 0xb6, 0x1f, 0xdd, 0xcb, 0x3e, 0xd1, 0xcf, 0xeb, 0xf8,
-  0xd0, 0xeb, 0xce, 0x1b, 0x6f, 0x54, 0xf3, 0x82, 0x27, 0xad, 0x9d, 0x98,
-  0x11, 0x67, 0x62, 0x95, 0x89, 0x9c, 0x07, 0xa1, 0xbd, 0x0e, 0x62, 0xd8,
-  0xbe, 0xc4, 0x8c, 0x1f, 0x44, 0x82, 0xb1, 0x66, 0xb3, 0xc9, 0x4c, 0xd9,
-  0x61, 0x94, 0x1c, 0x43, 0x03, 0x49, 0x0a, 0x0d, 0xa3, 0x8a, 0xe5, 0xb2,
-  0x87, 0xe7, 0x81, 0x1d, 0x85, 0x60, 0x29, 0xac, 0x70, 0xbe, 0x0d, 0xb5,
-  0x3b, 0xca, 0x20, 0x34, 0x4a, 0x13, 0x55, 0x08, 0x46, 0x76, 0xba, 0x9d,
-  0x04, 0x9e, 0xaf, 0x92, 0xd4, 0xb4, 0x35, 0xb6, 0x62, 0x6c, 0xa6, 0x5e,
-  0x19, 0x15, 0x18, 0xa4, 0xe3, 0x5d, 0x25, 0x4b, 0x6a, 0x18, 0xe1, 0xf0,
-  0xd0, 0x72, 0x23, 0x2f, 0x06, 0x94, 0xe6, 0x2a, 0xa8, 0x0f, 0x22, 0x15,
-  0xa4, 0x55, 0x53, 0xe8, 0x9e, 0xba, 0x4b, 0x01, 0x0c, 0x6c, 0xb2, 0x6e,
-  0x06, 0x3e, 0x23, 0x5a, 0x35, 0xaa, 0x78, 0x5c, 0x82, 0x47, 0xc0, 0xfe,
-  0xe6, 0x69, 0x50, 0x8a, 0xa0, 0x39, 0xd5, 0x91, 0xae, 0xc9, 0x1e, 0x36,
-  0xef, 0x93, 0x9a, 0x95, 0xc7, 0x0c, 0xaa, 0x10, 0xd3, 0xfc, 0xe0, 0x68,
-  0xf5, 0x48, 0x37, 0x78, 0xd5, 0x77, 0xa1, 0xef, 0x53, 0x2b, 0x61, 0xd8,
-  0x9b, 0x9d, 0x9a, 0x7a, 0xfa, 0x9c, 0x01, 0xc0, 0x06, 0xb0, 0xb7, 0x65,
-  0xb9, 0xa7, 0xb2, 0x3a, 0x61, 0xb0, 0x5a, 0xb8, 0xae, 0x36, 0xa1, 0xcc,
-  0xe0, 0x2d, 0xcc, 0x0e, 0xd1, 0xcc, 0x6c, 0xf0, 0x8e, 0x34, 0xab, 0x92,
-  0x31, 0x96, 0x46, 0x97, 0xa7, 0xa1, 0x52, 0x93, 0x3a, 0x26, 0x13, 0x01,
-  0x61, 0x81, 0xfa, 0xdc, 0xc8, 0xf6, 0x4e, 0xb7, 0x6b, 0xfb, 0x27, 0xed,
-  0xb3, 0xe1, 0xb0, 0x87, 0x36, 0x58, 0x31, 0xf9, 0xb9, 0x46, 0x79, 0x2e,
-  0xb1, 0x19, 0xed, 0x6d, 0x45, 0x98, 0x28, 0xf3, 0x5a, 0x3c, 0x29, 0x87,
-  0x79, 0x6f, 0xb4, 0xcd, 0x0f, 0x29, 0x77, 0x96, 0x64, 0xbd, 0x27, 0x32,
-  0x29, 0x33, 0xa5, 0x22, 0x91, 0x6c, 0x43, 0xd1, 0x52, 0x2e, 0x86, 0x20,
-  0x5e, 0x58, 0x53, 0xa4, 0x70, 0xdc, 0x50, 0x26, 0x2f, 0x8e, 0xe6, 0x03,
-  0xb5, 0xff, 0x54, 0x23, 0x8a, 0xad, 0xe5, 0x98, 0x50, 0x85, 0x49, 0x84,
-  0x0b, 0xcd, 0xa2, 0x01, 0x47, 0x3d, 0xf4, 0x1d, 0x65, 0xea, 0x88, 0xa8,
-  0xc6, 0x40, 0x50, 0xf9, 0x33, 0x8a, 0x6f, 0xb9, 0xb6, 0x0f, 0x4e, 0x25,
-  0xba, 0x89, 0xbb, 0xfd, 0x40, 0xea, 0x1e, 0x44, 0x9b, 0xb8, 0xc7, 0xb4,
-  0xd0, 0x12, 0x0e, 0xb1, 0x11, 0x8e, 0x6f, 0x9a, 0xa1, 0xc9, 0xdf, 0x5d,
-  0xca, 0x10, 0x5f, 0xc6, 0x6c, 0xfc, 0x5b, 0xd4, 0xfc, 0x52, 0xf4, 0x28,
-  0xe3, 0xaf, 0x46, 0x8f, 0x85, 0xf6, 0x3f, 0x55, 0x70, 0xef, 0x2c, 0x51,
-  0xf4, 0x26, 0x84, 0x6e, 0x1f, 0xd0, 0x0e, 0xb8, 0xff, 0x85, 0xdf, 0x6b,
-  0xd1, 0x27, 0x60, 0x74, 0x70, 0x1b, 0x09, 0xc4, 0x34, 0x77, 0x14, 0xc8,
-  0xbe, 0x1d, 0xc2, 0x3c, 0xcd, 0x14, 0x13, 0x98, 0xc3, 0xb0, 0xa6, 0x20,
-  0xb0, 0xe4, 0x25, 0x39, 0xdd, 0xa5, 0x78, 0xaa, 0x39, 0x4e, 0x64, 0x66,
-  0xa4, 0x7f, 0xda, 0x6c, 0xc8, 0xec, 0xca, 0xdc, 0x70, 0x9e, 0x1d, 0x34,
-  0xe9, 0xaf, 0x99, 0x69, 0x85, 0x56, 0x9c, 0xd0, 0x47, 0x90, 0xd0, 0x6f,
-  0x78, 0x8d, 0xfb, 0x02, 0xed, 0x0e, 0xc3, 0x24, 0xcf, 0x37, 0x62, 0x91,
-  0x67, 0xcc, 0x53, 0xda, 0xac, 0x0c, 0x6f, 0x0f, 0x32, 0x51, 0xd6, 0xdc,
-  0x8a, 0x8b, 0x17, 0x19, 0x86, 0x16, 0x0f, 0x5f, 0x13, 0xc6, 0x8e, 0xcb,
-  0xd9, 0xe2, 0x5d, 0x04, 0x94, 0x8e, 0x96, 0xfa, 0xf8, 0x22, 0xfa, 0x08,
-  0x20, 0xdf, 0x88, 0xbe, 0xe4, 0xf0, 0x3f, 0x83, 0x97, 0x8f, 0xf1, 0x7c,
-  0xbd, 0x0c, 0x7c, 0x5d, 0x7a, 0xf2, 0xce, 0x24, 0xc8, 0x8f, 0xbd, 0x9b,
-  0x92, 0xe0, 0x08, 0x99, 0xda, 0x60, 0xb6, 0x1b, 0xd8, 0x7b, 0x33, 0x12,
-  0xd2, 0x26, 0x02, 0xa3, 0x65, 0x18, 0x65, 0x17, 0x46, 0x5a, 0x85, 0xb1,
-  0x6c, 0xc2, 0x88, 0xe5, 0xef, 0xdf, 0x87, 0x31, 0xf8, 0x21, 0x4c, 0x41,
-  0x36, 0x6f, 0x51, 0x17, 0xb4, 0xc5, 0x97, 0x5c, 0xcb, 0x50, 0xc4, 0x2e,
-  0x14, 0xb2, 0x0a, 0x05, 0x6d, 0xc2, 0x13, 0x5b, 0x04, 0x5a, 0x4d, 0xf5,
-  0x0f, 0xd3, 0xfe, 0xef, 0x5d, 0xf7, 0xff, 0x11, 0x9a, 0x6f, 0x10, 0x1d,
-  0x49, 0x3c, 0xe2, 0xb7, 0x19, 0x11, 0x92, 0x13, 0x47, 0x7b, 0xaf, 0x4c,
-  0x8c, 0xc6, 0x45, 0xed, 0x47, 0xfa, 0x24, 0x61, 0x84, 0x22, 0x26, 0xdd,
-  0x31, 0x87, 0xd4, 0x41, 0x01, 0x6c, 0xf5, 0x34, 0x55, 0x46, 0xe6, 0x75,
-  0x70, 0x71, 0x96, 0xa9, 0x39, 0x66, 0xaa, 0x6a, 0x24, 0x60, 0x91, 0x65,
-  0x6a, 0x8e, 0x97, 0xa8, 0x4a, 0xc0, 0x1a, 0x12, 0x27, 0x37, 0xe0, 0xf7,
-  0x7f, 0xf8, 0xe1, 0xbc, 0xf0, 0x73, 0x95, 0x9f, 0xc6, 0x4a, 0xdb, 0xf1,
-  0xe9, 0x88, 0x86, 0xff, 0x86, 0xd7, 0x2f, 0x93, 0x73, 0x5a, 0x6f, 0x81,
-  0x0c, 0xdf, 0xa0, 0x33, 0x5a, 0x8f, 0x9d, 0xc8, 0x68, 0x73, 0x4a, 0x49,
-  0xa3, 0xe1, 0x1d, 0xa6, 0xc9, 0xa8, 0x7e, 0xdb, 0xea, 0x5e, 0x8b, 0x3d,
-  0x9a, 0xdc, 0xa2, 0xe9, 0xc6, 0x58, 0x61, 0xc7, 0x54, 0x17, 0x75, 0xac,
-  0x09, 0x9b, 0xf7, 0x38, 0xe0, 0x78, 0x27, 0xc1, 0xf7, 0x37, 0xd6, 0x54,
-  0xbe, 0xbe, 0x93, 0x01, 0xc7, 0xe2, 0xb7, 0xd7, 0xf1, 0xe6, 0x6d, 0x10,
-  0xf8, 0xfe, 0x08, 0x90, 0x28, 0xc2, 0x98, 0xe3, 0x9f, 0xc8, 0x2f, 0x73,
-  0x19, 0xbd, 0x6a, 0x6a, 0x45, 0x82, 0xc4, 0x10, 0xed, 0x05, 0x44, 0x6a,
-  0x39, 0x94, 0xcf, 0x7b, 0x03, 0x96, 0x58, 0x0b, 0xf9, 0xe3, 0xde, 0x40,
-  0x61, 0x26, 0xba, 0x39, 0x46, 0x1a, 0x3b, 0x63, 0xc9, 0x36, 0x26, 0x24,
-  0xc2, 0xc6, 0xa5, 0xe0, 0xe4, 0x0c, 0x92, 0xad, 0x6c, 0xd0, 0xf8, 0x58,
-  0x24, 0xae, 0xf9, 0xa9, 0x4c, 0x9b, 0x93, 0x7c, 0x7d, 0x52, 0x92, 0xe7,
-  0x8d, 0xb3, 0xdc, 0x69, 0x4d, 0x78, 0x3b, 0x59, 0x43, 0xc2, 0x2d, 0x26,
-  0x2e, 0x76, 0x3c, 0x42, 0x55, 0x50, 0xd6, 0xb5, 0xd7, 0xd8, 0x51, 0xf1,
-  0x31, 0x46, 0x2a, 0xbe, 0x5d, 0xb7, 0x7a, 0x3d, 0xbb, 0xdb, 0xae, 0x94,
-  0xb0, 0x76, 0x99, 0x6c, 0x29, 0x98, 0x64, 0xbf, 0x5c, 0x3c, 0xfe, 0x2b,
-  0x18, 0xbc, 0x0f, 0x1f, 0x9d, 0xce, 0xba, 0x96, 0x27, 0xa9, 0xc6, 0xc6,
-  0x54, 0xc9, 0x67, 0xfd, 0x8b, 0xe5, 0x3a, 0x6d, 0x8b, 0x57, 0xf3, 0xc0,
-  0x41, 0xda, 0xed, 0x3a, 0x5b, 0x04, 0xd0, 0x58, 0x78, 0x8c, 0x7b, 0xc7,
-  0x93, 0x41, 0x78, 0x69, 0xb5, 0xce, 0x4e, 0x58, 0x78, 0xce, 0x48, 0x68,
-  0xfb, 0x4c, 0xed, 0x9b, 0x89, 0x13, 0x0a, 0x28, 0x13, 0x56, 0x0c, 0x8d,
-  0xb8, 0x9e, 0x2c, 0xcf, 0xfe, 0xe1, 0xe1, 0x54, 0x41, 0xa1, 0x9f, 0x15,
-  0xaf, 0x3d, 0xcb, 0xca, 0x27, 0x8e, 0x2f, 0x9e, 0x2c, 0x4f, 0x2a, 0xe7,
-  0xe5, 0xcf, 0x26, 0xb4, 0x98, 0x90, 0x6a, 0xac, 0x05, 0x2b, 0xcf, 0x79,
-  0xd5, 0x66, 0x34, 0x1a, 0x78, 0x55, 0x9c, 0xc4, 0xc7, 0x6d, 0x86, 0x58,
-  0x24, 0x9e, 0x1b, 0x94, 0x1b, 0x76, 0x89, 0x68, 0x59, 0x92, 0xc1, 0xa5,
-  0x7d, 0xba, 0x15, 0x00, 0x61, 0x4a, 0x3a, 0x5b, 0x05, 0xe8, 0xd6, 0xb2,
-  0x8d, 0xb5, 0x40, 0xf9, 0x73, 0xdd, 0xe9, 0xb6, 0xdc, 0x7e, 0xdb, 0x0e,
-  0x2a, 0x65, 0xdf, 0x5e, 0xf2, 0x3c, 0xa4, 0x4f, 0xb9, 0x8a, 0x58, 0xc0,
-  0xc3, 0xfa, 0xbf, 0xc0, 0x0e, 0x4f, 0x3a, 0xab, 0xb6, 0xd7, 0x0f, 0x2b,
-  0x95, 0x2a, 0x0e, 0x6a, 0xcd, 0xe9, 0xb6, 0xbd, 0x35, 0xca, 0x69, 0x21,
-  0x6f, 0xeb, 0xbe, 0x8d, 0xe5, 0xe4, 0x4a, 0x75, 0x72, 0x7f, 0xa3, 0xd1,
-  0x00, 0x64, 0x34, 0x18, 0x52, 0x70, 0xa5, 0xcf, 0x8f, 0x72, 0x4c, 0xa4,
-  0x31, 0x17, 0x04, 0xbc, 0x62, 0xcf, 0x2a, 0xa3, 0xc8, 0x6a, 0x93, 0x60,
-  0x41, 0x91, 0x0a, 0x38, 0x48, 0x46, 0x6e, 0x01, 0x3c, 0x35, 0x77, 0x5a,
-  0x3a, 0xf2, 0x65, 0xe7, 0x8c, 0xcd, 0x75, 0x26, 0x3e, 0x05, 0x27, 0x5d,
-  0xb7, 0x10, 0xdf, 0x93, 0x16, 0x2d, 0x64, 0x45, 0x26, 0x1b, 0xf3, 0xef,
-  0x4b, 0xa4, 0xc8, 0x33, 0xa6, 0xef, 0xc2, 0x15, 0xdf, 0x5b, 0x23, 0x85,
-  0x25, 0xbc, 0x2b, 0xa7, 0x7e, 0x71, 0xf2, 0xe4, 0x09, 0x8e, 0xea, 0x3e,
-  0xc6, 0x65, 0x69, 0x96, 0x3d, 0x7d, 0x2e, 0x81, 0xc2, 0x2f, 0x6d, 0x9c,
-  0xaa, 0x0e, 0xf3, 0x60, 0xdc, 0xc6, 0xeb, 0x02, 0x2c, 0x91, 0x53, 0x1f,
-  0x83, 0x79, 0xf5, 0xc4, 0xf0, 0x24, 0x72, 0xb1, 0x74, 0xac, 0x58, 0x47,
-  0xc3, 0x4f, 0xbf, 0x6b, 0x66, 0xcb, 0x59, 0xf9, 0x26, 0x56, 0x5e, 0x54,
-  0x0f, 0x70, 0xe4, 0x3c, 0xe5, 0x29, 0xf3, 0x8a, 0xfa, 0xa7, 0xcf, 0x91,
-  0xf8, 0x88, 0x3c, 0x3d, 0x3c, 0x1a, 0x5a, 0xdd, 0x16, 0x98, 0x66, 0xef,
-  0x28, 0x9e, 0x1a, 0x57, 0x99, 0xae, 0x6e, 0xd0, 0xd2, 0x6c, 0x2d, 0x4f,
-  0xcb, 0x47, 0x79, 0x98, 0x57, 0x0e, 0x16, 0x89, 0xbc, 0x15, 0x6d, 0x0d,
-  0x88, 0x4c, 0x2f, 0x4d, 0xf8, 0x88, 0x62, 0x86, 0xf8, 0x75, 0x75, 0xfc,
-  0xbc, 0xb5, 0x7a, 0xa8, 0xa4, 0x29, 0x3f, 0x5b, 0xc6, 0xf5, 0xd6, 0x74,
-  0x72, 0xdf, 0x4e, 0xac, 0x38, 0x34, 0x79, 0x67, 0x22, 0x68, 0x38, 0x2f,
-  0xd7, 0xc2, 0xe8, 0xc4, 0x3f, 0x72, 0x22, 0x98, 0x5d, 0x46, 0x22, 0xed,
-  0x6a, 0x65, 0xca, 0x55, 0x2d, 0x67, 0x5c, 0x7e, 0xaa, 0x3c, 0x27, 0xc2,
-  0xe4, 0xbb, 0x74, 0x90, 0xd8, 0x66, 0x26, 0x5d, 0x6d, 0x7e, 0x5e, 0xe3,
-  0xb1, 0x6f, 0xb7, 0x05, 0xa0, 0x8f, 0x68, 0x41, 0xb3, 0x00, 0x93, 0x54,
-  0x0c, 0xc4, 0x01, 0x72, 0xb8, 0x86, 0x04, 0xe3, 0x1c, 0x89, 0xcc, 0xb2,
-  0x6e, 0xea, 0xca, 0x69, 0xe0, 0x50, 0xee, 0x0c, 0x27, 0xd9, 0x39, 0x32,
-  0xca, 0x89, 0x27, 0x0d, 0x73, 0xd6, 0x49, 0x86, 0xdd, 0xe3, 0xdd, 0x61,
-  0x30, 0x92, 0x9d, 0x3f, 0xf9, 0xcf, 0x77, 0x3a, 0x45, 0x00, 0x74, 0x3a,
-  0x19, 0x11, 0xc0, 0xda, 0x1e, 0xc7, 0x31, 0x66, 0xbf, 0xc6, 0xbf, 0xc4,
-  0x0d, 0x38, 0x01, 0x19, 0x0f, 0xda, 0xff, 0x63, 0x32, 0x32, 0x2a, 0x14,
-  0x98, 0xd4, 0xfc, 0x15, 0xa6, 0x39, 0xef, 0xc3, 0x04, 0xfa, 0xea, 0x2c,
-  0xf2, 0x08, 0xd3, 0x05, 0x17, 0xf9, 0x42, 0xf8, 0x2d, 0x1e, 0x99, 0xa2,
-  0x80, 0x61, 0x81, 0x7d, 0x93, 0xf6, 0x8c, 0x43, 0x38, 0xb2, 0xcf, 0x50,
-  0xe4, 0x57, 0xe8, 0x67, 0x94, 0x01, 0xd5, 0x44, 0x99, 0xbc, 0xc3, 0x48,
-  0x38, 0xe2, 0xc4, 0xd5, 0xdc, 0xee, 0x69, 0x50, 0xcf, 0x36, 0x85, 0xe3,
-  0x48, 0xb6, 0x23, 0xfd, 0xa6, 0x07, 0x44, 0xc5, 0x75, 0x3a, 0xd1, 0x6d,
-  0xd0, 0x8d, 0x8b, 0x54, 0x80, 0xb9, 0x2f, 0xa5, 0xe4, 0x68, 0xe1, 0x0e,
-  0xcc, 0xf7, 0xb6, 0xf8, 0x59, 0x83, 0x86, 0x9d, 0xf0, 0x52, 0xdb, 0x51,
-  0x7d, 0x97, 0xd9, 0xef, 0x59, 0x31, 0x04, 0x7b, 0xf1, 0x2e, 0x2d, 0x42,
-  0xed, 0xd3, 0x78, 0x3d, 0x3a, 0xce, 0x41, 0x3f, 0x8e, 0x6e, 0x70, 0xa4,
-  0x94, 0xab, 0x5f, 0xd0, 0xf5, 0x61, 0xb6, 0x5e, 0xa5, 0x9e, 0x6c, 0x2d,
-  0xd2, 0xfe, 0x25, 0xc1, 0x32, 0xe9, 0x97, 0xb2, 0x7d, 0xcc, 0x09, 0x8e,
-  0x77, 0xcd, 0xcb, 0xf7, 0x4e, 0x4d, 0x89, 0x86, 0x3f, 0x41, 0xc8, 0x76,
-  0xf3, 0xe9, 0x73, 0xd8, 0x16, 0x47, 0xe2, 0x75, 0x09, 0x75, 0x0f, 0x84,
-  0x18, 0x3c, 0xd3, 0x0f, 0xb5, 0xa8, 0x4f, 0x0f, 0xb9, 0xf6, 0x0d, 0x0b,
-  0xb9, 0xcc, 0xe1, 0xd7, 0x36, 0x3f, 0x99, 0x1e, 0x83, 0x71, 0xcc, 0xab,
-  0x5f, 0xa6, 0x25, 0x00, 0x22, 0x65, 0xb6, 0x23, 0xce, 0x49, 0x10, 0xe7,
-  0x86, 0x25, 0x7e, 0x46, 0xd9, 0xec, 0x33, 0x34, 0x6a, 0x19, 0x5e, 0x1d,
-  0x4f, 0x7d, 0x4f, 0x1a, 0x76, 0x7c, 0x77, 0x2b, 0x00, 0x45, 0xe0, 0xc3,
-  0x48, 0x0f, 0x88, 0x5f, 0x39, 0x6b, 0x00, 0x33, 0x95, 0xd2, 0x44, 0x2c,
-  0x32, 0x3b, 0xfc, 0x72, 0x16, 0x75, 0x6a, 0xed, 0xca, 0xff, 0xaf, 0x05,
-  0x00, 0x98, 0x7a, 0x97, 0x9f, 0x15, 0x17, 0x0b, 0x40, 0x62, 0x07, 0xfe,
-  0x69, 0x79, 0x4d, 0x0c, 0x20, 0x6e, 0x73, 0x03, 0x88, 0x87, 0xd0, 0xe6,
-  0xb3, 0x7b, 0x22, 0x9e, 0x8d, 0xde, 0xa2, 0x33, 0xda, 0xae, 0x89, 0x6f,
-  0xac, 0xc2, 0x43, 0x49, 0xaf, 0xb1, 0xe8, 0x3a, 0x66, 0x6e, 0x3f, 0x87,
-  0x4f, 0x1f, 0x53, 0x2e, 0xec, 0x3a, 0x26, 0x31, 0x6e, 0x52, 0x6a, 0xec,
-  0x46, 0xf4, 0x37, 0x3a, 0xfe, 0xed, 0x43, 0xdc, 0xa1, 0x83, 0xb9, 0xdd,
-  0x4f, 0xa3, 0xab, 0x34, 0x05, 0x15, 0x01, 0x0f, 0x1d, 0x94, 0x37, 0xc4,
-  0xd3, 0xa5, 0x5b, 0xb7, 0xd0, 0xd3, 0xf1, 0x87, 0xe4, 0xbd, 0x40, 0x23,
-  0x9f, 0x3d, 0x9c, 0xee, 0x68, 0x10, 0x9e, 0x5e, 0xdd, 0x49, 0x32, 0xd4,
-  0xd7, 0xab, 0x4d, 0xc9, 0xd7, 0xa2, 0x7f, 0x0d, 0xad, 0xde, 0x61, 0xaf,
-  0x4f, 0x9d, 0x37, 0xe6, 0xe2, 0x2b, 0x62, 0x3a, 0x04, 0x4d, 0x12, 0x5d,
-  0x58, 0xb1, 0xba, 0x6d, 0x97, 0xef, 0x71, 0x3a, 0x8c, 0x9b, 0x9e, 0x2a,
-  0xb4, 0x6d, 0x20, 0x96, 0x31, 0x14, 0x44, 0x79, 0x1f, 0x01, 0xcd, 0xfe,
-  0x88, 0x20, 0xb2, 0x14, 0xca, 0xdb, 0xa4, 0xd2, 0xb3, 0xfc, 0xd2, 0x3e,
-  0xa4, 0xb3, 0xef, 0xe2, 0x73, 0x1b, 0xf1, 0x53, 0x66, 0x25, 0x7a, 0x19,
-  0xbf, 0x20, 0x41, 0xf8, 0x04, 0xde, 0xc2, 0x6a, 0xb7, 0x5f, 0xc2, 0xee,
-  0x71, 0xe7, 0x82, 0x0d, 0x0e, 0x80, 0xf6, 0x04, 0xb4, 0x4e, 0x83, 0x04,
-  0xe8, 0x78, 0x8b, 0x8e, 0xf9, 0x09, 0x8b, 0xca, 0xd8, 0x49, 0x2f, 0x24,
-  0x32, 0x67, 0xbb, 0x95, 0x77, 0x0c, 0x60, 0x70, 0x77, 0x87, 0x34, 0x65,
-  0x93, 0x82, 0xc3, 0xe4, 0x8c, 0x69, 0x7d, 0x8f, 0xa4, 0xb4, 0x6d, 0x88,
-  0x96, 0x0e, 0x63, 0x06, 0x84, 0x3c, 0x32, 0x5c, 0x9d, 0x64, 0xc9, 0x11,
-  0xca, 0xd9, 0x33, 0x6a, 0xc4, 0xc1, 0x84, 0xb4, 0xc5, 0x92, 0xfa, 0xc1,
-  0x6d, 0x96, 0xe2, 0x78, 0xd4, 0x78, 0xe2, 0xb8, 0x3d, 0xc9, 0x68, 0x93,
-  0x1c, 0x0f, 0x5a, 0xe4, 0x1d, 0x4b, 0x3b, 0xd1, 0xc3, 0x09, 0x3e, 0xb9,
-  0x55, 0xf8, 0x9e, 0xac, 0x48, 0xc3, 0x50, 0x4a, 0xa6, 0xbd, 0xcc, 0x9b,
-  0xe1, 0xc4, 0x97, 0x16, 0xfc, 0xf3, 0x16, 0x7c, 0x97, 0x4a, 0x71, 0xfa,
-  0xe3, 0xe1, 0x95, 0x42, 0x03, 0x6f, 0x90, 0x3a, 0x5d, 0xc7, 0x40, 0x0c,
-  0xc9, 0x89, 0x25, 0x0d, 0x54, 0xc8, 0xcf, 0x52, 0x3d, 0xc3, 0x8f, 0xff,
-  0x09, 0x2d, 0x3e, 0xc1, 0x16, 0xd7, 0x71, 0xdd, 0xe3, 0x55, 0xb8, 0x71,
-  0x1b, 0x34, 0xf4, 0x4f, 0xf1, 0xd7, 0x85, 0x11, 0x38, 0xda, 0x98, 0x76,
-  0x57, 0x4d, 0x15, 0xed, 0x0a, 0xba, 0xf1, 0x6d, 0x06, 0x17, 0xa5, 0x9d,
-  0x8e, 0xa9, 0x93, 0x33, 0xb0, 0x89, 0xef, 0x6a, 0xc5, 0x87, 0xce, 0xd3,
-  0x72, 0x3a, 0x1e, 0x0b, 0x3e, 0xa4, 0x65, 0xdd, 0xdb, 0xd5, 0x09, 0x9d,
-  0xa2, 0x06, 0xd9, 0xa3, 0xe5, 0x73, 0x78, 0x00, 0x9b, 0xa0, 0xae, 0xaa,
-  0x2c, 0x22, 0x5b, 0x05, 0x00, 0x80, 0x9c, 0xca, 0xee, 0x1b, 0xbc, 0x96,
-  0x2e, 0x36, 0xa6, 0xd9, 0x33, 0x5e, 0xd2, 0x97, 0x65, 0xdc, 0xca, 0x13,
-  0x15, 0x3c, 0xd8, 0xfc, 0x1b, 0x12, 0x94, 0x12, 0x1e, 0x5b, 0x2d, 0x86,
-  0xb8, 0x59, 0xca, 0x0e, 0x63, 0xc2, 0x94, 0x0d, 0xdd, 0xc8, 0xa6, 0xb8,
-  0x4a, 0x60, 0x0c, 0x89, 0x2e, 0xb2, 0x1c, 0x7e, 0x3b, 0x5b, 0x9a, 0x24,
-  0xfc, 0xeb, 0x78, 0x32, 0x9b, 0xac, 0x51, 0x88, 0xdd, 0xa7, 0x24, 0xfe,
-  0xb4, 0x08, 0x26, 0x3d, 0x75, 0x7d, 0x17, 0x0f, 0xec, 0xc6, 0x79, 0x54,
-  0x66, 0x5f, 0xdd, 0x04, 0x77, 0x0d, 0x98, 0x61, 0x41, 0x9a, 0x56, 0x68,
-  0xc0, 0x20, 0x24, 0x68, 0xa0, 0x14, 0x75, 0xcc, 0xd7, 0x71, 0x33, 0x99,
-  0x75, 0x9b, 0x04, 0x2f, 0xcb, 0xb8, 0x2d, 0x8a, 0x67, 0xa6, 0x0e, 0x81,
-  0x7f, 0x8c, 0xc7, 0xae, 0x18, 0x83, 0x67, 0x9f, 0x15, 0xe7, 0xc3, 0xba,
-  0xb6, 0xe5, 0xc7, 0x79, 0xa1, 0xd4, 0x26, 0x56, 0xa5, 0x65, 0x33, 0x89,
-  0xfd, 0x58, 0x68, 0xb2, 0x19, 0xc5, 0xd0, 0xc9, 0x14, 0x5c, 0x24, 0x79,
-  0x11, 0x43, 0x24, 0xcf, 0xc4, 0x8f, 0x81, 0xc4, 0x95, 0x70, 0xfb, 0x4a,
-  0x92, 0x6f, 0x52, 0xcc, 0x51, 0xae, 0x81, 0x81, 0x0f, 0x17, 0x69, 0xc1,
-  0x26, 0xc9, 0xb3, 0x79, 0x9d, 0xe8, 0x1d, 0x71, 0xb4, 0xf6, 0xe7, 0xe8,
-  0xa7, 0x3e, 0x23, 0xa5, 0xfa, 0x82, 0xaa, 0x3c, 0x54, 0x3a, 0xfc, 0x08,
-  0xd4, 0xe9, 0x2a, 0x57, 0x3d, 0x1e, 0x61, 0xbf, 0x0f, 0x6f, 0x6f, 0xa3,
-  0x7e, 0xfd, 0x05, 0xae, 0xff, 0x19, 0xee, 0x5c, 0x9d, 0x48, 0x73, 0x63,
-  0xaa, 0xb0, 0x13, 0xc9, 0x13, 0xeb, 0xad, 0x4f, 0x68, 0x52, 0x32, 0x61,
-  0xf4, 0xad, 0xa7, 0xd5, 0xce, 0x69, 0x23, 0xdc, 0x98, 0x64, 0x22, 0xa1,
-  0x26, 0x5c, 0x01, 0xd2, 0x36, 0xd9, 0x34, 0x24, 0xf9, 0xe0, 0x2f, 0xb3,
-  0x6a, 0x5f, 0x51, 0x8f, 0x84, 0x7e, 0x2c, 0x0e, 0xfd, 0xe6, 0x3b, 0xd6,
-  0x69, 0x61, 0xec, 0xdb, 0xb1, 0xdc, 0xe2, 0x46, 0x44, 0xd0, 0x7b, 0x2c,
-  0x1e, 0x7f, 0x45, 0xc7, 0xed, 0xd3, 0x1a, 0x04, 0x3a, 0x00, 0x77, 0x42,
-  0x9a, 0x61, 0xab, 0x02, 0xa8, 0xaa, 0xea, 0x78, 0x89, 0xe5, 0x32, 0x42,
-  0x28, 0x73, 0x0d, 0x31, 0xa5, 0x8d, 0x4b, 0xd2, 0xc6, 0xa5, 0x7b, 0x3c,
-  0x1d, 0x98, 0x18, 0x1f, 0x93, 0x66, 0xf1, 0x60, 0xed, 0xd4, 0x90, 0xa7,
-  0x58, 0xe9, 0xe9, 0x73, 0xc9, 0x53, 0x1b, 0x25, 0x96, 0x7e, 0x37, 0x01,
-  0x09, 0xcf, 0xe5, 0x7a, 0xbd, 0x7e, 0x4a, 0xcf, 0x1c, 0xa7, 0x23, 0xfe,
-  0xce, 0xf3, 0xc6, 0x6a, 0x52, 0x78, 0x58, 0x02, 0x30, 0x93, 0xfc, 0xd3,
-  0xb3, 0xa4, 0xd2, 0xbe, 0x2d, 0x43, 0x16, 0x10, 0xa7, 0x76, 0x4a, 0x26,
-  0x70, 0x63, 0x22, 0x2f, 0x03, 0x88, 0x27, 0xce, 0x24, 0x72, 0x2b, 0x23,
-  0x2e, 0x64, 0x53, 0xd1, 0x9f, 0x1b, 0x64, 0x24, 0x77, 0x78, 0xe1, 0xca,
-  0xb4, 0xf8, 0x53, 0xd8, 0xb4, 0x77, 0xe9, 0xcc, 0x65, 0x4c, 0x5b, 0x57,
-  0x12, 0x47, 0x5e, 0x5f, 0x72, 0xba, 0x55, 0xce, 0x81, 0xf4, 0x14, 0xf8,
-  0x0b, 0x62, 0xf7, 0xb5, 0x3a, 0xa4, 0x6d, 0x85, 0x4e, 0x09, 0x03, 0xeb,
-  0xa1, 0xf7, 0xb2, 0xb7, 0x66, 0xfb, 0x87, 0xad, 0x00, 0xe6, 0x1c, 0x75,
-  0x10, 0xa9, 0xe0, 0x35, 0x27, 0x04, 0x9e, 0x21, 0x68, 0x9e, 0xc5, 0xce,
-  0xc6, 0xf2, 0x25, 0xbe, 0x09, 0x3c, 0x41, 0x69, 0x33, 0x51, 0x8a, 0xc1,
-  0x15, 0x5c, 0x71, 0x53, 0x67, 0xd1, 0xe7, 0xd9, 0x14, 0x99, 0x72, 0x66,
-  0xc8, 0xe3, 0xf8, 0x88, 0x10, 0x69, 0x5b, 0x1d, 0x0e, 0x78, 0xb7, 0x5e,
-  0xca, 0x66, 0xe0, 0x41, 0x1a, 0xbf, 0x26, 0x8b, 0x7e, 0x99, 0x49, 0x07,
-  0x4d, 0xf3, 0x2f, 0x39, 0x23, 0x2f, 0x2c, 0x0e, 0x43, 0xd8, 0xa5, 0xa9,
-  0xc3, 0xd7, 0xc9, 0x42, 0x1b, 0x43, 0x2f, 0xe4, 0x06, 0xe4, 0x50, 0x28,
-  0xf9, 0xc2, 0x81, 0x22, 0x89, 0xf5, 0xd4, 0x43, 0xd1, 0x37, 0x6e, 0x21,
-  0xf8, 0x77, 0x39, 0x2e, 0xda, 0x38, 0xf6, 0xe9, 0xa3, 0x50, 0xc2, 0xd1,
-  0x64, 0x53, 0x05, 0xed, 0x0c, 0x4f, 0xc3, 0xb9, 0xf8, 0x18, 0x02, 0xca,
-  0x24, 0x5e, 0xa0, 0xaa, 0xa6, 0xda, 0x4f, 0x7c, 0x52, 0x82, 0xbc, 0x55,
-  0x9c, 0x7f, 0x1f, 0x80, 0xc8, 0xba, 0xf0, 0xf3, 0xec, 0x63, 0x55, 0x2d,
-  0x96, 0xd1, 0xcf, 0xba, 0x12, 0x31, 0xdf, 0x51, 0x0a, 0xad, 0xc9, 0x04,
-  0x27, 0x1d, 0x57, 0x4c, 0x13, 0x59, 0x8d, 0x74, 0xf4, 0x66, 0x59, 0x09,
-  0xa6, 0x71, 0xf4, 0xa4, 0x36, 0x8f, 0xd3, 0xf2, 0x8f, 0xc9, 0x64, 0x22,
-  0xeb, 0x7a, 0x8f, 0x1c, 0x7f, 0x45, 0xf8, 0x65, 0xbe, 0x99, 0x10, 0x50,
-  0xd1, 0x15, 0x89, 0x32, 0x78, 0xca, 0x9e, 0x48, 0x95, 0xfc, 0xe0, 0x1f,
-  0x8e, 0xe1, 0x29, 0xf2, 0x10, 0x91, 0x56, 0xd4, 0xa9, 0xe1, 0x24, 0x7d,
-  0xa1, 0x89, 0x92, 0x7e, 0x16, 0xc6, 0x6b, 0x7e, 0x2a, 0xde, 0x16, 0x3f,
-  0x3f, 0xc5, 0x4f, 0xfb, 0x9e, 0x9f, 0xa2, 0x2f, 0xbf, 0xfe, 0x3f, 0x59,
-  0x62, 0x9f, 0x69, 0x0c, 0x7b, 0x00, 0x00
-};
-  static const unsigned int index_html_gz_len = sizeof(index_html_gz);
-
-  #endif
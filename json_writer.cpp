@@ -0,0 +1,182 @@
+#include "json_writer.h"
+#include <stdio.h>
+#include <string.h>
+
+JsonWriter::JsonWriter(Print& out) : _out(out) {}
+
+void JsonWriter::beginObject(const char* key) {
+    _open(key, '{');
+}
+
+void JsonWriter::endObject() {
+    _close('}');
+}
+
+void JsonWriter::beginArray(const char* key) {
+    _open(key, '[');
+}
+
+void JsonWriter::endArray() {
+    _close(']');
+}
+
+void JsonWriter::add(const char* key, const char* value) {
+    _beginValue(key);
+    if (value) {
+        _writeString(value);
+    } else {
+        _write("null", 4);
+    }
+}
+
+void JsonWriter::add(const char* key, bool value) {
+    _beginValue(key);
+    if (value) {
+        _write("true", 4);
+    } else {
+        _write("false", 5);
+    }
+}
+
+void JsonWriter::add(const char* key, int value) {
+    add(key, (long)value);
+}
+
+void JsonWriter::add(const char* key, unsigned int value) {
+    add(key, (unsigned long)value);
+}
+
+void JsonWriter::add(const char* key, long value) {
+    char text[12];
+    int length = snprintf(text, sizeof(text), "%ld", value);
+    _beginValue(key);
+    _write(text, length);
+}
+
+void JsonWriter::add(const char* key, unsigned long value) {
+    char text[12];
+    int length = snprintf(text, sizeof(text), "%lu", value);
+    _beginValue(key);
+    _write(text, length);
+}
+
+void JsonWriter::add(const char* key, const IPAddress& value) {
+    char text[18];
+    int length = snprintf(text, sizeof(text), "\"%u.%u.%u.%u\"", value[0], value[1], value[2], value[3]);
+    _beginValue(key);
+    _write(text, length);
+}
+
+void JsonWriter::addTenths(const char* key, long tenths) {
+    unsigned long magnitude = (tenths < 0) ? 0UL - (unsigned long)tenths : (unsigned long)tenths;
+    char text[14];
+    int length;
+    if (magnitude % 10 == 0) {
+        length = snprintf(text, sizeof(text), "%s%lu", tenths < 0 ? "-" : "", magnitude / 10);
+    } else {
+        length = snprintf(text, sizeof(text), "%s%lu.%lu", tenths < 0 ? "-" : "", magnitude / 10, magnitude % 10);
+    }
+    _beginValue(key);
+    _write(text, length);
+}
+
+size_t JsonWriter::getLength() const {
+    return _length;
+}
+
+void JsonWriter::_beginValue(const char* key) {
+    if (_depth > 0) {
+        uint32_t bit = 1UL << (_depth - 1);
+        if (_hasItemsMask & bit) _write(',');
+        _hasItemsMask |= bit;
+    }
+    if (key) {
+        _write('"');
+        _write(key, strlen(key));
+        _write("\":", 2);
+    }
+}
+
+void JsonWriter::_open(const char* key, char bracket) {
+    _beginValue(key);
+    _write(bracket);
+    if (_depth < MAX_DEPTH) {
+        _depth++;
+        _hasItemsMask &= ~(1UL << (_depth - 1));
+    }
+}
+
+void JsonWriter::_close(char bracket) {
+    if (_depth > 0) _depth--;
+    _write(bracket);
+}
+
+void JsonWriter::_write(const char* data, size_t length) {
+    _length += _out.write((const uint8_t*)data, length);
+}
+
+void JsonWriter::_write(char c) {
+    _length += _out.write((uint8_t)c);
+}
+
+void JsonWriter::_writeString(const char* value) {
+    _write('"');
+
+    // Участки без экранирования уходят одним вызовом write()
+    const char* run = value;
+    for (const char* p = value; *p; p++) {
+        uint8_t c = *p;
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+        _write(run, p - run);
+        run = p + 1;
+
+        char escaped[7];
+        int length;
+        switch (c) {
+            case '"': length = snprintf(escaped, sizeof(escaped), "\\\""); break;
+            case '\\': length = snprintf(escaped, sizeof(escaped), "\\\\"); break;
+            case '\n': length = snprintf(escaped, sizeof(escaped), "\\n"); break;
+            case '\r': length = snprintf(escaped, sizeof(escaped), "\\r"); break;
+            case '\t': length = snprintf(escaped, sizeof(escaped), "\\t"); break;
+            default: length = snprintf(escaped, sizeof(escaped), "\\u%04x", c); break;
+        }
+        _write(escaped, length);
+    }
+    _write(run, strlen(run));
+
+    _write('"');
+}
+
+BufferPrint::BufferPrint(char* buffer, size_t size) : _buffer(buffer), _size(size) {
+    if (_size > 0) _buffer[0] = '\0';
+}
+
+size_t BufferPrint::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t BufferPrint::write(const uint8_t* data, size_t length) {
+    if (_size == 0) {
+        _isOverflowed = _isOverflowed || length > 0;
+        return 0;
+    }
+
+    size_t space = _size - 1 - _length;
+    if (length > space) {
+        length = space;
+        _isOverflowed = true;
+    }
+    memcpy(_buffer + _length, data, length);
+    _length += length;
+    _buffer[_length] = '\0';
+    return length;
+}
+
+size_t BufferPrint::length() const {
+    return _length;
+}
+
+bool BufferPrint::isOverflowed() const {
+    return _isOverflowed;
+}
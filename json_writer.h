@@ -0,0 +1,67 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Print.h>
+#include <IPAddress.h>
+
+// Потоковая запись JSON в любой Print (файл, AsyncResponseStream, буфер)
+// без промежуточного документа и без выделения памяти. Запятые между
+// элементами расставляются сами; вложенность - до MAX_DEPTH уровней.
+class JsonWriter {
+public:
+    static const uint8_t MAX_DEPTH = 32;
+
+    explicit JsonWriter(Print& out);
+
+    // key == nullptr - элемент массива или корень
+    void beginObject(const char* key = nullptr);
+    void endObject();
+    void beginArray(const char* key = nullptr);
+    void endArray();
+
+    void add(const char* key, const char* value);
+    void add(const char* key, bool value);
+    void add(const char* key, int value);
+    void add(const char* key, unsigned int value);
+    void add(const char* key, long value);
+    void add(const char* key, unsigned long value);
+    void add(const char* key, const IPAddress& value);
+    // Значение в десятых долях: 2605 -> 260.5, 2600 -> 260 (мм -> см)
+    void addTenths(const char* key, long tenths);
+
+    size_t getLength() const;
+
+private:
+    Print& _out;
+    uint32_t _hasItemsMask = 0;
+    uint8_t _depth = 0;
+    size_t _length = 0;
+
+    void _beginValue(const char* key);
+    void _open(const char* key, char bracket);
+    void _close(char bracket);
+    void _write(const char* data, size_t length);
+    void _write(char c);
+    void _writeString(const char* value);
+};
+
+// Print в фиксированный буфер. Не влезшее отбрасывается, буфер всегда
+// заканчивается нулём.
+class BufferPrint : public Print {
+public:
+    BufferPrint(char* buffer, size_t size);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t length) override;
+
+    size_t length() const;
+    bool isOverflowed() const;
+
+private:
+    char* _buffer;
+    size_t _size;
+    size_t _length = 0;
+    bool _isOverflowed = false;
+};
+
+#endif
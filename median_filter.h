@@ -0,0 +1,74 @@
+#ifndef MEDIAN_FILTER_H
+#define MEDIAN_FILTER_H
+
+#include <stddef.h>
+#include <string.h>
+
+// Скользящая медиана: кольцо в порядке поступления + отсортированная копия.
+// Вытесняемое значение и место вставки ищутся бинарным поиском, сдвиг
+// делается одним memmove, поэтому окно в 31-101 отсчёт не требует сортировки.
+template <typename T, size_t N = 5>
+class MedianFilter {
+public:
+    static_assert(N > 0, "MedianFilter window must not be empty");
+
+    MedianFilter() {
+        reset(T());
+    }
+
+    void reset(T value) {
+        for (size_t i = 0; i < N; i++) {
+            _ring[i] = value;
+            _sorted[i] = value;
+        }
+        _head = 0;
+    }
+
+    T add(T value) {
+        T oldest = _ring[_head];
+        _ring[_head] = value;
+        if (++_head == N) _head = 0;
+
+        size_t from = _lowerBound(oldest);
+        size_t to = _lowerBound(value);
+
+        if (to > from) {
+            to--;
+            memmove(&_sorted[from], &_sorted[from + 1], (to - from) * sizeof(T));
+        } else if (to < from) {
+            memmove(&_sorted[to + 1], &_sorted[to], (from - to) * sizeof(T));
+        }
+        _sorted[to] = value;
+
+        return median();
+    }
+
+    T median() const {
+        return _sorted[N / 2];
+    }
+
+    static constexpr size_t size() {
+        return N;
+    }
+
+private:
+    T _ring[N];
+    T _sorted[N];
+    size_t _head = 0;
+
+    size_t _lowerBound(T value) const {
+        size_t lo = 0;
+        size_t hi = N;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (_sorted[mid] < value) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include "profiler.h"
+#include <string.h>
+
+#if PROFILING_ENABLED
+
+LatencyHistogram Profiler::_histograms[PROFILE_SECTION_COUNT];
+
+void LatencyHistogram::record(uint32_t us) {
+    uint8_t bucket = (us == 0) ? 0 : 32 - __builtin_clz(us);
+    if (bucket >= BUCKET_COUNT) bucket = BUCKET_COUNT - 1;
+
+    _buckets[bucket]++;
+    _count++;
+    if (us > _maxUs) _maxUs = us;
+}
+
+void LatencyHistogram::reset() {
+    memset(_buckets, 0, sizeof(_buckets));
+    _count = 0;
+    _maxUs = 0;
+}
+
+uint32_t LatencyHistogram::getCount() const {
+    return _count;
+}
+
+uint32_t LatencyHistogram::getMax() const {
+    return _maxUs;
+}
+
+uint32_t LatencyHistogram::getPercentile(uint8_t percent) const {
+    if (_count == 0) return 0;
+
+    uint32_t target = ((uint64_t)_count * percent + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < BUCKET_COUNT; b++) {
+        seen += _buckets[b];
+        if (seen >= target) {
+            uint32_t upperUs = (b == 0) ? 0 : (1UL << b) - 1;
+            return (upperUs < _maxUs) ? upperUs : _maxUs;
+        }
+    }
+    return _maxUs;
+}
+
+void Profiler::record(ProfileSection section, uint32_t us) {
+    _histograms[section].record(us);
+}
+
+void Profiler::reset() {
+    for (uint8_t i = 0; i < PROFILE_SECTION_COUNT; i++) {
+        _histograms[i].reset();
+    }
+}
+
+const LatencyHistogram& Profiler::getHistogram(ProfileSection section) {
+    return _histograms[section];
+}
+
+const char* Profiler::getSectionName(ProfileSection section) {
+    switch (section) {
+        case PROFILE_LOOP: return "loop";
+        case PROFILE_CONTROL_UPDATE: return "controlUpdate";
+        case PROFILE_WIFI_LOOP: return "wifiLoop";
+        case PROFILE_SAVE_SETTINGS: return "saveSettings";
+        default: return "unknown";
+    }
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include "hal.h"
+
+// Собрать без замеров: -DPROFILING_ENABLED=0
+#ifndef PROFILING_ENABLED
+#define PROFILING_ENABLED 1
+#endif
+
+enum ProfileSection : uint8_t {
+    PROFILE_LOOP = 0,
+    PROFILE_CONTROL_UPDATE,
+    PROFILE_WIFI_LOOP,
+    PROFILE_SAVE_SETTINGS,
+    PROFILE_SECTION_COUNT
+};
+
+// Гистограмма с логарифмическими корзинами: корзина b хранит
+// длительности в диапазоне [2^(b-1), 2^b) мкс, корзина 0 - меньше 1 мкс.
+class LatencyHistogram {
+public:
+    static const uint8_t BUCKET_COUNT = 24;
+
+    void record(uint32_t us);
+    void reset();
+
+    uint32_t getCount() const;
+    uint32_t getMax() const;
+    uint32_t getPercentile(uint8_t percent) const;
+
+private:
+    uint32_t _buckets[BUCKET_COUNT] = {0};
+    uint32_t _count = 0;
+    uint32_t _maxUs = 0;
+};
+
+class Profiler {
+public:
+    static void record(ProfileSection section, uint32_t us);
+    static void reset();
+    static const LatencyHistogram& getHistogram(ProfileSection section);
+    static const char* getSectionName(ProfileSection section);
+
+private:
+    static LatencyHistogram _histograms[PROFILE_SECTION_COUNT];
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileSection section) : _section(section), _startUs(hal::micros()) {}
+    ~ProfileScope() { Profiler::record(_section, hal::micros() - _startUs); }
+
+private:
+    ProfileSection _section;
+    uint32_t _startUs;
+};
+
+#if PROFILING_ENABLED
+#define PROFILE_SCOPE(section) ProfileScope _profileScope(section)
+#else
+#define PROFILE_SCOPE(section) do {} while (0)
+#endif
+
+#endif
@@ -0,0 +1,139 @@
+#include "rollup.h"
+
+RollupManager::RollupManager() {
+    RollupBucket* storage[LEVEL_COUNT] = { _seconds, _minutes, _hours };
+    const uint16_t sizes[LEVEL_COUNT] = { ROLLUP_SECONDS, ROLLUP_MINUTES, ROLLUP_HOURS };
+    const uint32_t resolutions[LEVEL_COUNT] = { 1, 60, 3600 };
+
+    for (uint8_t i = 0; i < LEVEL_COUNT; i++) {
+        Ring& ring = _levels[i];
+        ring.buckets = storage[i];
+        ring.size = sizes[i];
+        ring.resolutionSec = resolutions[i];
+        ring.head = 0;
+        ring.count = 0;
+        ring.newestStart = 0;
+        ring.openStart = 0;
+        ring.hasOpen = false;
+        _clear(ring.open);
+    }
+}
+
+void RollupManager::addReading(uint32_t nowSec, uint16_t distanceMm, bool isPumpOn) {
+    Ring& seconds = _levels[0];
+
+    if (!_hasReading) {
+        _hasReading = true;
+        _isPumpOn = isPumpOn;
+        _uptimeSec = nowSec;
+        seconds.hasOpen = true;
+        seconds.openStart = _uptimeSec;
+    }
+
+    // Секунды без показаний закрываются пустыми корзинами, насос считается
+    // в прежнем состоянии
+    while (_uptimeSec < nowSec) {
+        _closeSecond();
+        _uptimeSec++;
+        _clear(seconds.open);
+        seconds.openStart = _uptimeSec;
+    }
+
+    RollupBucket& open = seconds.open;
+    if (isPumpOn && !_isPumpOn) open.pumpStarts++;
+    _isPumpOn = isPumpOn;
+
+    if (distanceMm == 0) return;
+    open.sum += distanceMm;
+    open.count++;
+    if (distanceMm < open.minMm) open.minMm = distanceMm;
+    if (distanceMm > open.maxMm) open.maxMm = distanceMm;
+}
+
+uint32_t RollupManager::getUptimeSec() const {
+    return _uptimeSec;
+}
+
+uint32_t RollupManager::getResolution(uint8_t level) const {
+    return _levels[level].resolutionSec;
+}
+
+uint32_t RollupManager::getOldestSec(uint8_t level) const {
+    const Ring& ring = _levels[level];
+    if (ring.count == 0) return ring.openStart;
+    return ring.newestStart - (uint32_t)(ring.count - 1) * ring.resolutionSec;
+}
+
+uint8_t RollupManager::selectLevel(uint32_t fromSec, uint32_t toSec, uint16_t maxPoints) const {
+    for (uint8_t level = 0; level < LEVEL_COUNT; level++) {
+        uint32_t resolution = _levels[level].resolutionSec;
+        uint32_t points = (toSec - fromSec) / resolution + 1;
+        if (fromSec >= getOldestSec(level) && points <= maxPoints) return level;
+    }
+    return LEVEL_COUNT - 1;
+}
+
+bool RollupManager::getBucket(uint8_t level, uint32_t startSec, RollupBucket& bucket) const {
+    const Ring& ring = _levels[level];
+
+    if (ring.hasOpen && startSec == ring.openStart) {
+        bucket = ring.open;
+        return true;
+    }
+    if (ring.count == 0 || startSec > ring.newestStart || startSec < getOldestSec(level)) return false;
+    if ((ring.newestStart - startSec) % ring.resolutionSec != 0) return false;
+
+    uint16_t back = (ring.newestStart - startSec) / ring.resolutionSec;
+    bucket = ring.buckets[(ring.head + ring.size - 1 - back) % ring.size];
+    return true;
+}
+
+void RollupManager::_closeSecond() {
+    Ring& seconds = _levels[0];
+    if (_isPumpOn) seconds.open.pumpOnSecs = 1;
+
+    _push(seconds, seconds.openStart, seconds.open);
+    _add(1, seconds.openStart, seconds.open);
+}
+
+void RollupManager::_add(uint8_t level, uint32_t startSec, const RollupBucket& bucket) {
+    Ring& ring = _levels[level];
+    uint32_t bucketStart = startSec - startSec % ring.resolutionSec;
+
+    if (ring.hasOpen && bucketStart != ring.openStart) {
+        _push(ring, ring.openStart, ring.open);
+        if (level + 1 < LEVEL_COUNT) _add(level + 1, ring.openStart, ring.open);
+        ring.hasOpen = false;
+    }
+    if (!ring.hasOpen) {
+        _clear(ring.open);
+        ring.openStart = bucketStart;
+        ring.hasOpen = true;
+    }
+    _merge(ring.open, bucket);
+}
+
+void RollupManager::_push(Ring& ring, uint32_t startSec, const RollupBucket& bucket) {
+    ring.buckets[ring.head] = bucket;
+    ring.head = (ring.head + 1) % ring.size;
+    if (ring.count < ring.size) ring.count++;
+    ring.newestStart = startSec;
+}
+
+void RollupManager::_clear(RollupBucket& bucket) {
+    bucket.sum = 0;
+    bucket.count = 0;
+    bucket.minMm = 0xFFFF;
+    bucket.maxMm = 0;
+    bucket.pumpOnSecs = 0;
+    bucket.pumpStarts = 0;
+}
+
+void RollupManager::_merge(RollupBucket& target, const RollupBucket& source) {
+    target.sum += source.sum;
+    target.count += source.count;
+    if (source.minMm < target.minMm) target.minMm = source.minMm;
+    if (source.maxMm > target.maxMm) target.maxMm = source.maxMm;
+    target.pumpOnSecs += source.pumpOnSecs;
+    target.pumpStarts += source.pumpStarts;
+}
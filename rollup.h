@@ -0,0 +1,80 @@
+#ifndef ROLLUP_H
+#define ROLLUP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef ROLLUP_SECONDS
+#define ROLLUP_SECONDS 120
+#endif
+
+#ifndef ROLLUP_MINUTES
+#define ROLLUP_MINUTES 240
+#endif
+
+#ifndef ROLLUP_HOURS
+#define ROLLUP_HOURS 168
+#endif
+
+// Агрегаты уровня канала 0 за 1 с, 1 мин и 1 ч в кольцах фиксированного
+// размера. Каждое показание меняет только открытую секундную корзину;
+// закрытая корзина вливается в следующий уровень, так что обновление O(1).
+// Время - секунды от старта по часам HistoryManager, чтобы /getRollups и
+// /history совпадали. Нулевое расстояние (нет эха) в min/max/avg не учитывается.
+
+struct RollupBucket {
+    uint32_t sum;
+    uint32_t count;
+    uint16_t minMm;
+    uint16_t maxMm;
+    uint16_t pumpOnSecs;
+    uint16_t pumpStarts;
+};
+
+class RollupManager {
+public:
+    static const uint8_t LEVEL_COUNT = 3;
+
+    RollupManager();
+
+    void addReading(uint32_t nowSec, uint16_t distanceMm, bool isPumpOn);
+
+    uint32_t getUptimeSec() const;
+    uint32_t getResolution(uint8_t level) const;
+    uint32_t getOldestSec(uint8_t level) const;
+
+    // Самый мелкий уровень, который ещё хранит fromSec и укладывается в maxPoints
+    uint8_t selectLevel(uint32_t fromSec, uint32_t toSec, uint16_t maxPoints) const;
+    bool getBucket(uint8_t level, uint32_t startSec, RollupBucket& bucket) const;
+
+private:
+    struct Ring {
+        RollupBucket* buckets;
+        uint16_t size;
+        uint32_t resolutionSec;
+        uint16_t head;
+        uint16_t count;
+        uint32_t newestStart;
+        RollupBucket open;
+        uint32_t openStart;
+        bool hasOpen;
+    };
+
+    RollupBucket _seconds[ROLLUP_SECONDS];
+    RollupBucket _minutes[ROLLUP_MINUTES];
+    RollupBucket _hours[ROLLUP_HOURS];
+    Ring _levels[LEVEL_COUNT];
+
+    bool _hasReading = false;
+    bool _isPumpOn = false;
+    uint32_t _uptimeSec = 0;
+
+    void _closeSecond();
+    void _add(uint8_t level, uint32_t startSec, const RollupBucket& bucket);
+    void _push(Ring& ring, uint32_t startSec, const RollupBucket& bucket);
+
+    static void _clear(RollupBucket& bucket);
+    static void _merge(RollupBucket& target, const RollupBucket& source);
+};
+
+#endif
@@ -0,0 +1,114 @@
+#include "scheduler.h"
+
+TaskScheduler::TaskScheduler() {}
+
+int TaskScheduler::addPeriodic(const char* name, TaskCallback callback, unsigned long periodMs, unsigned long deadlineUs, uint8_t priority) {
+    return _addTask(name, callback, periodMs * 1000UL, 0, deadlineUs, priority, false);
+}
+
+int TaskScheduler::addOneShot(const char* name, TaskCallback callback, unsigned long delayMs, unsigned long deadlineUs, uint8_t priority) {
+    return _addTask(name, callback, 0, delayMs * 1000UL, deadlineUs, priority, true);
+}
+
+int TaskScheduler::_addTask(const char* name, TaskCallback callback, unsigned long periodUs, unsigned long delayUs, unsigned long deadlineUs, uint8_t priority, bool isOneShot) {
+    int slot = -1;
+    for (uint8_t i = 0; i < _taskCount; i++) {
+        if (!_tasks[i].isActive) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) {
+        if (_taskCount >= MAX_TASKS) {
+            Serial.printf("Scheduler: No free slot for task '%s'.\n", name);
+            return -1;
+        }
+        slot = _taskCount++;
+    }
+
+    SchedulerTask& task = _tasks[slot];
+    memset(&task, 0, sizeof(task));
+    task.name = name;
+    task.callback = callback;
+    task.periodUs = periodUs;
+    task.deadlineUs = deadlineUs;
+    task.nextRunUs = micros() + delayUs;
+    task.priority = priority;
+    task.isActive = true;
+    task.isOneShot = isOneShot;
+    task.lastPass = _pass;
+    return slot;
+}
+
+void TaskScheduler::run() {
+    _pass++;
+
+    // Каждая готовая задача выполняется не более одного раза за проход,
+    // в порядке приоритета, поэтому управление насосом всегда идёт первым.
+    int index;
+    while ((index = _nextDueTask(micros())) >= 0) {
+        _runTask(_tasks[index]);
+    }
+}
+
+int TaskScheduler::_nextDueTask(unsigned long nowUs) const {
+    int best = -1;
+    for (uint8_t i = 0; i < _taskCount; i++) {
+        const SchedulerTask& task = _tasks[i];
+        if (!task.isActive || task.lastPass == _pass) continue;
+        if ((long)(nowUs - task.nextRunUs) < 0) continue;
+
+        if (best < 0 || task.priority < _tasks[best].priority ||
+            (task.priority == _tasks[best].priority && (long)(task.nextRunUs - _tasks[best].nextRunUs) < 0)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+void TaskScheduler::_runTask(SchedulerTask& task) {
+    task.lastPass = _pass;
+    unsigned long releaseUs = task.nextRunUs;
+
+    unsigned long startUs = micros();
+    task.callback();
+    unsigned long endUs = micros();
+
+    unsigned long execUs = endUs - startUs;
+    unsigned long latenessUs = endUs - releaseUs;
+
+    task.runs++;
+    task.lastExecUs = execUs;
+    if (execUs > task.worstExecUs) task.worstExecUs = execUs;
+    if (latenessUs > task.worstLatenessUs) task.worstLatenessUs = latenessUs;
+    if (task.deadlineUs > 0 && latenessUs > task.deadlineUs) task.overruns++;
+
+    if (task.isOneShot) {
+        task.isActive = false;
+        return;
+    }
+
+    task.nextRunUs = releaseUs + task.periodUs;
+    if ((long)(endUs - task.nextRunUs) >= 0) {
+        task.nextRunUs = endUs + task.periodUs;
+    }
+}
+
+uint8_t TaskScheduler::getTaskCount() const {
+    return _taskCount;
+}
+
+const SchedulerTask& TaskScheduler::getTask(uint8_t index) const {
+    return _tasks[index];
+}
+
+void TaskScheduler::resetStats() {
+    for (uint8_t i = 0; i < _taskCount; i++) {
+        SchedulerTask& task = _tasks[i];
+        task.runs = 0;
+        task.overruns = 0;
+        task.lastExecUs = 0;
+        task.worstExecUs = 0;
+        task.worstLatenessUs = 0;
+    }
+}
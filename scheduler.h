@@ -0,0 +1,57 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+typedef void (*TaskCallback)();
+
+enum TaskPriority : uint8_t {
+    PRIORITY_CONTROL = 0,
+    PRIORITY_NETWORK = 1,
+    PRIORITY_HOUSEKEEPING = 2
+};
+
+struct SchedulerTask {
+    const char* name;
+    TaskCallback callback;
+    unsigned long periodUs;
+    unsigned long deadlineUs;
+    unsigned long nextRunUs;
+    uint8_t priority;
+    bool isActive;
+    bool isOneShot;
+    uint32_t lastPass;
+
+    uint32_t runs;
+    uint32_t overruns;
+    unsigned long lastExecUs;
+    unsigned long worstExecUs;
+    unsigned long worstLatenessUs;
+};
+
+class TaskScheduler {
+public:
+    static const uint8_t MAX_TASKS = 12;
+
+    TaskScheduler();
+
+    int addPeriodic(const char* name, TaskCallback callback, unsigned long periodMs, unsigned long deadlineUs, uint8_t priority);
+    int addOneShot(const char* name, TaskCallback callback, unsigned long delayMs, unsigned long deadlineUs, uint8_t priority);
+    void run();
+
+    uint8_t getTaskCount() const;
+    const SchedulerTask& getTask(uint8_t index) const;
+    // Обнуляет счётчики запусков, пропусков срока и худшие времена
+    void resetStats();
+
+private:
+    SchedulerTask _tasks[MAX_TASKS];
+    uint8_t _taskCount = 0;
+    uint32_t _pass = 0;
+
+    int _addTask(const char* name, TaskCallback callback, unsigned long periodUs, unsigned long delayUs, unsigned long deadlineUs, uint8_t priority, bool isOneShot);
+    int _nextDueTask(unsigned long nowUs) const;
+    void _runTask(SchedulerTask& task);
+};
+
+#endif
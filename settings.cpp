@@ -1,5 +1,11 @@
 #include "settings.h"
 
+static uint16_t cmToMm(float cm) {
+  if (cm <= 0) return 0;
+  if (cm >= 6553.5) return 65535;
+  return (uint16_t)(cm * 10.0 + 0.5);
+}
+
 SettingsManager::SettingsManager() {
 
 }
@@ -50,13 +56,21 @@ void SettingsManager::formatFS() {
 void SettingsManager::loadDefaults() {
   Serial.println("Loading default settings...");
 
-  settings.control.minTrigger = 260.0;
-  settings.control.maxTrigger = 290.0;
-  settings.control.pin_pump = 16;
+  settings.control.channelCount = 1;
+  for (uint8_t ch = 0; ch < CONTROL_MAX_CHANNELS; ch++) {
+    ChannelSettings& channel = settings.control.channels[ch];
+    channel.minTriggerMm = 2600;
+    channel.maxTriggerMm = 2900;
+    channel.pin_pump = -1;
+    channel.pin_echo = -1;
+    channel.pin_trig = -1;
+  }
+  settings.control.channels[0].pin_pump = 16;
+  settings.control.channels[0].pin_echo = 14;
+  settings.control.channels[0].pin_trig = 12;
+  settings.control.sampleIntervalMs = 50;
   settings.control.pin_led = 5;
   settings.control.pin_button = 4;
-  settings.control.pin_echo = 14;
-  settings.control.pin_trig = 12;
 
   settings.isWifiTurnedOn = true;
   settings.networkSettings.clear();
@@ -75,10 +89,15 @@ void SettingsManager::loadDefaults() {
   settings.autoReconnect = true;
   settings.timeZone = 3;
 
+  settings.liveDeadbandMm = 10;
+  settings.liveHeartbeatSec = 15;
+
   Serial.println("Default settings loaded into memory.");
 }
 
 bool SettingsManager::saveSettings() {
+  PROFILE_SCOPE(PROFILE_SAVE_SETTINGS);
+
   if (!spiffsMounted) {
     Serial.println("Cannot save settings, SPIFFS not mounted.");
     return false;
@@ -90,8 +109,7 @@ bool SettingsManager::saveSettings() {
     return false;
   }
 
-  String jsonString = serializeSettings(settings);
-  file.print(jsonString);
+  writeSettings(file, settings);
   file.close();
 
   Serial.println("Settings successfully saved to /settings.json");
@@ -134,58 +152,100 @@ bool SettingsManager::loadSettings() {
   return true;
 }
 
-String SettingsManager::serializeSettings(const DeviceSettings& settings) {
-  DynamicJsonDocument doc(2048);
+void SettingsManager::writeSettings(Print& out, const DeviceSettings& settings) {
+  JsonWriter json(out);
+  json.beginObject();
+
+  json.beginObject("control");
+  const ChannelSettings& primary = settings.control.channels[0];
+  json.addTenths("minTrigger", primary.minTriggerMm);
+  json.addTenths("maxTrigger", primary.maxTriggerMm);
+  json.add("sampleIntervalMs", settings.control.sampleIntervalMs);
+  json.add("pin_pump", primary.pin_pump);
+  json.add("pin_led", settings.control.pin_led);
+  json.add("pin_button", settings.control.pin_button);
+  json.add("pin_echo", primary.pin_echo);
+  json.add("pin_trig", primary.pin_trig);
+
+  json.add("channelCount", settings.control.channelCount);
+  json.beginArray("channels");
+  for (uint8_t ch = 0; ch < settings.control.channelCount && ch < CONTROL_MAX_CHANNELS; ch++) {
+    const ChannelSettings& channel = settings.control.channels[ch];
+    json.beginObject();
+    json.addTenths("minTrigger", channel.minTriggerMm);
+    json.addTenths("maxTrigger", channel.maxTriggerMm);
+    json.add("pin_pump", channel.pin_pump);
+    json.add("pin_echo", channel.pin_echo);
+    json.add("pin_trig", channel.pin_trig);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
 
-  JsonObject control = doc.createNestedObject("control");
-  control["minTrigger"] = settings.control.minTrigger;
-  control["maxTrigger"] = settings.control.maxTrigger;
-  control["pin_pump"] = settings.control.pin_pump;
-  control["pin_led"] = settings.control.pin_led;
-  control["pin_button"] = settings.control.pin_button;
-  control["pin_echo"] = settings.control.pin_echo;
-  control["pin_trig"] = settings.control.pin_trig;
-
-  doc["isWifiTurnedOn"] = settings.isWifiTurnedOn;
-  JsonArray networks = doc.createNestedArray("networkSettings");
+  json.add("isWifiTurnedOn", settings.isWifiTurnedOn);
+  json.beginArray("networkSettings");
   for (const auto& net : settings.networkSettings) {
-    JsonObject netObj = networks.createNestedObject();
-    netObj["ssid"] = net.ssid;
-    netObj["password"] = net.password;
-    netObj["useStaticIP"] = net.useStaticIP;
+    json.beginObject();
+    json.add("ssid", net.ssid.c_str());
+    json.add("password", net.password.c_str());
+    json.add("useStaticIP", net.useStaticIP);
     if (net.useStaticIP) {
-      netObj["staticIP"] = net.staticIP.toString();
-      netObj["staticGateway"] = net.staticGateway.toString();
-      netObj["staticSubnet"] = net.staticSubnet.toString();
-      netObj["staticDNS"] = net.staticDNS.toString();
+      json.add("staticIP", net.staticIP);
+      json.add("staticGateway", net.staticGateway);
+      json.add("staticSubnet", net.staticSubnet);
+      json.add("staticDNS", net.staticDNS);
     }
+    json.endObject();
   }
+  json.endArray();
+
+  json.add("isAP", settings.isAP);
+  json.add("ssidAP", settings.ssidAP.c_str());
+  json.add("passwordAP", settings.passwordAP.c_str());
+  json.add("staticIpAP", settings.staticIpAP);
 
-  doc["isAP"] = settings.isAP;
-  doc["ssidAP"] = settings.ssidAP;
-  doc["passwordAP"] = settings.passwordAP;
-  doc["staticIpAP"] = settings.staticIpAP.toString();
+  json.add("mDNS", settings.mDNS.c_str());
+  json.add("autoReconnect", settings.autoReconnect);
+  json.add("timeZone", settings.timeZone);
 
-  doc["mDNS"] = settings.mDNS;
-  doc["autoReconnect"] = settings.autoReconnect;
-  doc["timeZone"] = settings.timeZone;
+  json.addTenths("liveDeadband", settings.liveDeadbandMm);
+  json.add("liveHeartbeatSec", settings.liveHeartbeatSec);
 
-  String output;
-  serializeJson(doc, output);
-  return output;
+  json.endObject();
 }
 
 bool SettingsManager::deserializeSettings(JsonObject doc, DeviceSettings& settings) {
 
   if (doc.containsKey("control")) {
     JsonObject control = doc["control"];
-    settings.control.minTrigger = control["minTrigger"] | 260.0;
-    settings.control.maxTrigger = control["maxTrigger"] | 290.0;
-    settings.control.pin_pump = control["pin_pump"] | 15;
+    JsonArray channels = control["channels"];
+
+    int channelCount = control["channelCount"] | 1;
+    if (channelCount < 1) channelCount = 1;
+    if (channelCount > CONTROL_MAX_CHANNELS) channelCount = CONTROL_MAX_CHANNELS;
+    settings.control.channelCount = channelCount;
+
+    for (uint8_t ch = 0; ch < CONTROL_MAX_CHANNELS; ch++) {
+      JsonObject channelObj = channels[ch];
+      ChannelSettings& channel = settings.control.channels[ch];
+      channel.minTriggerMm = cmToMm(channelObj["minTrigger"] | 260.0);
+      channel.maxTriggerMm = cmToMm(channelObj["maxTrigger"] | 290.0);
+      channel.pin_pump = channelObj["pin_pump"] | -1;
+      channel.pin_echo = channelObj["pin_echo"] | -1;
+      channel.pin_trig = channelObj["pin_trig"] | -1;
+    }
+
+    // Поля control.* описывают канал 0 и имеют приоритет: их редактирует веб-интерфейс
+    ChannelSettings& primary = settings.control.channels[0];
+    primary.minTriggerMm = cmToMm(control["minTrigger"] | (channels[0]["minTrigger"] | 260.0));
+    primary.maxTriggerMm = cmToMm(control["maxTrigger"] | (channels[0]["maxTrigger"] | 290.0));
+    primary.pin_pump = control["pin_pump"] | (channels[0]["pin_pump"] | 15);
+    primary.pin_echo = control["pin_echo"] | (channels[0]["pin_echo"] | 13);
+    primary.pin_trig = control["pin_trig"] | (channels[0]["pin_trig"] | 12);
+
+    settings.control.sampleIntervalMs = control["sampleIntervalMs"] | 50;
     settings.control.pin_led = control["pin_led"] | 0;
     settings.control.pin_button = control["pin_button"] | 2;
-    settings.control.pin_echo = control["pin_echo"] | 13;
-    settings.control.pin_trig = control["pin_trig"] | 12;
   }
 
   settings.isWifiTurnedOn = doc["isWifiTurnedOn"] | true;
@@ -216,5 +276,287 @@ bool SettingsManager::deserializeSettings(JsonObject doc, DeviceSettings& settin
   settings.autoReconnect = doc["autoReconnect"] | true;
   settings.timeZone = doc["timeZone"] | 3;
 
+  settings.liveDeadbandMm = cmToMm(doc["liveDeadband"] | 1.0);
+  settings.liveHeartbeatSec = doc["liveHeartbeatSec"] | 15;
+  if (settings.liveHeartbeatSec < 1) settings.liveHeartbeatSec = 1;
+
+  return true;
+}
+
+namespace {
+
+const int MIN_PIN = -1;
+const int MAX_PIN = 16;
+
+// Сравнивает поле патча с текущим значением и отмечает изменившиеся
+class SettingsPatcher {
+public:
+  SettingsPatcher(JsonWriter& changed, SettingsPatchResult& result) : _changed(changed), _result(result) {}
+
+  bool patchBool(JsonObjectConst patch, const char* key, const char* field, bool& target, bool needsReboot) {
+    JsonVariantConst value = patch[key];
+    if (value.isNull()) return true;
+    if (!value.is<bool>()) return _invalid(field);
+
+    if (value.as<bool>() != target) {
+      target = value.as<bool>();
+      _markChanged(field, needsReboot);
+    }
+    return true;
+  }
+
+  template<typename T>
+  bool patchInt(JsonObjectConst patch, const char* key, const char* field, T& target, long minValue, long maxValue, bool needsReboot) {
+    JsonVariantConst value = patch[key];
+    if (value.isNull()) return true;
+    if (!value.is<long>()) return _invalid(field);
+
+    long number = value.as<long>();
+    if (number < minValue || number > maxValue) return _invalid(field);
+    if ((T)number != target) {
+      target = (T)number;
+      _markChanged(field, needsReboot);
+    }
+    return true;
+  }
+
+  // Значение в сантиметрах, хранится в миллиметрах
+  bool patchCm(JsonObjectConst patch, const char* key, const char* field, uint16_t& targetMm, bool needsReboot) {
+    JsonVariantConst value = patch[key];
+    if (value.isNull()) return true;
+    if (!value.is<float>()) return _invalid(field);
+
+    uint16_t mm = cmToMm(value.as<float>());
+    if (mm != targetMm) {
+      targetMm = mm;
+      _markChanged(field, needsReboot);
+    }
+    return true;
+  }
+
+  bool patchString(JsonObjectConst patch, const char* key, const char* field, String& target, bool needsReboot) {
+    JsonVariantConst value = patch[key];
+    if (value.isNull()) return true;
+    if (!value.is<const char*>()) return _invalid(field);
+
+    if (target != value.as<const char*>()) {
+      target = value.as<const char*>();
+      _markChanged(field, needsReboot);
+    }
+    return true;
+  }
+
+  bool patchIp(JsonObjectConst patch, const char* key, const char* field, IPAddress& target, bool needsReboot) {
+    JsonVariantConst value = patch[key];
+    if (value.isNull()) return true;
+
+    IPAddress ip;
+    if (!value.is<const char*>() || !ip.fromString(value.as<const char*>())) return _invalid(field);
+    if (ip != target) {
+      target = ip;
+      _markChanged(field, needsReboot);
+    }
+    return true;
+  }
+
+  // Список сетей заменяется целиком
+  bool patchNetworks(JsonObjectConst patch, const char* key, std::vector<NetworkSetting>& target) {
+    JsonVariantConst value = patch[key];
+    if (value.isNull()) return true;
+    if (!value.is<JsonArrayConst>()) return _invalid(key);
+
+    std::vector<NetworkSetting> networks;
+    for (JsonVariantConst item : value.as<JsonArrayConst>()) {
+      JsonObjectConst net = item.as<JsonObjectConst>();
+      if (net.isNull() || !net["ssid"].is<const char*>()) return _invalid(key);
+
+      NetworkSetting ns;
+      ns.ssid = net["ssid"].as<const char*>();
+      ns.password = net["password"] | "";
+      ns.useStaticIP = net["useStaticIP"] | false;
+      if (ns.useStaticIP) {
+        if (!ns.staticIP.fromString(net["staticIP"] | "") ||
+            !ns.staticGateway.fromString(net["staticGateway"] | "") ||
+            !ns.staticSubnet.fromString(net["staticSubnet"] | "255.255.255.0") ||
+            !ns.staticDNS.fromString(net["staticDNS"] | "8.8.8.8")) {
+          return _invalid(key);
+        }
+      }
+      networks.push_back(ns);
+    }
+
+    if (!_isSameNetworks(networks, target)) {
+      target = networks;
+      _markChanged(key, true);
+    }
+    return true;
+  }
+
+private:
+  JsonWriter& _changed;
+  SettingsPatchResult& _result;
+
+  void _markChanged(const char* field, bool needsReboot) {
+    _changed.add(nullptr, field);
+    _result.changedCount++;
+    if (needsReboot) _result.needsReboot = true;
+  }
+
+  bool _invalid(const char* field) {
+    _result.invalidField = field;
+    return false;
+  }
+
+  static bool _isSameNetworks(const std::vector<NetworkSetting>& a, const std::vector<NetworkSetting>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+      if (a[i].ssid != b[i].ssid || a[i].password != b[i].password || a[i].useStaticIP != b[i].useStaticIP) return false;
+      if (a[i].useStaticIP && (a[i].staticIP != b[i].staticIP || a[i].staticGateway != b[i].staticGateway ||
+                               a[i].staticSubnet != b[i].staticSubnet || a[i].staticDNS != b[i].staticDNS)) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+}
+
+bool SettingsManager::patchSettings(JsonObjectConst patch, DeviceSettings& settings, JsonWriter& changed, SettingsPatchResult& result) {
+  SettingsPatcher patcher(changed, result);
+
+  // Пороги и период опроса ControlManager читает на лету, выводы - только при старте
+  JsonVariantConst controlValue = patch["control"];
+  if (!controlValue.isNull()) {
+    JsonObjectConst control = controlValue.as<JsonObjectConst>();
+    if (control.isNull()) {
+      result.invalidField = "control";
+      return false;
+    }
+
+    // Канал 0 задаётся либо полями control.*, либо control.channels[0], но не
+    // обоими сразу: иначе молча победило бы то, что применено последним
+    JsonObjectConst firstChannel = control["channels"][0].as<JsonObjectConst>();
+    if (!firstChannel.isNull()) {
+      static const char* const primaryFields[][2] = {
+        { "minTrigger", "control.minTrigger" }, { "maxTrigger", "control.maxTrigger" },
+        { "pin_pump", "control.pin_pump" }, { "pin_echo", "control.pin_echo" }, { "pin_trig", "control.pin_trig" }
+      };
+      for (const auto& primaryField : primaryFields) {
+        if (!control[primaryField[0]].isNull() && !firstChannel[primaryField[0]].isNull()) {
+          result.invalidField = primaryField[1];
+          return false;
+        }
+      }
+    }
+
+    PumpControlSettings& target = settings.control;
+    if (!patcher.patchInt(control, "channelCount", "control.channelCount", target.channelCount, 1, CONTROL_MAX_CHANNELS, true)) return false;
+    if (!patcher.patchInt(control, "sampleIntervalMs", "control.sampleIntervalMs", target.sampleIntervalMs, 1, 60000, false)) return false;
+    if (!patcher.patchInt(control, "pin_led", "control.pin_led", target.pin_led, MIN_PIN, MAX_PIN, true)) return false;
+    if (!patcher.patchInt(control, "pin_button", "control.pin_button", target.pin_button, MIN_PIN, MAX_PIN, true)) return false;
+
+    JsonVariantConst channelsValue = control["channels"];
+    if (!channelsValue.isNull()) {
+      JsonArrayConst channels = channelsValue.as<JsonArrayConst>();
+      if (channels.isNull() || channels.size() > CONTROL_MAX_CHANNELS) {
+        result.invalidField = "control.channels";
+        return false;
+      }
+
+      // Имя поля собирается в общий буфер: JsonWriter копирует его сразу
+      char field[40];
+      for (uint8_t ch = 0; ch < channels.size(); ch++) {
+        JsonObjectConst channelObj = channels[ch].as<JsonObjectConst>();
+        ChannelSettings& channel = target.channels[ch];
+        bool isValid = !channelObj.isNull();
+
+        snprintf(field, sizeof(field), "control.channels[%u].minTrigger", ch);
+        isValid = isValid && patcher.patchCm(channelObj, "minTrigger", field, channel.minTriggerMm, false);
+        snprintf(field, sizeof(field), "control.channels[%u].maxTrigger", ch);
+        isValid = isValid && patcher.patchCm(channelObj, "maxTrigger", field, channel.maxTriggerMm, false);
+        snprintf(field, sizeof(field), "control.channels[%u].pin_pump", ch);
+        isValid = isValid && patcher.patchInt(channelObj, "pin_pump", field, channel.pin_pump, MIN_PIN, MAX_PIN, true);
+        snprintf(field, sizeof(field), "control.channels[%u].pin_echo", ch);
+        isValid = isValid && patcher.patchInt(channelObj, "pin_echo", field, channel.pin_echo, MIN_PIN, MAX_PIN, true);
+        snprintf(field, sizeof(field), "control.channels[%u].pin_trig", ch);
+        isValid = isValid && patcher.patchInt(channelObj, "pin_trig", field, channel.pin_trig, MIN_PIN, MAX_PIN, true);
+
+        if (!isValid) {
+          result.invalidField = "control.channels";
+          return false;
+        }
+      }
+    }
+
+    // Поля control.* описывают канал 0, как и в deserializeSettings
+    ChannelSettings& primary = target.channels[0];
+    if (!patcher.patchCm(control, "minTrigger", "control.minTrigger", primary.minTriggerMm, false)) return false;
+    if (!patcher.patchCm(control, "maxTrigger", "control.maxTrigger", primary.maxTriggerMm, false)) return false;
+    if (!patcher.patchInt(control, "pin_pump", "control.pin_pump", primary.pin_pump, MIN_PIN, MAX_PIN, true)) return false;
+    if (!patcher.patchInt(control, "pin_echo", "control.pin_echo", primary.pin_echo, MIN_PIN, MAX_PIN, true)) return false;
+    if (!patcher.patchInt(control, "pin_trig", "control.pin_trig", primary.pin_trig, MIN_PIN, MAX_PIN, true)) return false;
+
+    // Пороги применяются сразу, а пришедший без пары порог может вывернуть
+    // полосу гистерезиса: насос начнёт щёлкать на каждом отсчёте
+    for (uint8_t ch = 0; ch < target.channelCount; ch++) {
+      const ChannelSettings& channel = target.channels[ch];
+      if (channel.minTriggerMm < channel.maxTriggerMm) continue;
+
+      bool isPrimaryForm = (ch == 0) && firstChannel.isNull() &&
+                           (!control["minTrigger"].isNull() || !control["maxTrigger"].isNull());
+      JsonObjectConst source = isPrimaryForm ? control : control["channels"][ch].as<JsonObjectConst>();
+      const char* key = (!source.isNull() && source["minTrigger"].isNull() && !source["maxTrigger"].isNull()) ? "maxTrigger" : "minTrigger";
+      if (isPrimaryForm) {
+        snprintf(result.invalidFieldName, sizeof(result.invalidFieldName), "control.%s", key);
+      } else {
+        snprintf(result.invalidFieldName, sizeof(result.invalidFieldName), "control.channels[%u].%s", ch, key);
+      }
+      result.invalidField = result.invalidFieldName;
+      return false;
+    }
+  }
+
+  if (!patcher.patchBool(patch, "isWifiTurnedOn", "isWifiTurnedOn", settings.isWifiTurnedOn, true)) return false;
+  if (!patcher.patchNetworks(patch, "networkSettings", settings.networkSettings)) return false;
+
+  if (!patcher.patchBool(patch, "isAP", "isAP", settings.isAP, true)) return false;
+  if (!patcher.patchString(patch, "ssidAP", "ssidAP", settings.ssidAP, true)) return false;
+  if (!patcher.patchString(patch, "passwordAP", "passwordAP", settings.passwordAP, true)) return false;
+  if (!patcher.patchIp(patch, "staticIpAP", "staticIpAP", settings.staticIpAP, true)) return false;
+
+  if (!patcher.patchString(patch, "mDNS", "mDNS", settings.mDNS, true)) return false;
+  if (!patcher.patchBool(patch, "autoReconnect", "autoReconnect", settings.autoReconnect, false)) return false;
+  if (!patcher.patchInt(patch, "timeZone", "timeZone", settings.timeZone, -12, 14, false)) return false;
+
+  if (!patcher.patchCm(patch, "liveDeadband", "liveDeadband", settings.liveDeadbandMm, false)) return false;
+  if (!patcher.patchInt(patch, "liveHeartbeatSec", "liveHeartbeatSec", settings.liveHeartbeatSec, 1, 3600, false)) return false;
+
   return true;
 }
+
+void SettingsManager::fillPatchFilter(JsonDocument& filter) {
+  JsonObject control = filter.createNestedObject("control");
+  static const char* const controlKeys[] = {
+    "channelCount", "sampleIntervalMs", "pin_led", "pin_button",
+    "minTrigger", "maxTrigger", "pin_pump", "pin_echo", "pin_trig"
+  };
+  for (const char* key : controlKeys) control[key] = true;
+
+  // Фильтр первого элемента массива действует на все элементы
+  JsonObject channel = control.createNestedArray("channels").createNestedObject();
+  static const char* const channelKeys[] = { "minTrigger", "maxTrigger", "pin_pump", "pin_echo", "pin_trig" };
+  for (const char* key : channelKeys) channel[key] = true;
+
+  JsonObject network = filter.createNestedArray("networkSettings").createNestedObject();
+  static const char* const networkKeys[] = {
+    "ssid", "password", "useStaticIP", "staticIP", "staticGateway", "staticSubnet", "staticDNS"
+  };
+  for (const char* key : networkKeys) network[key] = true;
+
+  static const char* const rootKeys[] = {
+    "isWifiTurnedOn", "isAP", "ssidAP", "passwordAP", "staticIpAP",
+    "mDNS", "autoReconnect", "timeZone", "liveDeadband", "liveHeartbeatSec"
+  };
+  for (const char* key : rootKeys) filter[key] = true;
+}
@@ -7,18 +7,9 @@
 #include <WString.h>
 #include <ArduinoJson.h>
 #include <FS.h>
-
-struct PumpControlSettings {
-  float minTrigger;
-  float maxTrigger;
-  float currentDistance;
-  int pin_pump;
-  int pin_led;
-  int pin_button;
-  int pin_echo;
-  int pin_trig;
-  bool manualMode_pump;
-};
+#include "profiler.h"
+#include "control_settings.h"
+#include "json_writer.h"
 
 struct NetworkSetting {
   String ssid;
@@ -46,10 +37,22 @@ struct DeviceSettings {
   bool autoReconnect = true;
   int8_t timeZone = 3;
 
+  // Рассылка /liveEvents: порог изменения расстояния и период "пульса"
+  uint16_t liveDeadbandMm = 10;
+  uint16_t liveHeartbeatSec = 15;
+
   bool isSaveRequested = false;
   bool isRebootRequested = false;
 };
 
+// Итог частичного обновления настроек
+struct SettingsPatchResult {
+  uint8_t changedCount = 0;
+  bool needsReboot = false;
+  const char* invalidField = nullptr;
+  char invalidFieldName[40] = "";   // для имён полей каналов, invalidField указывает сюда
+};
+
 class SettingsManager {
 public:
     SettingsManager();
@@ -65,9 +68,16 @@ public:
 
     DeviceSettings settings;
 
-    String serializeSettings(const DeviceSettings& settings);
+    void writeSettings(Print& out, const DeviceSettings& settings);
     bool deserializeSettings(JsonObject doc, DeviceSettings& settings);
 
+    // Применяет только поля, присутствующие в patch, имена изменившихся пишет
+    // в changed элементами массива. При ошибке settings может остаться
+    // изменённым частично, поэтому патч применяют к копии.
+    bool patchSettings(JsonObjectConst patch, DeviceSettings& settings, JsonWriter& changed, SettingsPatchResult& result);
+    // Фильтр разбора: всё, чего нет в patchSettings, отбрасывается при разборе
+    void fillPatchFilter(JsonDocument& filter);
+
 private:
     bool spiffsMounted = false;
 };
@@ -0,0 +1,114 @@
+#include "sonar.h"
+
+SonarSampler* SonarSampler::_instance = nullptr;
+
+SonarSampler::SonarSampler() {}
+
+bool SonarSampler::addChannel(int pinTrig, int pinEcho) {
+    if (_isStarted || _channelCount >= MAX_CHANNELS) return false;
+
+    _pinTrig[_channelCount] = pinTrig;
+    _pinEcho[_channelCount] = pinEcho;
+    _channelCount++;
+    return true;
+}
+
+void SonarSampler::begin(uint16_t maxDistanceMm) {
+    _maxEchoUs = ((unsigned long)maxDistanceMm * US_ROUNDTRIP_CM + MM_PER_CM / 2) / MM_PER_CM;
+
+    _instance = this;
+    for (uint8_t ch = 0; ch < _channelCount; ch++) {
+        pinMode(_pinTrig[ch], OUTPUT);
+        digitalWrite(_pinTrig[ch], LOW);
+        pinMode(_pinEcho[ch], INPUT);
+        attachInterrupt(digitalPinToInterrupt(_pinEcho[ch]), _onEchoChange, CHANGE);
+    }
+    _isStarted = _channelCount > 0;
+
+    Serial.printf("SonarSampler: %u sensor(s), interval %lu ms, ping spacing %lu ms.\n",
+                  _channelCount, _intervalMs, _pingSpacingMs());
+}
+
+void SonarSampler::setInterval(unsigned long intervalMs) {
+    _intervalMs = (intervalMs < MIN_INTERVAL_MS) ? MIN_INTERVAL_MS : intervalMs;
+}
+
+bool SonarSampler::poll(uint8_t& channel, uint16_t& distanceMm) {
+    if (!_isStarted) return false;
+
+    if (_isWaiting) {
+        if (_isEchoDone) {
+            _isWaiting = false;
+            channel = _activeChannel;
+            distanceMm = _toMm(_echoUs);
+            return true;
+        }
+
+        if (micros() - _triggerUs > _maxEchoUs + SENSOR_DELAY_US) {
+            noInterrupts();
+            _isEchoStarted = false;
+            interrupts();
+            _isWaiting = false;
+            channel = _activeChannel;
+            distanceMm = 0;
+            return true;
+        }
+        return false;
+    }
+
+    if (millis() - _lastTriggerMs >= _pingSpacingMs()) {
+        _trigger(_nextChannel);
+        _nextChannel = (_nextChannel + 1) % _channelCount;
+    }
+    return false;
+}
+
+unsigned long SonarSampler::getChannelPeriodMs() const {
+    return _pingSpacingMs() * (_channelCount > 1 ? _channelCount : 1);
+}
+
+unsigned long SonarSampler::_pingSpacingMs() const {
+    if (_channelCount <= 1) return _intervalMs;
+    unsigned long spacing = _intervalMs / _channelCount;
+    return (spacing < MIN_INTERVAL_MS) ? MIN_INTERVAL_MS : spacing;
+}
+
+void SonarSampler::_trigger(uint8_t channel) {
+    noInterrupts();
+    _activeChannel = channel;
+    _isEchoStarted = false;
+    _isEchoDone = false;
+    interrupts();
+
+    // Только импульс запуска 10 мкс, эхо измеряется в прерывании
+    digitalWrite(_pinTrig[channel], HIGH);
+    delayMicroseconds(10);
+    digitalWrite(_pinTrig[channel], LOW);
+
+    _triggerUs = micros();
+    _lastTriggerMs = millis();
+    _isWaiting = true;
+}
+
+uint16_t SonarSampler::_toMm(unsigned long echoUs) const {
+    if (echoUs == 0 || echoUs > _maxEchoUs) return 0;
+    return (echoUs * MM_PER_CM + US_ROUNDTRIP_CM / 2) / US_ROUNDTRIP_CM;
+}
+
+void IRAM_ATTR SonarSampler::_onEchoChange() {
+    SonarSampler* self = _instance;
+    if (!self || self->_isEchoDone) return;
+
+    // Прерывание общее для всех эхо-входов, поэтому смотрим только на
+    // фронты активного датчика.
+    unsigned long now = micros();
+    bool isHigh = digitalRead(self->_pinEcho[self->_activeChannel]) == HIGH;
+    if (isHigh && !self->_isEchoStarted) {
+        self->_echoStartUs = now;
+        self->_isEchoStarted = true;
+    } else if (!isHigh && self->_isEchoStarted) {
+        self->_echoUs = now - self->_echoStartUs;
+        self->_isEchoStarted = false;
+        self->_isEchoDone = true;
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef SONAR_H
+#define SONAR_H
+
+#include <Arduino.h>
+
+// Датчики опрашиваются по очереди: следующий импульс запуска подаётся только
+// после эха (или таймаута) предыдущего, чтобы эхо соседних баков не смешивалось.
+class SonarSampler {
+public:
+    static const uint8_t MAX_CHANNELS = 8;
+
+    SonarSampler();
+    bool addChannel(int pinTrig, int pinEcho);
+    void begin(uint16_t maxDistanceMm);
+    void setInterval(unsigned long intervalMs);
+    bool poll(uint8_t& channel, uint16_t& distanceMm);
+    // Период между отсчётами одного канала с учётом очереди и минимального шага
+    unsigned long getChannelPeriodMs() const;
+
+private:
+    static SonarSampler* _instance;
+    static void IRAM_ATTR _onEchoChange();
+
+    int _pinTrig[MAX_CHANNELS];
+    int _pinEcho[MAX_CHANNELS];
+    uint8_t _channelCount = 0;
+    uint8_t _nextChannel = 0;
+    unsigned long _maxEchoUs = 0;
+    unsigned long _intervalMs = 50;
+
+    bool _isStarted = false;
+    bool _isWaiting = false;
+    unsigned long _lastTriggerMs = 0;
+    unsigned long _triggerUs = 0;
+
+    volatile uint8_t _activeChannel = 0;
+    volatile unsigned long _echoStartUs = 0;
+    volatile unsigned long _echoUs = 0;
+    volatile bool _isEchoStarted = false;
+    volatile bool _isEchoDone = false;
+
+    static const unsigned long US_ROUNDTRIP_CM = 57;
+    static const unsigned long MM_PER_CM = 10;
+    static const unsigned long MIN_INTERVAL_MS = 30;
+    static const unsigned long SENSOR_DELAY_US = 5800;
+
+    unsigned long _pingSpacingMs() const;
+    void _trigger(uint8_t channel);
+    uint16_t _toMm(unsigned long echoUs) const;
+};
+
+#endif
@@ -0,0 +1,108 @@
+#include "sonar_trace.h"
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+void SonarTraceRecorder::record(unsigned long nowMs, uint16_t rawMm, bool isPumpOn, bool isManual) {
+    unsigned long delta = (_total == 0) ? 0 : nowMs - _lastMs;
+    _lastMs = nowMs;
+
+    SonarTraceRecord& rec = _ring[_total % RING_SIZE];
+    rec.deltaMs = (delta > 0xFFFF) ? 0xFFFF : delta;
+    rec.value = (rawMm & SONAR_TRACE_DISTANCE_MASK) |
+                (isManual ? SONAR_TRACE_MANUAL_BIT : 0) |
+                (isPumpOn ? SONAR_TRACE_PUMP_BIT : 0);
+    _total++;
+}
+
+size_t SonarTraceRecorder::getCount() const {
+    return (_total < RING_SIZE) ? _total : RING_SIZE;
+}
+
+uint32_t SonarTraceRecorder::getTotalRecorded() const {
+    return _total;
+}
+
+const SonarTraceRecord& SonarTraceRecorder::getRecord(size_t index) const {
+    uint32_t first = _total - getCount();
+    return _ring[(first + index) % RING_SIZE];
+}
+
+bool SonarTraceRecorder::getRecordBySequence(uint32_t sequence, SonarTraceRecord& record) const {
+    if (sequence >= _total || _total - sequence > getCount()) return false;
+    record = _ring[sequence % RING_SIZE];
+    return true;
+}
+
+void SonarTraceRecorder::fillHeader(SonarTraceHeader& header) {
+    memcpy(header.magic, "PTRC", 4);
+    header.version = SONAR_TRACE_VERSION;
+    header.recordSize = sizeof(SonarTraceRecord);
+}
+
+#ifdef ARDUINO
+
+bool SonarTraceRecorder::startFlashSpill() {
+    stopFlashSpill();
+
+    _file = SPIFFS.open("/sonar_trace.bin", "w");
+    if (!_file) {
+        Serial.println("SonarTrace: Failed to open /sonar_trace.bin for writing.");
+        return false;
+    }
+
+    SonarTraceHeader header;
+    fillHeader(header);
+    _file.write((const uint8_t*)&header, sizeof(header));
+
+    _flushed = _total;
+    _lost = 0;
+    _isSpilling = true;
+    Serial.println("SonarTrace: Recording raw pings to /sonar_trace.bin");
+    return true;
+}
+
+void SonarTraceRecorder::stopFlashSpill() {
+    if (!_isSpilling) return;
+
+    flush();
+    _file.close();
+    _isSpilling = false;
+    Serial.printf("SonarTrace: Flash recording stopped, %u records lost to ring overflow.\n", (unsigned)_lost);
+}
+
+bool SonarTraceRecorder::isFlashSpillActive() const {
+    return _isSpilling;
+}
+
+void SonarTraceRecorder::flush() {
+    if (!_isSpilling) return;
+
+    if (_total - _flushed > RING_SIZE) {
+        _lost += _total - _flushed - RING_SIZE;
+        _flushed = _total - RING_SIZE;
+    }
+
+    while (_flushed < _total) {
+        if (_file.size() + sizeof(SonarTraceRecord) > MAX_FILE_SIZE) {
+            Serial.println("SonarTrace: Trace file is full.");
+            _file.close();
+            _isSpilling = false;
+            return;
+        }
+
+        uint32_t index = _flushed % RING_SIZE;
+        uint32_t count = _total - _flushed;
+        if (index + count > RING_SIZE) count = RING_SIZE - index;
+        uint32_t room = (MAX_FILE_SIZE - _file.size()) / sizeof(SonarTraceRecord);
+        if (count > room) count = room;
+
+        _file.write((const uint8_t*)&_ring[index], count * sizeof(SonarTraceRecord));
+        _flushed += count;
+    }
+    _file.flush();
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef SONAR_TRACE_H
+#define SONAR_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef ARDUINO
+#include <FS.h>
+#endif
+
+// Формат трассы (RAM, файл /sonar_trace.bin, выгрузка /getSonarTrace):
+// заголовок SonarTraceHeader, затем записи SonarTraceRecord по 4 байта.
+// value: биты 0-13 - сырое расстояние в мм, бит 14 - ручной режим,
+// бит 15 - состояние насоса после обработки этого отсчёта.
+
+struct SonarTraceHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t recordSize;
+};
+
+struct SonarTraceRecord {
+    uint16_t deltaMs;
+    uint16_t value;
+};
+
+static const uint16_t SONAR_TRACE_VERSION = 1;
+static const uint16_t SONAR_TRACE_DISTANCE_MASK = 0x3FFF;
+static const uint16_t SONAR_TRACE_MANUAL_BIT = 0x4000;
+static const uint16_t SONAR_TRACE_PUMP_BIT = 0x8000;
+
+class SonarTraceRecorder {
+public:
+    static const uint16_t RING_SIZE = 512;
+
+    void record(unsigned long nowMs, uint16_t rawMm, bool isPumpOn, bool isManual);
+
+    size_t getCount() const;
+    uint32_t getTotalRecorded() const;
+    const SonarTraceRecord& getRecord(size_t index) const;
+    // Запись по абсолютному номеру (0 - первая с момента запуска);
+    // false, если она ещё не записана или уже вытеснена из кольца
+    bool getRecordBySequence(uint32_t sequence, SonarTraceRecord& record) const;
+    static void fillHeader(SonarTraceHeader& header);
+
+#ifdef ARDUINO
+    bool startFlashSpill();
+    void stopFlashSpill();
+    bool isFlashSpillActive() const;
+    void flush();
+#endif
+
+private:
+    SonarTraceRecord _ring[RING_SIZE];
+    uint32_t _total = 0;
+    unsigned long _lastMs = 0;
+
+#ifdef ARDUINO
+    static const uint32_t MAX_FILE_SIZE = 65536;
+
+    File _file;
+    bool _isSpilling = false;
+    uint32_t _flushed = 0;
+    uint32_t _lost = 0;
+#endif
+};
+
+#endif
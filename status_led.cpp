@@ -0,0 +1,89 @@
+#include "status_led.h"
+
+namespace {
+
+const LedStep IDLE_STEPS[] = { {80, 1} };
+const LedStep PUMP_ON_STEPS[] = { {200, 1} };
+const LedStep CONNECTING_STEPS[] = { {StatusLed::DUTY_FULL, 2}, {0, 8} };
+const LedStep AP_STEPS[] = { {StatusLed::DUTY_FULL, 2}, {0, 2}, {StatusLed::DUTY_FULL, 2}, {0, 14} };
+const LedStep ERROR_STEPS[] = { {StatusLed::DUTY_FULL, 3}, {0, 3} };
+
+struct LedPatternDef {
+    const LedStep* steps;
+    uint8_t count;
+};
+
+const LedPatternDef PATTERNS[LED_PATTERN_COUNT] = {
+    { IDLE_STEPS, sizeof(IDLE_STEPS) / sizeof(LedStep) },
+    { PUMP_ON_STEPS, sizeof(PUMP_ON_STEPS) / sizeof(LedStep) },
+    { CONNECTING_STEPS, sizeof(CONNECTING_STEPS) / sizeof(LedStep) },
+    { AP_STEPS, sizeof(AP_STEPS) / sizeof(LedStep) },
+    { ERROR_STEPS, sizeof(ERROR_STEPS) / sizeof(LedStep) },
+};
+
+}
+
+void StatusLed::begin(int pin) {
+    _pin = pin;
+    hal::pinOutput(_pin);
+    _isWritten = false;
+    tick();
+
+#ifdef ARDUINO
+    _ticker.attach_ms(TICK_MS, _onTick, this);
+#endif
+}
+
+void StatusLed::setActive(LedPattern pattern, bool isActive) {
+    if (pattern == LED_PATTERN_IDLE) return;
+
+    uint8_t bit = 1 << pattern;
+    if (isActive) {
+        _activeMask |= bit;
+    } else {
+        _activeMask &= ~bit;
+    }
+}
+
+LedPattern StatusLed::getPattern() const {
+    uint8_t mask = _activeMask;
+    return (LedPattern)(31 - __builtin_clz(mask));
+}
+
+void StatusLed::tick() {
+    if (_pin < 0) return;
+
+    uint8_t pattern = getPattern();
+    if (pattern != _pattern) {
+        _pattern = pattern;
+        _step = 0;
+    } else if (--_ticksLeft > 0) {
+        return;
+    } else {
+        _step = (_step + 1) % PATTERNS[_pattern].count;
+    }
+
+    const LedStep& step = PATTERNS[_pattern].steps[_step];
+    _ticksLeft = step.ticks;
+    _write(step.duty);
+}
+
+void StatusLed::_write(int16_t duty) {
+    if (_isWritten && duty == _writtenDuty) return;
+
+    if (duty == DUTY_FULL) {
+        hal::writePin(_pin, true);
+    } else if (duty == 0) {
+        hal::writePin(_pin, false);
+    } else {
+        hal::writePwm(_pin, duty);
+    }
+    _writtenDuty = duty;
+    _isWritten = true;
+}
+
+#ifdef ARDUINO
+void StatusLed::_onTick(StatusLed* self) {
+    self->tick();
+}
+#endif
@@ -0,0 +1,58 @@
+#ifndef STATUS_LED_H
+#define STATUS_LED_H
+
+#include <stdint.h>
+#include "hal.h"
+
+#ifdef ARDUINO
+#include <Ticker.h>
+#endif
+
+// Чем больше значение, тем выше приоритет: при нескольких активных
+// состояниях играет шаблон с наибольшим номером.
+enum LedPattern : uint8_t {
+    LED_PATTERN_IDLE = 0,
+    LED_PATTERN_PUMP_ON,
+    LED_PATTERN_CONNECTING,
+    LED_PATTERN_AP,
+    LED_PATTERN_ERROR,
+    LED_PATTERN_COUNT
+};
+
+struct LedStep {
+    int16_t duty;     // DUTY_FULL - светодиод включён полностью, 0 - выключен
+    uint8_t ticks;
+};
+
+// Светодиод ведётся таймером (Ticker), а не из loop(): мигание не зависит
+// от датчика и блокировок, а вывод пишется только при смене шага.
+class StatusLed {
+public:
+    static const int16_t DUTY_FULL = -1;
+    static const unsigned long TICK_MS = 50;
+
+    void begin(int pin);
+    void setActive(LedPattern pattern, bool isActive);
+    LedPattern getPattern() const;
+
+    // Вызывается таймером; в симуляции - вручную
+    void tick();
+
+private:
+    int _pin = -1;
+    volatile uint8_t _activeMask = 1 << LED_PATTERN_IDLE;
+    uint8_t _pattern = LED_PATTERN_COUNT;
+    uint8_t _step = 0;
+    uint8_t _ticksLeft = 0;
+    int16_t _writtenDuty = 0;
+    bool _isWritten = false;
+
+#ifdef ARDUINO
+    Ticker _ticker;
+    static void _onTick(StatusLed* self);
+#endif
+
+    void _write(int16_t duty);
+};
+
+#endif
@@ -0,0 +1,402 @@
+#include "telemetry_store.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <FS.h>
+#else
+#include <dirent.h>
+#include "hal_sim.h"
+#endif
+
+// Файл сегмента, открытый на чтение: бинарный поиск и проход по сегменту
+// читают через один дескриптор, а не открывают файл на каждую запись
+class TelemetryStore::SegmentReader {
+public:
+    SegmentReader(const TelemetryStore& store, uint32_t id);
+    ~SegmentReader();
+    SegmentReader(const SegmentReader&) = delete;
+    SegmentReader& operator=(const SegmentReader&) = delete;
+
+    size_t read(uint32_t index, TelemetryRecord* records, size_t count);
+
+private:
+#ifdef ARDUINO
+    File _file;
+#else
+    FILE* _file;
+#endif
+};
+
+namespace {
+
+const uint8_t MAX_LISTED_SEGMENTS = 64;
+
+void sortIds(uint32_t* ids, uint8_t count) {
+    for (uint8_t i = 1; i < count; i++) {
+        uint32_t id = ids[i];
+        uint8_t j = i;
+        while (j > 0 && ids[j - 1] > id) {
+            ids[j] = ids[j - 1];
+            j--;
+        }
+        ids[j] = id;
+    }
+}
+
+}
+
+TelemetryStore::TelemetryStore(const char* root) {
+    strncpy(_root, root, sizeof(_root) - 1);
+    _root[sizeof(_root) - 1] = '\0';
+}
+
+bool TelemetryStore::begin() {
+    uint32_t ids[MAX_LISTED_SEGMENTS];
+    uint8_t count = _listSegments(ids, MAX_LISTED_SEGMENTS);
+    sortIds(ids, count);
+
+    _segmentCount = 0;
+    _nextId = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        // Лишние сегменты (например, после уменьшения SEGMENT_COUNT) удаляются
+        if (count - i > SEGMENT_COUNT) {
+            _removeSegment(ids[i]);
+            continue;
+        }
+
+        TelemetrySegmentInfo info;
+        if (!_scanSegment(ids[i], info)) {
+            _removeSegment(ids[i]);
+            continue;
+        }
+        _segments[_segmentCount++] = info;
+        _nextId = ids[i] + 1;
+    }
+
+    _timeBase = 0;
+    for (uint8_t i = _segmentCount; i > 0; i--) {
+        if (_segments[i - 1].count > 0) {
+            _timeBase = _segments[i - 1].lastTs + 1;
+            break;
+        }
+    }
+
+    Serial.printf("TelemetryStore: %u segment(s) in %s, time continues at %lu s.\n",
+                  _segmentCount, _root, (unsigned long)_timeBase);
+    return true;
+}
+
+bool TelemetryStore::append(unsigned long nowMs, uint16_t distanceMm, uint8_t flags, uint8_t channel) {
+    if (!_hasTime) {
+        _lastMs = nowMs;
+        _hasTime = true;
+    }
+    _msRemainder += nowMs - _lastMs;
+    _lastMs = nowMs;
+    _elapsedSec += _msRemainder / 1000;
+    _msRemainder %= 1000;
+
+    TelemetryRecord& record = _batch[_batchCount++];
+    record.timestamp = getTime();
+    record.distanceMm = distanceMm;
+    record.flags = flags;
+    record.channel = channel;
+    record.reserved = 0;
+    record.crc = crc16((const uint8_t*)&record, offsetof(TelemetryRecord, crc));
+
+    if (_batchCount < BATCH_RECORDS) return true;
+    return flush();
+}
+
+bool TelemetryStore::flush() {
+    size_t written = 0;
+    while (written < _batchCount) {
+        if (_segmentCount == 0 || _segments[_segmentCount - 1].isSealed) {
+            _openSegment();
+        }
+
+        TelemetrySegmentInfo& segment = _segments[_segmentCount - 1];
+        size_t count = _batchCount - written;
+        if (count > (size_t)(SEGMENT_RECORDS - segment.count)) count = SEGMENT_RECORDS - segment.count;
+
+        if (!_writeRecords(segment.id, _batch + written, count)) {
+            // Что успело дописаться, проверится CRC при следующем старте
+            Serial.printf("TelemetryStore: Write to segment %lx failed, %u record(s) dropped.\n",
+                          (unsigned long)segment.id, (unsigned)(_batchCount - written));
+            segment.isSealed = true;
+            _batchCount = 0;
+            return false;
+        }
+
+        if (segment.count == 0) segment.firstTs = _batch[written].timestamp;
+        segment.lastTs = _batch[written + count - 1].timestamp;
+        segment.count += count;
+        if (segment.count >= SEGMENT_RECORDS) segment.isSealed = true;
+        written += count;
+    }
+
+    _batchCount = 0;
+    return true;
+}
+
+uint32_t TelemetryStore::getTime() const {
+    return _timeBase + _elapsedSec;
+}
+
+size_t TelemetryStore::query(uint32_t fromTs, uint32_t toTs, Visitor visitor, void* context) const {
+    size_t visited = 0;
+    _lastQuerySegments = 0;
+
+    TelemetryRecord records[BATCH_RECORDS];
+    for (uint8_t i = 0; i < _segmentCount; i++) {
+        const TelemetrySegmentInfo& segment = _segments[i];
+        if (segment.count == 0 || segment.lastTs < fromTs) continue;
+        if (segment.firstTs > toTs) break;
+
+        _lastQuerySegments++;
+        SegmentReader reader(*this, segment.id);
+        uint32_t index = _lowerBound(reader, segment, fromTs);
+        while (index < segment.count) {
+            size_t count = segment.count - index;
+            if (count > BATCH_RECORDS) count = BATCH_RECORDS;
+            count = reader.read(index, records, count);
+            if (count == 0) break;
+            index += count;
+
+            for (size_t r = 0; r < count; r++) {
+                const TelemetryRecord& record = records[r];
+                if (!_isValid(record) || record.timestamp < fromTs) continue;
+                if (record.timestamp > toTs) return visited;
+                visited++;
+                if (!visitor(record, context)) return visited;
+            }
+        }
+    }
+
+    // Записи, ещё не сброшенные на флеш
+    for (uint8_t r = 0; r < _batchCount; r++) {
+        const TelemetryRecord& record = _batch[r];
+        if (record.timestamp < fromTs) continue;
+        if (record.timestamp > toTs) break;
+        visited++;
+        if (!visitor(record, context)) break;
+    }
+    return visited;
+}
+
+uint8_t TelemetryStore::getSegmentCount() const {
+    return _segmentCount;
+}
+
+const TelemetrySegmentInfo& TelemetryStore::getSegment(uint8_t index) const {
+    return _segments[index];
+}
+
+uint8_t TelemetryStore::getLastQuerySegments() const {
+    return _lastQuerySegments;
+}
+
+uint16_t TelemetryStore::crc16(const uint8_t* data, size_t length) {
+    // CRC-16/CCITT-FALSE
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+void TelemetryStore::_openSegment() {
+    if (_segmentCount >= SEGMENT_COUNT) _dropOldestSegment();
+
+    TelemetrySegmentInfo& segment = _segments[_segmentCount++];
+    segment.id = _nextId++;
+    segment.firstTs = 0;
+    segment.lastTs = 0;
+    segment.count = 0;
+    segment.isSealed = false;
+}
+
+void TelemetryStore::_dropOldestSegment() {
+    _removeSegment(_segments[0].id);
+    memmove(_segments, _segments + 1, (_segmentCount - 1) * sizeof(TelemetrySegmentInfo));
+    _segmentCount--;
+}
+
+bool TelemetryStore::_scanSegment(uint32_t id, TelemetrySegmentInfo& info) const {
+    size_t size = _segmentSize(id);
+    uint32_t count = size / sizeof(TelemetryRecord);
+    if (count > SEGMENT_RECORDS) count = SEGMENT_RECORDS;
+
+    info.id = id;
+    info.count = count;
+    // Дописывать можно только в целый сегмент: после обрыва записи он закрыт
+    info.isSealed = (count >= SEGMENT_RECORDS) || (size % sizeof(TelemetryRecord) != 0);
+
+    SegmentReader reader(*this, id);
+    TelemetryRecord record;
+    uint32_t first = 0;
+    while (first < count && (reader.read(first, &record, 1) != 1 || !_isValid(record))) first++;
+    if (first == count) return false;
+    info.firstTs = record.timestamp;
+
+    uint32_t last = count;
+    while (last > first && (reader.read(last - 1, &record, 1) != 1 || !_isValid(record))) last--;
+    info.lastTs = record.timestamp;
+    if (last < count) info.isSealed = true;
+    return true;
+}
+
+uint32_t TelemetryStore::_lowerBound(SegmentReader& reader, const TelemetrySegmentInfo& info, uint32_t ts) const {
+    if (ts <= info.firstTs) return 0;
+
+    // Повреждённая запись считается "не раньше ts": поиск сдвигается влево,
+    // и лишние записи отсеет линейный проход
+    uint32_t low = 0;
+    uint32_t high = info.count;
+    TelemetryRecord record;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (reader.read(mid, &record, 1) == 1 && _isValid(record) && record.timestamp < ts) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+bool TelemetryStore::_isValid(const TelemetryRecord& record) {
+    return record.crc == crc16((const uint8_t*)&record, offsetof(TelemetryRecord, crc));
+}
+
+void TelemetryStore::_segmentPath(uint32_t id, char* path, size_t size) const {
+    snprintf(path, size, "%s/%08lx", _root, (unsigned long)id);
+}
+
+#ifdef ARDUINO
+
+bool TelemetryStore::_writeRecords(uint32_t id, const TelemetryRecord* records, size_t count) {
+    char path[32];
+    _segmentPath(id, path, sizeof(path));
+    File file = SPIFFS.open(path, "a");
+    if (!file) return false;
+
+    size_t bytes = count * sizeof(TelemetryRecord);
+    bool isWritten = file.write((const uint8_t*)records, bytes) == bytes;
+    file.close();
+    return isWritten;
+}
+
+TelemetryStore::SegmentReader::SegmentReader(const TelemetryStore& store, uint32_t id) {
+    char path[32];
+    store._segmentPath(id, path, sizeof(path));
+    _file = SPIFFS.open(path, "r");
+}
+
+TelemetryStore::SegmentReader::~SegmentReader() {
+    if (_file) _file.close();
+}
+
+size_t TelemetryStore::SegmentReader::read(uint32_t index, TelemetryRecord* records, size_t count) {
+    if (!_file || !_file.seek(index * sizeof(TelemetryRecord), SeekSet)) return 0;
+
+    size_t bytes = _file.read((uint8_t*)records, count * sizeof(TelemetryRecord));
+    return bytes / sizeof(TelemetryRecord);
+}
+
+size_t TelemetryStore::_segmentSize(uint32_t id) const {
+    char path[32];
+    _segmentPath(id, path, sizeof(path));
+    File file = SPIFFS.open(path, "r");
+    if (!file) return 0;
+
+    size_t size = file.size();
+    file.close();
+    return size;
+}
+
+void TelemetryStore::_removeSegment(uint32_t id) {
+    char path[32];
+    _segmentPath(id, path, sizeof(path));
+    SPIFFS.remove(path);
+}
+
+uint8_t TelemetryStore::_listSegments(uint32_t* ids, uint8_t maxIds) const {
+    uint8_t count = 0;
+    size_t rootLength = strlen(_root);
+    Dir dir = SPIFFS.openDir(_root);
+    while (dir.next() && count < maxIds) {
+        String name = dir.fileName();
+        if (name.length() <= rootLength + 1 || name[rootLength] != '/') continue;
+        ids[count++] = strtoul(name.c_str() + rootLength + 1, nullptr, 16);
+    }
+    return count;
+}
+
+#else
+
+bool TelemetryStore::_writeRecords(uint32_t id, const TelemetryRecord* records, size_t count) {
+    char path[64];
+    _segmentPath(id, path, sizeof(path));
+    FILE* file = fopen(path, "ab");
+    if (!file) return false;
+
+    bool isWritten = fwrite(records, sizeof(TelemetryRecord), count, file) == count;
+    fclose(file);
+    return isWritten;
+}
+
+TelemetryStore::SegmentReader::SegmentReader(const TelemetryStore& store, uint32_t id) {
+    char path[64];
+    store._segmentPath(id, path, sizeof(path));
+    _file = fopen(path, "rb");
+}
+
+TelemetryStore::SegmentReader::~SegmentReader() {
+    if (_file) fclose(_file);
+}
+
+size_t TelemetryStore::SegmentReader::read(uint32_t index, TelemetryRecord* records, size_t count) {
+    if (!_file || fseek(_file, index * sizeof(TelemetryRecord), SEEK_SET) != 0) return 0;
+    return fread(records, sizeof(TelemetryRecord), count, _file);
+}
+
+size_t TelemetryStore::_segmentSize(uint32_t id) const {
+    char path[64];
+    _segmentPath(id, path, sizeof(path));
+    FILE* file = fopen(path, "rb");
+    if (!file) return 0;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return (size < 0) ? 0 : size;
+}
+
+void TelemetryStore::_removeSegment(uint32_t id) {
+    char path[64];
+    _segmentPath(id, path, sizeof(path));
+    remove(path);
+}
+
+uint8_t TelemetryStore::_listSegments(uint32_t* ids, uint8_t maxIds) const {
+    uint8_t count = 0;
+    DIR* dir = opendir(_root);
+    if (!dir) return 0;
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr && count < maxIds) {
+        if (entry->d_name[0] == '.') continue;
+        ids[count++] = strtoul(entry->d_name, nullptr, 16);
+    }
+    closedir(dir);
+    return count;
+}
+
+#endif
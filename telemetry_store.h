@@ -0,0 +1,107 @@
+#ifndef TELEMETRY_STORE_H
+#define TELEMETRY_STORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef TELEMETRY_SEGMENT_COUNT
+#define TELEMETRY_SEGMENT_COUNT 16
+#endif
+
+#ifndef TELEMETRY_SEGMENT_RECORDS
+#define TELEMETRY_SEGMENT_RECORDS 1365
+#endif
+
+// Журнал телеметрии на флеше. Записи фиксированного размера с CRC только
+// дописываются в конец сегмента (файла <root>/<id в hex>); заполненный
+// сегмент закрывается, а при превышении TELEMETRY_SEGMENT_COUNT удаляется
+// самый старый. На месте ничего не переписывается: повреждённый хвост
+// последнего сегмента просто закрывает его, запись продолжается в новом.
+//
+// Время - секунды устройства: при старте отсчёт продолжается со следующей
+// секунды после последней сохранённой записи, поэтому метки монотонны
+// между перезагрузками (часов реального времени на плате нет).
+
+struct TelemetryRecord {
+    uint32_t timestamp;
+    uint16_t distanceMm;
+    uint8_t flags;
+    uint8_t channel;
+    uint16_t reserved;
+    uint16_t crc;
+};
+
+static_assert(sizeof(TelemetryRecord) == 12, "TelemetryRecord layout is part of the flash format");
+
+static const uint8_t TELEMETRY_FLAG_PUMP = 0x01;
+static const uint8_t TELEMETRY_FLAG_MANUAL = 0x02;
+static const uint8_t TELEMETRY_FLAG_ERROR = 0x04;
+
+struct TelemetrySegmentInfo {
+    uint32_t id;
+    uint32_t firstTs;
+    uint32_t lastTs;
+    uint16_t count;
+    bool isSealed;
+};
+
+class TelemetryStore {
+public:
+    static const uint8_t SEGMENT_COUNT = TELEMETRY_SEGMENT_COUNT;
+    static const uint16_t SEGMENT_RECORDS = TELEMETRY_SEGMENT_RECORDS;
+    // 21 запись по 12 байт - одна страница SPIFFS (256 байт)
+    static const uint8_t BATCH_RECORDS = 21;
+
+    // Возврат false из обработчика прекращает запрос
+    typedef bool (*Visitor)(const TelemetryRecord& record, void* context);
+
+    explicit TelemetryStore(const char* root);
+
+    bool begin();
+    bool append(unsigned long nowMs, uint16_t distanceMm, uint8_t flags, uint8_t channel = 0);
+    bool flush();
+
+    uint32_t getTime() const;
+    size_t query(uint32_t fromTs, uint32_t toTs, Visitor visitor, void* context) const;
+
+    uint8_t getSegmentCount() const;
+    const TelemetrySegmentInfo& getSegment(uint8_t index) const;
+    uint8_t getLastQuerySegments() const;
+
+    static uint16_t crc16(const uint8_t* data, size_t length);
+
+private:
+    class SegmentReader;
+
+    char _root[16];
+
+    // Индекс сегментов в RAM, от старого к новому
+    TelemetrySegmentInfo _segments[SEGMENT_COUNT];
+    uint8_t _segmentCount = 0;
+    uint32_t _nextId = 0;
+
+    TelemetryRecord _batch[BATCH_RECORDS];
+    uint8_t _batchCount = 0;
+
+    uint32_t _timeBase = 0;
+    uint32_t _elapsedSec = 0;
+    unsigned long _lastMs = 0;
+    unsigned long _msRemainder = 0;
+    bool _hasTime = false;
+
+    mutable uint8_t _lastQuerySegments = 0;
+
+    void _openSegment();
+    void _dropOldestSegment();
+    bool _scanSegment(uint32_t id, TelemetrySegmentInfo& info) const;
+    uint32_t _lowerBound(SegmentReader& reader, const TelemetrySegmentInfo& info, uint32_t ts) const;
+    static bool _isValid(const TelemetryRecord& record);
+
+    void _segmentPath(uint32_t id, char* path, size_t size) const;
+    bool _writeRecords(uint32_t id, const TelemetryRecord* records, size_t count);
+    size_t _segmentSize(uint32_t id) const;
+    void _removeSegment(uint32_t id);
+    uint8_t _listSegments(uint32_t* ids, uint8_t maxIds) const;
+};
+
+#endif
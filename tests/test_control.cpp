@@ -0,0 +1,198 @@
+// ControlManager на модели бака: время идёт по hal::sim, поэтому
+// секунды работы прогоняются за миллисекунды.
+
+#include <gtest/gtest.h>
+#include "control.h"
+
+namespace {
+
+const int PIN_PUMP = 16;
+
+class ControlTest : public ::testing::Test {
+protected:
+    PumpControlSettings settings = {};
+    hal::TankModel model;
+
+    void SetUp() override {
+        settings.channelCount = 1;
+        settings.channels[0].minTriggerMm = 2600;
+        settings.channels[0].maxTriggerMm = 2900;
+        settings.channels[0].pin_pump = PIN_PUMP;
+        settings.channels[0].pin_trig = 12;
+        settings.channels[0].pin_echo = 14;
+        settings.sampleIntervalMs = 50;
+        settings.pin_led = -1;
+
+        // Уровень меняет только тест: без притока, откачки и шума
+        model.pumpPin = PIN_PUMP;
+        model.inflowMmPerSec = 0;
+        model.pumpOutflowMmPerSec = 0;
+        model.noiseMm = 0;
+        model.distanceMm = 2750;
+        hal::sim::reset(model);
+    }
+
+    void runFor(ControlManager& control, unsigned long ms) {
+        for (unsigned long i = 0; i < ms; i++) {
+            control.update();
+            hal::sim::advanceMillis(1);
+        }
+    }
+
+    void setDistance(float distanceMm) {
+        hal::sim::tank().distanceMm = distanceMm;
+    }
+};
+
+TEST_F(ControlTest, PumpStaysOffInsideHysteresisBand) {
+    ControlManager control(settings);
+    control.begin();
+
+    runFor(control, 2000);
+    EXPECT_FALSE(control.getPumpState());
+    EXPECT_FALSE(hal::sim::isPumpOn());
+    EXPECT_NEAR(control.getCurrentDistance(), 2750, 5);
+}
+
+TEST_F(ControlTest, PumpSwitchesAtThresholdsOnly) {
+    ControlManager control(settings);
+    control.begin();
+    runFor(control, 1000);
+
+    // Вода поднялась выше порога включения (расстояние меньше minTrigger)
+    setDistance(2550);
+    runFor(control, 2000);
+    EXPECT_TRUE(control.getPumpState());
+    EXPECT_TRUE(hal::sim::isPumpOn());
+
+    // Внутри полосы гистерезиса насос продолжает качать
+    setDistance(2750);
+    runFor(control, 2000);
+    EXPECT_TRUE(control.getPumpState());
+
+    setDistance(2950);
+    runFor(control, 2000);
+    EXPECT_FALSE(control.getPumpState());
+    EXPECT_FALSE(hal::sim::isPumpOn());
+
+    setDistance(2750);
+    runFor(control, 2000);
+    EXPECT_FALSE(control.getPumpState());
+    EXPECT_EQ(2u, hal::sim::getPumpSwitchCount());
+}
+
+TEST_F(ControlTest, ErrorEntersOnlyAfterDelay) {
+    ControlManager control(settings);
+    control.begin();
+    setDistance(2550);
+    runFor(control, 2000);
+    ASSERT_TRUE(control.getPumpState());
+
+    // Датчик перестал видеть воду: показания вне допустимого диапазона
+    setDistance(100);
+    runFor(control, 3000);
+    EXPECT_FALSE(control.isErrorState());
+
+    runFor(control, 1000);
+    EXPECT_TRUE(control.isErrorState());
+    EXPECT_FALSE(control.getPumpState());
+    EXPECT_FALSE(hal::sim::isPumpOn());
+}
+
+TEST_F(ControlTest, ShortOutOfRangeDoesNotRaiseError) {
+    ControlManager control(settings);
+    control.begin();
+    runFor(control, 1000);
+
+    setDistance(100);
+    runFor(control, 2500);
+    setDistance(2750);
+    runFor(control, 2000);
+    setDistance(100);
+    runFor(control, 2500);
+    EXPECT_FALSE(control.isErrorState());
+}
+
+TEST_F(ControlTest, ErrorClearsWhenBackInRange) {
+    ControlManager control(settings);
+    control.begin();
+    runFor(control, 1000);
+
+    setDistance(100);
+    runFor(control, 4000);
+    ASSERT_TRUE(control.isErrorState());
+
+    setDistance(2750);
+    runFor(control, 2000);
+    EXPECT_FALSE(control.isErrorState());
+    EXPECT_FALSE(control.getPumpState());
+}
+
+TEST_F(ControlTest, SingleSplashDoesNotSwitchPump) {
+    ControlManager control(settings);
+    control.begin();
+    runFor(control, 1000);
+
+    // Одно ложное эхо далеко за порогом включения не должно дёрнуть насос
+    setDistance(1500);
+    runFor(control, 50);
+    setDistance(2750);
+    runFor(control, 2000);
+    EXPECT_FALSE(control.getPumpState());
+    EXPECT_EQ(0u, hal::sim::getPumpSwitchCount());
+}
+
+TEST_F(ControlTest, DropoutsDoNotRaiseError) {
+    model.dropoutPercent = 20;
+    model.seed = 7;
+    hal::sim::reset(model);
+
+    ControlManager control(settings);
+    control.begin();
+    runFor(control, 20000);
+    EXPECT_FALSE(control.isErrorState());
+    EXPECT_FALSE(control.getPumpState());
+}
+
+// Каналы опрашиваются по очереди с шагом не меньше 30 мс: при двух каналах
+// и 50 мс каждый канал получает отсчёт раз в 60 мс, а не раз в 50
+TEST_F(ControlTest, LevelRateUsesPerChannelPeriod) {
+    settings.channelCount = 2;
+    settings.channels[1] = settings.channels[0];
+    settings.channels[1].pin_pump = 15;
+
+    model.distanceMm = 3300;
+    model.inflowMmPerSec = 20;
+    hal::sim::reset(model);
+    hal::sim::tank(1).pumpPin = 15;
+
+    ControlManager control(settings);
+    control.begin();
+    runFor(control, 10000);
+
+    EXPECT_FALSE(control.getPumpState(0));
+    EXPECT_NEAR(-20, control.getLevelRate(0), 2);
+    EXPECT_NEAR(-20, control.getLevelRate(1), 2);
+}
+
+TEST_F(ControlTest, ManualModeOverridesLevel) {
+    ControlManager control(settings);
+    control.begin();
+    runFor(control, 1000);
+
+    control.setManualMode(true);
+    control.setPumpState(true);
+    runFor(control, 2000);
+    EXPECT_TRUE(hal::sim::isPumpOn());
+
+    // После возврата в автомат гистерезис продолжает с ручного состояния
+    control.setManualMode(false);
+    runFor(control, 2000);
+    EXPECT_TRUE(control.getPumpState());
+
+    setDistance(2950);
+    runFor(control, 2000);
+    EXPECT_FALSE(control.getPumpState());
+}
+
+}
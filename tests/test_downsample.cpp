@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <vector>
+#include "downsample.h"
+
+namespace {
+
+struct Sample {
+    long sec;
+    long value;
+    bool isPumpOn;
+};
+
+// LTTB по исходным отсчётам с той же разбивкой на корзины и тем же
+// правилом выбора (первый максимум площади)
+std::vector<Sample> referenceLttb(const std::vector<Sample>& data, long maxPoints) {
+    long count = data.size();
+    if (maxPoints >= count) return data;
+
+    std::vector<Sample> out;
+    out.push_back(data.front());
+    if (maxPoints > 2) {
+        long buckets = maxPoints - 2;
+        long from = data.front().sec;
+        long to = data.back().sec;
+        auto bucketStart = [&](long b) -> long {
+            return (b >= buckets) ? to : from + 1 + (to - from - 1) * b / buckets;
+        };
+
+        Sample a = data.front();
+        for (long b = 0; b < buckets; b++) {
+            long start = bucketStart(b);
+            long end = bucketStart(b + 1);
+            long cx;
+            long cy;
+            if (b + 1 < buckets) {
+                long nextEnd = bucketStart(b + 2);
+                long sumSec = 0, sumValue = 0, n = 0;
+                for (const Sample& s : data) {
+                    if (s.sec >= end && s.sec < nextEnd) {
+                        sumSec += s.sec - from;
+                        sumValue += s.value;
+                        n++;
+                    }
+                }
+                if (n == 0) n = 1;
+                cx = sumSec / n;
+                cy = sumValue / n;
+            } else {
+                cx = to - from;
+                cy = data.back().value;
+            }
+
+            long best = -1;
+            Sample chosen = a;
+            for (const Sample& s : data) {
+                if (s.sec < start || s.sec >= end) continue;
+                long area = (a.sec - from - cx) * (s.value - a.value) - (a.sec - s.sec) * (cy - a.value);
+                if (area < 0) area = -area;
+                if (area > best) {
+                    best = area;
+                    chosen = s;
+                }
+            }
+            out.push_back(chosen);
+            a = chosen;
+        }
+    }
+    out.push_back(data.back());
+    return out;
+}
+
+class DownsampleTest : public ::testing::Test {
+protected:
+    static HistoryManager* history;
+    static std::vector<Sample> truth;
+
+    // Уровень держится площадками по 5-120 с, насос включается ступенями:
+    // длинные отрезки истории пересекают границы корзин
+    static void SetUpTestSuite() {
+        history = new HistoryManager();
+        srand(5);
+        long level = 280;
+        bool isPumpOn = false;
+        unsigned long ms = 0;
+        for (long sec = 0; sec < 6000;) {
+            long run = 5 + rand() % 116;
+            level += rand() % 21 - 10;
+            if (level < 250) level = 250;
+            if (level > 300) level = 300;
+            isPumpOn = rand() % 4 == 0;
+            for (long i = 0; i < run && sec < 6000; i++, sec++) {
+                history->addSample(ms, level * HistoryManager::RESOLUTION_MM, isPumpOn);
+                truth.push_back({ sec, level, isPumpOn });
+                ms += 1000;
+            }
+        }
+    }
+
+    static void TearDownTestSuite() {
+        delete history;
+        history = nullptr;
+        truth.clear();
+    }
+
+    void expectMatchesReference(long from, long to, long maxPoints) {
+        if (from < (long)history->getOldestSec()) from = history->getOldestSec();
+        std::vector<Sample> data(truth.begin() + from, truth.begin() + to + 1);
+        std::vector<Sample> expected = referenceLttb(data, maxPoints);
+
+        HistoryDownsampler downsampler(*history, from, to, maxPoints);
+        EXPECT_EQ(expected.size(), downsampler.getPointCount());
+
+        HistoryPoint point;
+        size_t i = 0;
+        while (downsampler.next(point)) {
+            ASSERT_LT(i, expected.size());
+            EXPECT_EQ(expected[i].sec, (long)point.sec) << "point " << i;
+            EXPECT_EQ(expected[i].value * HistoryManager::RESOLUTION_MM, point.distanceMm) << "point " << i;
+            EXPECT_EQ(expected[i].isPumpOn, point.isPumpOn) << "point " << i;
+            i++;
+        }
+        EXPECT_EQ(expected.size(), i);
+    }
+};
+
+HistoryManager* DownsampleTest::history = nullptr;
+std::vector<Sample> DownsampleTest::truth;
+
+TEST_F(DownsampleTest, MatchesReferenceOnPlateaus) {
+    expectMatchesReference(0, 5999, 300);
+    expectMatchesReference(0, 5999, 40);
+    expectMatchesReference(1000, 3000, 25);
+    expectMatchesReference(4000, 4100, 7);
+}
+
+TEST_F(DownsampleTest, TwoPointsAreEndpoints) {
+    HistoryDownsampler downsampler(*history, 100, 900, 2);
+    EXPECT_EQ(2, downsampler.getPointCount());
+
+    HistoryPoint point;
+    ASSERT_TRUE(downsampler.next(point));
+    EXPECT_EQ(100u, point.sec);
+    ASSERT_TRUE(downsampler.next(point));
+    EXPECT_EQ(900u, point.sec);
+    EXPECT_FALSE(downsampler.next(point));
+}
+
+TEST_F(DownsampleTest, ShortRangeReturnsEverySample) {
+    expectMatchesReference(2000, 2009, 500);
+}
+
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <stdint.h>
+#include <vector>
+#include "filters.h"
+
+namespace {
+
+TEST(MedianFilterTest, MatchesSortedWindow) {
+    MedianFilter<int32_t, 7> filter;
+    filter.reset(0);
+    std::vector<int32_t> window(7, 0);
+
+    uint32_t seed = 12345;
+    for (int i = 0; i < 2000; i++) {
+        seed = seed * 1103515245 + 12345;
+        int32_t value = (seed >> 8) % 4000;
+
+        window.erase(window.begin());
+        window.push_back(value);
+        std::vector<int32_t> sorted(window);
+        std::sort(sorted.begin(), sorted.end());
+
+        ASSERT_EQ(sorted[3], filter.add(value)) << "sample " << i;
+    }
+}
+
+TEST(MedianFilterTest, HandlesDuplicates) {
+    MedianFilter<int32_t, 5> filter;
+    filter.reset(10);
+    filter.add(10);
+    filter.add(20);
+    EXPECT_EQ(10, filter.add(20));
+    EXPECT_EQ(20, filter.add(20));
+}
+
+TEST(MedianStageTest, RejectsSingleSpike) {
+    MedianStage<int32_t, 5> stage;
+    EXPECT_EQ(2700, stage.process(2700));
+    EXPECT_EQ(2700, stage.process(2700));
+    EXPECT_EQ(2700, stage.process(0));
+    EXPECT_EQ(2700, stage.process(2700));
+}
+
+TEST(OutlierGateStageTest, HoldsLastValueOnJump) {
+    OutlierGateStage<int32_t, 300, 5> gate;
+    EXPECT_EQ(2700, gate.process(2700));
+    EXPECT_EQ(2700, gate.process(1500));
+    EXPECT_EQ(2750, gate.process(2750));
+}
+
+TEST(OutlierGateStageTest, AcceptsPersistentJump) {
+    OutlierGateStage<int32_t, 300, 5> gate;
+    gate.process(2700);
+    for (int i = 0; i < 5; i++) {
+        EXPECT_EQ(2700, gate.process(1500)) << "reject " << i;
+    }
+    EXPECT_EQ(1500, gate.process(1500));
+    EXPECT_EQ(1500, gate.process(1500));
+}
+
+TEST(OutlierGateStageTest, SmallStepsPassThrough) {
+    OutlierGateStage<int32_t, 300, 5> gate;
+    gate.process(2700);
+    EXPECT_EQ(2900, gate.process(2900));
+    EXPECT_EQ(3100, gate.process(3100));
+}
+
+TEST(AlphaBetaStageTest, TracksSteadyRate) {
+    AlphaBetaStage<int32_t, 128, 16, 256> tracker;
+    int32_t value = 2000;
+    for (int i = 0; i < 200; i++) {
+        tracker.process(value);
+        value += 4;
+    }
+    EXPECT_NEAR(4, tracker.deltaOver(1), 1);
+    EXPECT_NEAR(400, tracker.deltaOver(100), 20);
+}
+
+TEST(FilterPipelineTest, RateComesFromLastTrackingStage) {
+    FilterPipeline<MedianStage<int32_t, 5>, OutlierGateStage<int32_t, 300, 5>, AlphaBetaStage<int32_t, 128, 16, 256>> pipeline;
+    FilterPipeline<MedianStage<int32_t, 5>> medianOnly;
+    EXPECT_TRUE(decltype(pipeline)::tracksRate);
+    EXPECT_FALSE(decltype(medianOnly)::tracksRate);
+
+    for (int i = 0; i < 200; i++) {
+        pipeline.process(3000 - i * 2);
+        medianOnly.process(3000 - i * 2);
+    }
+    EXPECT_NEAR(-2, pipeline.deltaOver(1), 1);
+    EXPECT_EQ(0, medianOnly.deltaOver(1));
+}
+
+}
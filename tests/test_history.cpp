@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include "history.h"
+
+namespace {
+
+// Сутки отсчётов раз в секунду: уровень растёт со скоростью fillMmPerSec(t),
+// насос откачивает 3 мм/с между 2600 и 2900 мм, шум сонара +-3 мм
+template <typename FillRate>
+void runDay(HistoryManager& history, FillRate fillMmPerSec) {
+    srand(1);
+    double level = 2800;
+    bool isPumpOn = false;
+    unsigned long ms = 0;
+    for (long t = 0; t < 86400; t++) {
+        level += isPumpOn ? -3.0 : fillMmPerSec(t);
+        if (level < 2600) isPumpOn = false;
+        if (level > 2900) isPumpOn = true;
+        history.addSample(ms, (int)level + rand() % 7 - 3, isPumpOn);
+        ms += 1000;
+    }
+}
+
+}
+
+TEST(HistoryTest, SlowTankKeepsFullDay) {
+    std::unique_ptr<HistoryManager> history(new HistoryManager());
+    runDay(*history, [](long) { return 0.2; });
+
+    EXPECT_EQ(86399u, history->getUptimeSec());
+    EXPECT_EQ(0u, history->getOldestSec());
+}
+
+// Около 140 циклов насоса в сутки, приток меняется каждый час
+TEST(HistoryTest, BusySumpKeepsFullDay) {
+    std::unique_ptr<HistoryManager> history(new HistoryManager());
+    runDay(*history, [](long t) { return 1.0 / (1 + (t / 3600) % 3); });
+
+    EXPECT_EQ(86399u, history->getUptimeSec());
+    EXPECT_EQ(0u, history->getOldestSec());
+    EXPECT_LE(history->getBytesUsed(), (size_t)HISTORY_BUFFER_BYTES);
+}
@@ -0,0 +1,114 @@
+/*
+  Замер скользящей медианы на компьютере: прежний вариант (копия окна и
+  пузырьковая сортировка на каждый отсчёт, как было в ControlManager) против
+  MedianFilter (отсортированное кольцо). Для окон 5, 31 и 101 сначала
+  проверяется, что оба фильтра выдают одинаковые значения, затем меряется
+  время на один отсчёт.
+
+  Сборка (из корня проекта):
+    g++ -std=gnu++11 -O2 -I. tools/median_bench.cpp -o median_bench
+
+  Запуск:
+    ./median_bench [samples]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "median_filter.h"
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Прежний фильтр: кольцо показаний, на каждый отсчёт копия и сортировка пузырьком
+template <size_t N>
+class BubbleMedian {
+public:
+    float add(float value) {
+        _readings[_index] = value;
+        _index = (_index + 1) % N;
+
+        float sortedReadings[N];
+        for (size_t i = 0; i < N; i++) {
+            sortedReadings[i] = _readings[i];
+        }
+        for (size_t i = 0; i < N - 1; i++) {
+            for (size_t j = 0; j < N - i - 1; j++) {
+                if (sortedReadings[j] > sortedReadings[j + 1]) {
+                    float temp = sortedReadings[j];
+                    sortedReadings[j] = sortedReadings[j + 1];
+                    sortedReadings[j + 1] = temp;
+                }
+            }
+        }
+        return sortedReadings[N / 2];
+    }
+
+private:
+    float _readings[N] = {};
+    size_t _index = 0;
+};
+
+template <size_t N>
+static int run(const float* samples, size_t count) {
+    {
+        BubbleMedian<N> bubble;
+        MedianFilter<float, N> ring;
+        for (size_t i = 0; i < count; i++) {
+            float expected = bubble.add(samples[i]);
+            float actual = ring.add(samples[i]);
+            if (expected != actual) {
+                printf("FAIL: N=%u sample %u: bubble %.1f, sorted ring %.1f\n",
+                       (unsigned)N, (unsigned)i, expected, actual);
+                return 1;
+            }
+        }
+    }
+
+    volatile float sink = 0;
+    BubbleMedian<N> bubble;
+    double start = nowSeconds();
+    for (size_t i = 0; i < count; i++) {
+        sink = sink + bubble.add(samples[i]);
+    }
+    double bubbleTime = nowSeconds() - start;
+
+    MedianFilter<float, N> ring;
+    start = nowSeconds();
+    for (size_t i = 0; i < count; i++) {
+        sink = sink + ring.add(samples[i]);
+    }
+    double ringTime = nowSeconds() - start;
+
+    printf("N=%3u: bubble %8.1f ns/sample, sorted ring %6.1f ns/sample, %.1fx\n",
+           (unsigned)N, bubbleTime * 1e9 / count, ringTime * 1e9 / count, bubbleTime / ringTime);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    size_t count = (argc > 1) ? (size_t)atol(argv[1]) : 200000;
+    if (count == 0) count = 1;
+
+    // Расстояния в мм с повторами и выбросами, как у сонара
+    float* samples = (float*)malloc(count * sizeof(float));
+    if (!samples) {
+        perror("malloc");
+        return 2;
+    }
+    srand(1);
+    for (size_t i = 0; i < count; i++) {
+        samples[i] = (rand() % 10 == 0) ? (float)(rand() % 4000) : (float)(2000 + rand() % 400);
+    }
+
+    int failures = 0;
+    failures += run<5>(samples, count);
+    failures += run<31>(samples, count);
+    failures += run<101>(samples, count);
+
+    free(samples);
+    return failures ? 1 : 0;
+}
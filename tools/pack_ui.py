@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""
+  Упаковка веб-интерфейса в ui_bundle_data.h: каждый файл сжимается в
+  варианты gzip (zopfli) и brotli, все варианты
+  складываются в один массив PROGMEM и описываются таблицей UiAsset.
+  Сервер отдаёт самый маленький вариант из разрешённых Accept-Encoding.
+  Каждый файл доступен по адресу /ui/<хэш>.<расширение>, который меняется
+  вместе с содержимым, поэтому его можно кешировать навсегда. Ссылки на
+  такие файлы внутри .html заменяются на хэшированные адреса.
+
+  Для каждого варианта печатается размер, время сжатия/распаковки на
+  компьютере и оценка времени передачи по медленному каналу.
+
+  Запуск (из корня проекта):
+    python3 tools/pack_ui.py index.html [style.css app.js ...] [-o ui_bundle_data.h] [--data-dir data]
+
+  --data-dir дополнительно пишет index.html.gz / index.html.br для образа SPIFFS.
+  zopfli: pip install zopfli или утилита zopfli в PATH; без него упаковка
+  прерывается, чтобы в прошивку не попал вариант gzip -9.
+  brotli: pip install brotli или утилита brotli в PATH; без него вариант
+  brotli пропускается.
+"""
+
+import argparse
+import hashlib
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+import zlib
+
+try:
+    import zopfli.gzip as zopfli_gzip
+except ImportError:
+    zopfli_gzip = None
+
+try:
+    import brotli
+except ImportError:
+    brotli = None
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+}
+
+# Уже сжатые форматы gzip не уменьшает
+COMPRESSED_EXTENSIONS = {".png"}
+
+ALIGNMENT = 4
+
+# Скорость передачи для оценки в отчёте: слабый 2.4 ГГц канал
+REPORT_LINK_KBITS = 500
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:8]
+
+
+def load_assets(paths):
+    assets = []
+    for path in paths:
+        name = os.path.basename(path)
+        extension = os.path.splitext(name)[1].lower()
+        if extension not in CONTENT_TYPES:
+            sys.exit("pack_ui: unknown content type for %s" % path)
+        with open(path, "rb") as f:
+            assets.append({"name": name, "extension": extension, "source": f.read()})
+    return assets
+
+
+def rewrite_references(assets):
+    # Сначала хэши вспомогательных файлов, потом .html со ссылками на них
+    others = [a for a in assets if a["extension"] != ".html"]
+    for asset in others:
+        asset["hash"] = content_hash(asset["source"])
+        asset["url"] = "/ui/%s%s" % (asset["hash"], asset["extension"])
+
+    for asset in assets:
+        if asset["extension"] != ".html":
+            continue
+        text = asset["source"].decode("utf-8")
+        for other in others:
+            text = text.replace('"%s"' % other["name"], '"%s"' % other["url"])
+            text = text.replace("'%s'" % other["name"], "'%s'" % other["url"])
+        asset["source"] = text.encode("utf-8")
+        asset["hash"] = content_hash(asset["source"])
+        asset["url"] = "/ui/%s%s" % (asset["hash"], asset["extension"])
+
+
+def run_tool(command, data, suffix):
+    with tempfile.TemporaryDirectory() as directory:
+        source = os.path.join(directory, "asset")
+        with open(source, "wb") as f:
+            f.write(data)
+        subprocess.run(command + [source], check=True, capture_output=True)
+        with open(source + suffix, "rb") as f:
+            return f.read()
+
+
+def compress_gzip(data):
+    if zopfli_gzip:
+        return zopfli_gzip.compress(data, numiterations=50), "zopfli"
+    if shutil.which("zopfli"):
+        return run_tool(["zopfli", "--i50"], data, ".gz"), "zopfli"
+    sys.exit("pack_ui: zopfli not found (pip install zopfli or put zopfli in PATH)")
+
+
+def compress_brotli(data):
+    if brotli:
+        return brotli.compress(data, mode=brotli.MODE_TEXT, quality=11, lgwin=22), "brotli -q 11"
+    if shutil.which("brotli"):
+        return run_tool(["brotli", "-q", "11", "-k"], data, ".br"), "brotli -q 11"
+    return None, None
+
+
+def decompress(data, encoding):
+    if encoding == "gzip":
+        return zlib.decompress(data, 16 + zlib.MAX_WBITS)
+    if encoding == "br":
+        return brotli.decompress(data) if brotli else None
+    return data
+
+
+# Варианты файла по возрастанию размера: (encoding, данные, инструмент, мс сжатия)
+def encode(asset):
+    if asset["extension"] in COMPRESSED_EXTENSIONS:
+        return [("", asset["source"], "identity", 0.0)]
+
+    variants = []
+    for encoding, compress in (("gzip", compress_gzip), ("br", compress_brotli)):
+        start = time.perf_counter()
+        data, tool = compress(asset["source"])
+        elapsed = (time.perf_counter() - start) * 1000
+        if data is None:
+            print("pack_ui: brotli not found, %s has no br variant" % asset["name"], file=sys.stderr)
+            continue
+        variants.append((encoding, data, tool, elapsed))
+    variants.sort(key=lambda variant: len(variant[1]))
+    return variants
+
+
+def report(asset, variants):
+    source_length = len(asset["source"])
+    print("%s (%d bytes, %s)" % (asset["name"], source_length, asset["url"]))
+    print("  %-8s %-12s %7s %6s %9s %9s %8s" % ("encoding", "tool", "bytes", "ratio", "encode ms", "decode ms", "tx ms"))
+    for encoding, data, tool, encode_ms in variants:
+        start = time.perf_counter()
+        decoded = decompress(data, encoding)
+        decode_ms = (time.perf_counter() - start) * 1000
+        if decoded is not None and decoded != asset["source"]:
+            sys.exit("pack_ui: %s %s variant does not round-trip" % (asset["name"], encoding))
+        tx_ms = len(data) * 8.0 / REPORT_LINK_KBITS
+        print("  %-8s %-12s %7d %5.1f%% %9.1f %9s %8.0f" % (
+            encoding or "identity", tool, len(data), 100.0 * len(data) / source_length, encode_ms,
+            "%.2f" % decode_ms if decoded is not None else "-", tx_ms))
+
+
+def write_header(assets, output):
+    blob = bytearray()
+    rows = []
+    for asset in assets:
+        variants = encode(asset)
+        report(asset, variants)
+        asset["variants"] = variants
+        for encoding, data, tool, encode_ms in variants:
+            while len(blob) % ALIGNMENT:
+                blob.append(0)
+            etag = asset["hash"] + ("-" + encoding if encoding else "")
+            rows.append((asset, encoding, etag, len(blob), len(data)))
+            blob += data
+
+    lines = [
+        "// Сгенерировано tools/pack_ui.py, не редактировать вручную.",
+        "",
+        "#ifndef UI_BUNDLE_DATA_H",
+        "#define UI_BUNDLE_DATA_H",
+        "",
+        "static const uint8_t ui_bundle_data[] PROGMEM __attribute__((aligned(%d))) = {" % ALIGNMENT,
+    ]
+    for i in range(0, len(blob), 12):
+        lines.append("  " + ", ".join("0x%02x" % b for b in blob[i:i + 12]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("// Варианты одного файла идут подряд, от меньшего к большему")
+    lines.append("static const UiAsset ui_bundle_assets[] = {")
+    for asset, encoding, etag, offset, length in rows:
+        lines.append('  { "/%s", "%s", "%s", "%s", "\\"%s\\"", %d, %d },' % (
+            asset["name"], asset["url"], CONTENT_TYPES[asset["extension"]], encoding, etag, offset, length))
+    lines.append("};")
+    lines.append("")
+    lines.append("static const uint8_t ui_bundle_asset_count = %d;" % len(rows))
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+
+    with open(output, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+    print("bundle: %d bytes in %s" % (len(blob), output))
+
+
+def write_data_images(assets, data_dir):
+    suffixes = {"gzip": ".gz", "br": ".br"}
+    for asset in assets:
+        for encoding, data, tool, encode_ms in asset["variants"]:
+            if encoding not in suffixes:
+                continue
+            path = os.path.join(data_dir, asset["name"] + suffixes[encoding])
+            with open(path, "wb") as f:
+                f.write(data)
+            print("image: %s (%d bytes)" % (path, len(data)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack web UI files into a PROGMEM bundle")
+    parser.add_argument("files", nargs="+")
+    parser.add_argument("-o", "--output", default="ui_bundle_data.h")
+    parser.add_argument("--data-dir", help="also write .gz/.br images for SPIFFS here")
+    args = parser.parse_args()
+
+    assets = load_assets(args.files)
+    rewrite_references(assets)
+    write_header(assets, args.output)
+    if args.data_dir:
+        write_data_images(assets, args.data_dir)
+
+
+if __name__ == "__main__":
+    main()
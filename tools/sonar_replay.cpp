@@ -0,0 +1,123 @@
+/*
+  Воспроизведение трассы датчика (/getSonarTrace или /sonar_trace.bin)
+  через ControlManager::update() на компьютере, быстрее реального времени.
+  Решения насоса сравниваются с теми, что принимало устройство.
+
+  Сборка (из корня проекта):
+    g++ -std=gnu++11 -O2 -I. tools/sonar_replay.cpp control.cpp hal_sim.cpp \
+        profiler.cpp sonar_trace.cpp status_led.cpp -o sonar_replay
+
+  Запуск:
+    ./sonar_replay sonar_trace.bin [minTriggerMm maxTriggerMm [sampleIntervalMs]]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+#include "control.h"
+
+static const int PIN_PUMP = 16;
+static const size_t MAX_REPORTED_MISMATCHES = 20;
+
+static bool loadTrace(const char* path, std::vector<SonarTraceRecord>& records) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+
+    SonarTraceHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, "PTRC", 4) != 0 ||
+        header.version != SONAR_TRACE_VERSION || header.recordSize != sizeof(SonarTraceRecord)) {
+        fprintf(stderr, "%s is not a sonar trace\n", path);
+        fclose(file);
+        return false;
+    }
+
+    SonarTraceRecord record;
+    while (fread(&record, sizeof(record), 1, file) == 1) {
+        records.push_back(record);
+    }
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s trace.bin [minTriggerMm maxTriggerMm [sampleIntervalMs]]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<SonarTraceRecord> records;
+    if (!loadTrace(argv[1], records)) return 2;
+
+    PumpControlSettings settings = {};
+    settings.channelCount = 1;
+    settings.channels[0].minTriggerMm = (argc > 3) ? atoi(argv[2]) : 2600;
+    settings.channels[0].maxTriggerMm = (argc > 3) ? atoi(argv[3]) : 2900;
+    settings.channels[0].pin_pump = PIN_PUMP;
+    settings.channels[0].pin_trig = 12;
+    settings.channels[0].pin_echo = 14;
+    settings.sampleIntervalMs = (argc > 4) ? atoi(argv[4]) : 50;
+    settings.pin_led = 5;
+    settings.pin_button = 4;
+
+    hal::TankModel model;
+    model.pumpPin = PIN_PUMP;
+    hal::sim::reset(model);
+
+    ControlManager control(settings);
+    control.begin();
+    hal::sim::loadTrace(records.data(), records.size());
+
+    size_t mismatches = 0;
+    size_t compared = 0;
+    size_t recordedSwitches = 0;
+    bool lastRecordedPump = false;
+    clock_t started = clock();
+
+    while (!hal::sim::isTraceFinished()) {
+        // Режим, в котором устройство обработало следующий отсчёт, ставится
+        // до его обработки: ручные участки меняют ошибку и насос так же, как на плате
+        size_t position = hal::sim::getTracePosition();
+        bool isManual = records[position].value & SONAR_TRACE_MANUAL_BIT;
+        if (isManual != settings.manualMode_pump) control.setManualMode(isManual);
+
+        control.update();
+        if (hal::sim::getTracePosition() == position) {
+            hal::sim::advanceMillis(1);
+            continue;
+        }
+
+        const SonarTraceRecord& record = records[position];
+        bool recordedPump = record.value & SONAR_TRACE_PUMP_BIT;
+        if (position > 0 && recordedPump != lastRecordedPump) recordedSwitches++;
+        lastRecordedPump = recordedPump;
+
+        // В ручном режиме насосом управлял пользователь - повторяем его команды
+        if (isManual) {
+            control.setPumpState(recordedPump);
+            continue;
+        }
+
+        compared++;
+        if (recordedPump != control.getPumpState()) {
+            if (mismatches < MAX_REPORTED_MISMATCHES) {
+                printf("t=%lu ms raw=%u mm filtered=%u mm recorded=%s replayed=%s\n",
+                       hal::millis(), record.value & SONAR_TRACE_DISTANCE_MASK, control.getCurrentDistance(),
+                       recordedPump ? "ON" : "OFF", control.getPumpState() ? "ON" : "OFF");
+            }
+            mismatches++;
+        }
+    }
+
+    double seconds = (double)(clock() - started) / CLOCKS_PER_SEC;
+    printf("samples: %zu, compared: %zu, mismatches: %zu\n", records.size(), compared, mismatches);
+    printf("pump switches: recorded %zu, replayed %u\n", recordedSwitches, hal::sim::getPumpSwitchCount());
+    printf("trace time: %.1f s, replay time: %.3f s\n", hal::millis() / 1000.0, seconds);
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+/*
+  Замер TelemetryStore на компьютере: скорость дописывания, запросов по
+  диапазону (с индексом сегментов) и восстановление после перезапуска и
+  оборванной записи. Сегменты пишутся во временный каталог.
+
+  Сборка (из корня проекта):
+    g++ -std=gnu++11 -O2 -I. tools/telemetry_bench.cpp telemetry_store.cpp \
+        hal_sim.cpp -o telemetry_bench
+
+  Запуск:
+    ./telemetry_bench [queries]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+
+#include "telemetry_store.h"
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool countRecord(const TelemetryRecord&, void* context) {
+    (*(size_t*)context)++;
+    return true;
+}
+
+static void removeDirectory(const char* path) {
+    DIR* dir = opendir(path);
+    if (!dir) return;
+    struct dirent* entry;
+    char file[512];
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_name[0] == '.') continue;
+        snprintf(file, sizeof(file), "%s/%s", path, entry->d_name);
+        remove(file);
+    }
+    closedir(dir);
+    rmdir(path);
+}
+
+int main(int argc, char** argv) {
+    int queries = (argc > 1) ? atoi(argv[1]) : 1000;
+
+    char root[] = "/tmp/tsXXXXXX";
+    if (!mkdtemp(root)) {
+        perror("mkdtemp");
+        return 2;
+    }
+
+    const uint32_t capacity = (uint32_t)TelemetryStore::SEGMENT_COUNT * TelemetryStore::SEGMENT_RECORDS;
+    const uint32_t total = capacity + capacity / 2;
+    int failures = 0;
+
+    TelemetryStore store(root);
+    store.begin();
+
+    unsigned long ms = 0;
+    double start = nowSeconds();
+    for (uint32_t i = 0; i < total; i++) {
+        store.append(ms, 2000 + i % 900, (i / 300) % 2 ? TELEMETRY_FLAG_PUMP : 0);
+        ms += 1000;
+    }
+    store.flush();
+    double appendTime = nowSeconds() - start;
+    printf("append: %u records in %.3f s, %.0f records/s, %u segment(s) kept\n",
+           (unsigned)total, appendTime, total / appendTime, store.getSegmentCount());
+
+    uint32_t oldest = store.getSegment(0).firstTs;
+    uint32_t newest = store.getTime();
+    if (store.getSegmentCount() != TelemetryStore::SEGMENT_COUNT || newest != total - 1) {
+        printf("FAIL: expected %u segments and time %u\n", TelemetryStore::SEGMENT_COUNT, (unsigned)(total - 1));
+        failures++;
+    }
+
+    srand(1);
+    size_t visited = 0;
+    unsigned long segmentsTouched = 0;
+    start = nowSeconds();
+    for (int q = 0; q < queries; q++) {
+        uint32_t from = oldest + rand() % (newest - oldest);
+        size_t count = 0;
+        store.query(from, from + 3599, countRecord, &count);
+        visited += count;
+        segmentsTouched += store.getLastQuerySegments();
+
+        uint32_t expected = (from + 3599 <= newest) ? 3600 : newest - from + 1;
+        if (count != expected) {
+            printf("FAIL: query %u..%u returned %u records, expected %u\n",
+                   (unsigned)from, (unsigned)(from + 3599), (unsigned)count, (unsigned)expected);
+            failures++;
+            break;
+        }
+    }
+    double queryTime = nowSeconds() - start;
+    printf("query 1 h: %d queries in %.3f s, %.0f queries/s, %.0f records/s, %.2f of %u segments per query\n",
+           queries, queryTime, queries / queryTime, visited / queryTime,
+           (double)segmentsTouched / queries, store.getSegmentCount());
+
+    size_t all = 0;
+    start = nowSeconds();
+    store.query(0, 0xFFFFFFFF, countRecord, &all);
+    double fullTime = nowSeconds() - start;
+    printf("query all: %u records in %.3f s, %.0f records/s\n", (unsigned)all, fullTime, all / fullTime);
+    if (all != capacity) {
+        printf("FAIL: full query returned %u records, expected %u\n", (unsigned)all, (unsigned)capacity);
+        failures++;
+    }
+
+    // Перезапуск с оборванной записью в последнем сегменте
+    char path[64];
+    snprintf(path, sizeof(path), "%s/%08lx", root, (unsigned long)store.getSegment(store.getSegmentCount() - 1).id);
+    FILE* file = fopen(path, "ab");
+    fwrite("torn", 1, 4, file);
+    fclose(file);
+
+    TelemetryStore restarted(root);
+    restarted.begin();
+    restarted.append(0, 1234, 0);
+    restarted.flush();
+
+    size_t last = 0;
+    restarted.query(newest + 1, newest + 1, countRecord, &last);
+    printf("restart: time continues at %u, torn segment sealed: %s\n", (unsigned)(newest + 1),
+           restarted.getSegment(restarted.getSegmentCount() - 1).id != store.getSegment(store.getSegmentCount() - 1).id ? "yes" : "no");
+    if (last != 1 || restarted.getSegment(restarted.getSegmentCount() - 1).id == store.getSegment(store.getSegmentCount() - 1).id) {
+        printf("FAIL: record after restart not found in a fresh segment\n");
+        failures++;
+    }
+
+    removeDirectory(root);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,62 @@
+#include "ui_bundle.h"
+#include "ui_bundle_data.h"
+
+const UiAsset* UiBundle::find(const char* path, const char* acceptEncoding) {
+    const UiAsset* fallback = nullptr;
+    for (uint8_t i = 0; i < ui_bundle_asset_count; i++) {
+        const UiAsset& asset = ui_bundle_assets[i];
+        if (strcmp(path, asset.path) != 0 && strcmp(path, asset.hashedPath) != 0) continue;
+
+        if (isEncodingAccepted(acceptEncoding, asset.encoding)) return &asset;
+        if (!fallback || strcmp(asset.encoding, "gzip") == 0) fallback = &asset;
+    }
+    return fallback;
+}
+
+bool UiBundle::isEncodingAccepted(const char* acceptEncoding, const char* encoding) {
+    if (encoding[0] == '\0') return true;
+    if (!acceptEncoding) return false;
+
+    size_t encodingLength = strlen(encoding);
+    const char* token = acceptEncoding;
+    while (*token) {
+        while (*token == ' ' || *token == ',') token++;
+        const char* end = token;
+        while (*end && *end != ',' && *end != ';' && *end != ' ') end++;
+        size_t length = end - token;
+
+        bool isMatch = (length == encodingLength && strncasecmp(token, encoding, length) == 0) ||
+                       (length == 1 && *token == '*');
+
+        // "gzip;q=0" - явный запрет
+        bool isRejected = false;
+        const char* next = end;
+        while (*next && *next != ',') {
+            if (next[0] == 'q' && next[1] == '=') {
+                isRejected = strtod(next + 2, nullptr) <= 0.0;
+            }
+            next++;
+        }
+
+        if (isMatch && length > 0) return !isRejected;
+        token = next;
+    }
+    return false;
+}
+
+size_t UiBundle::read(const UiAsset& asset, size_t index, uint8_t* buffer, size_t length) {
+    if (index >= asset.length) return 0;
+
+    size_t chunk = asset.length - index;
+    if (chunk > length) chunk = length;
+    memcpy_P(buffer, ui_bundle_data + asset.offset + index, chunk);
+    return chunk;
+}
+
+uint8_t UiBundle::getCount() {
+    return ui_bundle_asset_count;
+}
+
+const UiAsset& UiBundle::getAsset(uint8_t index) {
+    return ui_bundle_assets[index];
+}
@@ -0,0 +1,31 @@
+#ifndef UI_BUNDLE_H
+#define UI_BUNDLE_H
+
+#include <Arduino.h>
+
+// Файл веб-интерфейса внутри ui_bundle_data.h (см. tools/pack_ui.py)
+struct UiAsset {
+    const char* path;          // исходное имя, например "/index.html"
+    const char* hashedPath;    // "/ui/<хэш>.<расширение>", неизменяемый адрес
+    const char* contentType;
+    const char* encoding;      // "gzip", "br" или "" без сжатия
+    const char* etag;          // хэш содержимого и вариант сжатия, в кавычках
+    uint32_t offset;           // смещение в ui_bundle_data
+    uint32_t length;
+};
+
+// Интерфейс, вшитый в прошивку: данные читаются прямо из отображённой
+// флеш-памяти, без файловой системы.
+class UiBundle {
+public:
+    // Самый маленький вариант файла, который разрешает Accept-Encoding
+    // (nullptr - заголовка нет). Если не подходит ни один, отдаётся gzip.
+    static const UiAsset* find(const char* path, const char* acceptEncoding);
+    static bool isEncodingAccepted(const char* acceptEncoding, const char* encoding);
+    static size_t read(const UiAsset& asset, size_t index, uint8_t* buffer, size_t length);
+
+    static uint8_t getCount();
+    static const UiAsset& getAsset(uint8_t index);
+};
+
+#endif
@@ -0,0 +1,908 @@
+// Сгенерировано tools/pack_ui.py, не редактировать вручную.
+
+#ifndef UI_BUNDLE_DATA_H
+#define UI_BUNDLE_DATA_H
+
+static const uint8_t ui_bundle_data[] PROGMEM __attribute__((aligned(4))) = {
+  0x1b, 0xb5, 0x66, 0x00, 0x2c, 0x0f, 0x6c, 0x3a, 0x69, 0x71, 0x7b, 0x70,
+  0xfa, 0x60, 0x56, 0xac, 0x17, 0xa6, 0xb6, 0xf8, 0xc5, 0x9c, 0x07, 0x0a,
+  0x63, 0x4c, 0xf4, 0xff, 0x71, 0xcf, 0x48, 0xcf, 0xa7, 0xa4, 0x69, 0xfc,
+  0x65, 0x12, 0x04, 0x08, 0x7b, 0x6d, 0x6a, 0x6c, 0x19, 0xd6, 0x7f, 0xf3,
+  0x83, 0x79, 0x17, 0x13, 0x17, 0x13, 0x97, 0x2b, 0x01, 0xa1, 0x40, 0xaf,
+  0x9a, 0xcd, 0x09, 0x6d, 0xaf, 0x7d, 0x18, 0x20, 0xca, 0x65, 0xff, 0xeb,
+  0xd4, 0x76, 0x2f, 0xd3, 0xb7, 0x52, 0xbe, 0xf4, 0x8c, 0x44, 0xb1, 0xe5,
+  0xa6, 0x13, 0x89, 0xaf, 0xb4, 0x8a, 0x68, 0x0e, 0x2e, 0xd8, 0x0f, 0x48,
+  0x25, 0x0c, 0xc3, 0x2e, 0x0f, 0xeb, 0xb5, 0x02, 0x08, 0x5b, 0xdf, 0x06,
+  0xe9, 0x11, 0xf1, 0x69, 0x5b, 0x8a, 0xe3, 0xfa, 0x99, 0x42, 0xf6, 0xcc,
+  0xed, 0x43, 0xe7, 0x0e, 0x47, 0xfe, 0x2c, 0x82, 0xa8, 0x54, 0xdf, 0xef,
+  0xdf, 0x96, 0xbd, 0x3f, 0xfc, 0x5a, 0x03, 0x63, 0x12, 0x33, 0x86, 0x94,
+  0x64, 0x56, 0xc1, 0xad, 0x3d, 0xdd, 0x33, 0xd2, 0xf1, 0x68, 0x25, 0xfb,
+  0x8c, 0x0c, 0x0c, 0xaf, 0xaa, 0xde, 0xeb, 0x96, 0x66, 0x34, 0x0b, 0xd2,
+  0x98, 0x90, 0x22, 0xc7, 0x09, 0x70, 0x98, 0x49, 0x76, 0xe6, 0xc8, 0x51,
+  0xea, 0xfd, 0x21, 0xb3, 0x7f, 0xea, 0x56, 0x77, 0x3a, 0xa7, 0xff, 0xae,
+  0xa5, 0x81, 0x84, 0x10, 0x42, 0x00, 0x6a, 0xbb, 0x5f, 0x51, 0x0e, 0x74,
+  0xd0, 0x2e, 0xaf, 0x76, 0x07, 0x87, 0xcf, 0x21, 0x00, 0x28, 0x34, 0x48,
+  0xf4, 0xca, 0x62, 0x87, 0x29, 0x46, 0x8b, 0x2b, 0xc2, 0x23, 0xcc, 0xe6,
+  0xfa, 0x1e, 0x2a, 0xc6, 0x12, 0xc3, 0x9d, 0x26, 0xb2, 0x82, 0x93, 0xe0,
+  0xef, 0xd9, 0x43, 0x46, 0xbc, 0x50, 0x31, 0x91, 0xf3, 0x6c, 0x56, 0x6e,
+  0x3e, 0xc3, 0xf3, 0xe5, 0x3a, 0x4b, 0xd6, 0x2e, 0x3a, 0xcf, 0xe9, 0x81,
+  0x2f, 0xe6, 0xdd, 0xc7, 0x6c, 0x7b, 0x39, 0x91, 0xd7, 0xf3, 0x48, 0x9c,
+  0xf2, 0x82, 0x40, 0xf7, 0x30, 0xde, 0x9e, 0xfd, 0x06, 0x49, 0x02, 0xa1,
+  0xbd, 0x46, 0xfd, 0x6d, 0xe4, 0x13, 0x97, 0xbb, 0x0c, 0xbe, 0xbc, 0x20,
+  0xce, 0xf6, 0xa8, 0xff, 0xb9, 0x3b, 0xa7, 0xe7, 0xdc, 0x5c, 0x65, 0x4d,
+  0x91, 0x18, 0xa7, 0x45, 0x55, 0x98, 0x8d, 0x53, 0xcc, 0x78, 0x1f, 0x33,
+  0x42, 0x7f, 0x07, 0xf9, 0xc8, 0x83, 0x5c, 0x3a, 0xc5, 0xf2, 0xf3, 0xc3,
+  0x4b, 0xf0, 0x63, 0x1c, 0xe7, 0x27, 0xa8, 0xb8, 0x9c, 0x20, 0xfd, 0x23,
+  0xac, 0x00, 0x7a, 0x5c, 0xb9, 0x65, 0x2a, 0x15, 0xcb, 0xd1, 0xe7, 0xa7,
+  0xf3, 0xbc, 0x26, 0x70, 0xc8, 0x69, 0xbc, 0xe7, 0x1c, 0x28, 0x70, 0x7a,
+  0xce, 0x3e, 0x51, 0xd0, 0x9e, 0xa9, 0xa5, 0x58, 0xfd, 0x0a, 0xbe, 0xe7,
+  0x5d, 0x5d, 0x9c, 0x1c, 0x93, 0x1e, 0x1a, 0x05, 0xf2, 0x40, 0x17, 0x3d,
+  0x76, 0x10, 0xda, 0x56, 0x6b, 0xc9, 0xb6, 0x96, 0xe4, 0x34, 0xb8, 0x9f,
+  0x32, 0x6c, 0xe2, 0xc2, 0x9d, 0x61, 0x66, 0x97, 0x75, 0x08, 0x13, 0x47,
+  0xd3, 0x9b, 0x5c, 0xe7, 0x05, 0xf3, 0x3c, 0xb8, 0x53, 0xf9, 0xe4, 0x3d,
+  0xaa, 0x5f, 0x6c, 0xa8, 0xe7, 0xf8, 0xcf, 0x47, 0x10, 0x3e, 0x5b, 0xb5,
+  0x90, 0xec, 0x0b, 0x4f, 0xa2, 0x69, 0x7a, 0x53, 0xbe, 0x3b, 0x51, 0x7a,
+  0x3e, 0x12, 0x35, 0x38, 0xc0, 0xc1, 0x5b, 0x2f, 0xa8, 0xa0, 0xca, 0x71,
+  0x17, 0xc7, 0x39, 0x4b, 0xa3, 0x39, 0xe7, 0x7c, 0x07, 0xbe, 0x09, 0xe2,
+  0x51, 0xfa, 0xa7, 0x4c, 0xfc, 0x21, 0x03, 0x05, 0xa2, 0xff, 0x48, 0x32,
+  0x92, 0x54, 0x68, 0x4c, 0xb8, 0xec, 0x62, 0xe5, 0xb3, 0x3d, 0x90, 0x39,
+  0x2f, 0x6c, 0x04, 0x39, 0x06, 0xe7, 0xc7, 0x2f, 0xf5, 0x61, 0xfc, 0x80,
+  0x05, 0xde, 0x67, 0x6f, 0xae, 0x89, 0x4f, 0x9f, 0xd1, 0xf3, 0x26, 0x31,
+  0x27, 0x85, 0xb2, 0x98, 0x32, 0x95, 0x81, 0xbc, 0xd3, 0x32, 0xf8, 0x0a,
+  0x2d, 0x60, 0xcb, 0x1b, 0x2a, 0xa0, 0x93, 0xd2, 0xbb, 0x42, 0x9b, 0x8c,
+  0xdb, 0xe9, 0xe3, 0x93, 0x80, 0x39, 0x2a, 0x72, 0xa7, 0x59, 0x36, 0x5e,
+  0xeb, 0x02, 0xa2, 0x79, 0x7c, 0x10, 0x1c, 0x11, 0x02, 0xb4, 0x27, 0x4e,
+  0xef, 0x57, 0xbe, 0x74, 0x2b, 0xf3, 0x93, 0x34, 0x5c, 0x20, 0x71, 0x9e,
+  0x96, 0xaf, 0xed, 0xe7, 0xfc, 0x73, 0x3f, 0xc7, 0x4e, 0xad, 0xa1, 0x94,
+  0x17, 0x4c, 0xd1, 0xa0, 0x0e, 0x68, 0xcf, 0x30, 0x00, 0xeb, 0x15, 0x7b,
+  0xc8, 0xf4, 0x57, 0x9e, 0xb1, 0x0d, 0x78, 0x62, 0x58, 0x43, 0x86, 0x3a,
+  0x23, 0xf2, 0xb5, 0x87, 0x8e, 0x04, 0x4d, 0x84, 0x06, 0xf3, 0xb4, 0xc9,
+  0xbe, 0xee, 0x7c, 0x6d, 0x82, 0xa8, 0x07, 0xfc, 0xa2, 0x91, 0xf9, 0x73,
+  0x3c, 0x96, 0x70, 0xd7, 0xb9, 0x8f, 0xc8, 0x3a, 0xaa, 0x18, 0x16, 0x31,
+  0x5c, 0x0f, 0x20, 0x0f, 0x6f, 0x54, 0x70, 0xcd, 0x01, 0x91, 0xfa, 0xd2,
+  0xf3, 0x32, 0xcc, 0x91, 0xdb, 0x64, 0x71, 0x24, 0x5f, 0xa6, 0xb1, 0xe6,
+  0xd4, 0xe6, 0x79, 0xbb, 0xa8, 0xcc, 0xf9, 0x30, 0xf7, 0x98, 0x35, 0xb0,
+  0xa5, 0xbf, 0x5a, 0x61, 0x7e, 0x60, 0xff, 0x38, 0xcb, 0x45, 0x65, 0x7b,
+  0xfa, 0x75, 0x5d, 0x68, 0x33, 0xa5, 0x3c, 0x61, 0xc5, 0x3f, 0x48, 0x8d,
+  0xa5, 0xe2, 0x77, 0x3e, 0x79, 0xa9, 0xcf, 0x44, 0x57, 0x97, 0xb9, 0x5a,
+  0x63, 0x02, 0xae, 0x27, 0x0f, 0x0a, 0x3f, 0x31, 0xa2, 0x5e, 0x69, 0xcd,
+  0x90, 0xb2, 0x9d, 0xdf, 0xe2, 0xc3, 0xf3, 0xfd, 0x39, 0xf8, 0x22, 0x60,
+  0x4c, 0x04, 0x7f, 0x94, 0x91, 0xea, 0x59, 0xc2, 0x6f, 0x85, 0x1b, 0x32,
+  0x38, 0xd7, 0x90, 0x2c, 0xdb, 0x6b, 0x97, 0x3f, 0x3e, 0x38, 0xa6, 0x9e,
+  0xaf, 0x6d, 0x36, 0x6c, 0x4d, 0xfa, 0x79, 0x2a, 0xe7, 0x9d, 0xce, 0x5f,
+  0x17, 0xd1, 0x0a, 0xc1, 0x65, 0x02, 0x6b, 0x30, 0xfb, 0x12, 0x51, 0xe2,
+  0x42, 0xd3, 0x9c, 0x1d, 0xed, 0x2e, 0x11, 0x82, 0x31, 0x72, 0xf0, 0xbd,
+  0xb8, 0x33, 0x9c, 0x9c, 0x79, 0xb1, 0x76, 0x7d, 0x5e, 0xd2, 0xcc, 0xb7,
+  0x79, 0xcc, 0x8c, 0x9f, 0xdb, 0xf8, 0x7c, 0x23, 0x96, 0xe1, 0x9c, 0x89,
+  0xd4, 0xa1, 0x3f, 0xe5, 0x85, 0xbb, 0xb6, 0x8c, 0x20, 0x17, 0xe2, 0xba,
+  0x9c, 0x8b, 0x70, 0x6d, 0xde, 0x20, 0xc7, 0x69, 0xf4, 0xec, 0x73, 0x94,
+  0xe3, 0x78, 0x08, 0x52, 0x0b, 0x8d, 0x8d, 0xc0, 0x7e, 0xc0, 0x83, 0xa9,
+  0x99, 0x8c, 0x64, 0xa8, 0x6d, 0x0b, 0x56, 0x8d, 0xbe, 0x3c, 0xf9, 0xd3,
+  0x67, 0x28, 0xb7, 0xe6, 0xe5, 0xe2, 0xa6, 0x2b, 0x84, 0x63, 0xc6, 0x48,
+  0x2f, 0x29, 0xa3, 0xe1, 0xb6, 0x90, 0x0a, 0xbf, 0xa4, 0x5c, 0x3d, 0xe5,
+  0xe9, 0x07, 0x8f, 0x26, 0xb5, 0x27, 0x0f, 0xc8, 0x0f, 0x60, 0x76, 0x65,
+  0x49, 0x96, 0x33, 0x7c, 0x52, 0xce, 0x6f, 0x57, 0xdc, 0xdb, 0xf3, 0x54,
+  0x8f, 0xea, 0xd3, 0xb2, 0xac, 0x77, 0xd5, 0xf0, 0xc5, 0x83, 0x0f, 0x64,
+  0x30, 0xc2, 0x02, 0x04, 0xfa, 0x2e, 0x47, 0x33, 0xe9, 0xc9, 0x09, 0x06,
+  0x22, 0x7b, 0x4e, 0x06, 0xef, 0xda, 0x9f, 0x1b, 0x3e, 0x0f, 0xd2, 0xc2,
+  0xdb, 0xf5, 0x46, 0xd3, 0x29, 0x43, 0x23, 0x33, 0x20, 0xe4, 0x91, 0x08,
+  0x1f, 0xcc, 0x97, 0x8d, 0x5a, 0x8a, 0xb8, 0x79, 0x2c, 0x02, 0x58, 0x5e,
+  0x50, 0x4d, 0x45, 0xde, 0xf2, 0x2e, 0x4e, 0xd8, 0xdc, 0xf3, 0x3c, 0x5e,
+  0x3c, 0x8a, 0x7c, 0x66, 0xf1, 0x97, 0x49, 0xf2, 0x8e, 0x6b, 0x4b, 0x64,
+  0xb0, 0x36, 0x33, 0x8f, 0x1f, 0xd3, 0x9d, 0x5f, 0x9c, 0x4c, 0xe4, 0x24,
+  0x52, 0x72, 0xd1, 0xea, 0xe5, 0x22, 0x84, 0xe1, 0x46, 0xf0, 0xa1, 0xef,
+  0x09, 0xa6, 0x09, 0xa6, 0x44, 0x5f, 0x15, 0xe7, 0x2f, 0xdc, 0x46, 0x6a,
+  0xf2, 0xe8, 0xa5, 0xb2, 0x22, 0x8f, 0x20, 0x9b, 0xc9, 0xe4, 0x0b, 0x36,
+  0x6e, 0xb2, 0x24, 0xcb, 0x5d, 0xb2, 0x42, 0x9d, 0x81, 0x22, 0x71, 0xae,
+  0x43, 0xc1, 0xa8, 0x81, 0xb9, 0x59, 0xa2, 0x84, 0xa5, 0x80, 0x5f, 0x77,
+  0x85, 0xfc, 0xc9, 0x15, 0x83, 0x7a, 0xa3, 0x4b, 0x66, 0xc7, 0xa9, 0x56,
+  0xaf, 0xf8, 0x73, 0xb2, 0x33, 0xb4, 0x02, 0x07, 0x10, 0x7e, 0xc2, 0xcd,
+  0x78, 0x60, 0x95, 0x30, 0x1a, 0xb0, 0xaa, 0x2b, 0xd2, 0x18, 0x89, 0xe5,
+  0x6f, 0x1d, 0xaf, 0x0f, 0x58, 0xd0, 0x7a, 0xf4, 0x00, 0xf8, 0x64, 0xe8,
+  0x2c, 0x81, 0x00, 0xbb, 0x98, 0xe9, 0x6c, 0x43, 0x68, 0x55, 0xc5, 0x9b,
+  0x8e, 0xaf, 0x21, 0x35, 0xae, 0x2d, 0x33, 0x65, 0xf5, 0xfc, 0xf4, 0xa5,
+  0x26, 0xf2, 0x5c, 0x62, 0xde, 0xf0, 0x8a, 0x25, 0x88, 0xd6, 0x7e, 0x66,
+  0xa6, 0xaa, 0x35, 0x11, 0xe5, 0xa6, 0xa1, 0x6b, 0x4b, 0x44, 0xfa, 0xb5,
+  0x02, 0x6c, 0x41, 0x54, 0x19, 0xf0, 0x4b, 0x91, 0x66, 0x2f, 0x3c, 0xbf,
+  0x87, 0x85, 0xfb, 0x24, 0x7e, 0x4b, 0x31, 0xb2, 0xac, 0x47, 0x7c, 0xff,
+  0xf9, 0x1a, 0x18, 0x95, 0x62, 0xef, 0x97, 0xf7, 0xf0, 0x02, 0xef, 0x46,
+  0xc3, 0x20, 0x95, 0xa2, 0x75, 0x4f, 0x67, 0x03, 0x06, 0xec, 0xd0, 0x58,
+  0xea, 0x6c, 0x9c, 0x11, 0x4e, 0x5a, 0x0f, 0x1a, 0xcc, 0x67, 0x33, 0x74,
+  0x9c, 0xc2, 0x7b, 0xef, 0xeb, 0x45, 0xe7, 0x6b, 0xde, 0x9a, 0xd1, 0xa7,
+  0x35, 0x05, 0xd5, 0x2d, 0xd5, 0x5a, 0x1d, 0x6c, 0x59, 0x3d, 0xd1, 0xf0,
+  0x6f, 0xea, 0x89, 0xd9, 0xf4, 0xa4, 0x29, 0xdd, 0xdf, 0x3f, 0xbf, 0xf3,
+  0xa7, 0xff, 0xa8, 0xb9, 0x95, 0x96, 0x59, 0xed, 0x43, 0x30, 0x56, 0xc8,
+  0x31, 0xa0, 0x1d, 0x97, 0xab, 0xf2, 0xd4, 0x17, 0xaa, 0xb3, 0xfa, 0x34,
+  0xbb, 0xc0, 0xce, 0x36, 0xa4, 0x95, 0x7a, 0x52, 0xaf, 0x63, 0xeb, 0xf9,
+  0x1a, 0x89, 0x22, 0x9b, 0x28, 0xab, 0x28, 0x48, 0x4a, 0x75, 0x6f, 0xa2,
+  0xf2, 0xad, 0x29, 0x23, 0xe1, 0xff, 0xa2, 0xad, 0xee, 0xd6, 0x17, 0x17,
+  0xb2, 0xcc, 0x5c, 0x87, 0x30, 0xea, 0xe5, 0x9d, 0xec, 0x85, 0xc3, 0x18,
+  0x3c, 0x6a, 0xb4, 0x84, 0xbd, 0x0e, 0x5d, 0xa6, 0x73, 0xa4, 0xd4, 0xda,
+  0xbc, 0x71, 0x13, 0xfb, 0x37, 0xab, 0xac, 0x6b, 0x59, 0xb2, 0xfa, 0x92,
+  0x3d, 0xd7, 0x40, 0xc7, 0xf6, 0x3a, 0xf3, 0x70, 0x91, 0xa1, 0x2f, 0x0a,
+  0x08, 0x2a, 0xf3, 0xe0, 0xca, 0x4c, 0x3a, 0xd7, 0x84, 0x92, 0x02, 0x54,
+  0x57, 0xf3, 0xc7, 0x7d, 0x46, 0x4c, 0xf1, 0x5a, 0xf3, 0x02, 0x19, 0x09,
+  0xbf, 0xe9, 0x53, 0xad, 0x0c, 0x6c, 0x87, 0x9c, 0x82, 0xd4, 0x3a, 0x23,
+  0xfa, 0x93, 0xd6, 0xb6, 0xc0, 0x97, 0x16, 0x34, 0x89, 0x52, 0x14, 0x38,
+  0xab, 0x5d, 0x72, 0xf6, 0x22, 0xc5, 0x07, 0xeb, 0x65, 0xe4, 0x29, 0x6c,
+  0x3b, 0x8e, 0x48, 0x70, 0xcc, 0x25, 0xf5, 0x05, 0xe1, 0xfb, 0x8f, 0xeb,
+  0xfe, 0x0d, 0x4f, 0xdc, 0x8e, 0x96, 0x5a, 0x6d, 0x3c, 0xa6, 0xcc, 0x13,
+  0x94, 0xfd, 0x73, 0x8f, 0xf0, 0xc8, 0x9b, 0x72, 0x72, 0x45, 0x1a, 0xea,
+  0x08, 0x09, 0x3d, 0xea, 0xe5, 0x2f, 0x2c, 0x41, 0xf5, 0x7d, 0xb2, 0x9d,
+  0x0f, 0xab, 0x49, 0xe3, 0xad, 0xfe, 0x94, 0xf5, 0x7e, 0x52, 0xbd, 0x26,
+  0xf5, 0x85, 0xfa, 0xff, 0x0a, 0xe3, 0x5b, 0x60, 0x51, 0x8b, 0x89, 0x6f,
+  0xda, 0x43, 0xea, 0xfa, 0xa6, 0xdf, 0xe0, 0xaf, 0x43, 0x59, 0xd0, 0x5c,
+  0x5d, 0x5d, 0xe9, 0xfd, 0x3c, 0xb4, 0x7d, 0xf5, 0x3b, 0x45, 0xd6, 0x1a,
+  0x23, 0x21, 0x10, 0x63, 0x67, 0x89, 0x3e, 0xbb, 0x8b, 0x49, 0x1b, 0x6d,
+  0x03, 0x32, 0xc4, 0x07, 0xb9, 0x1f, 0xfe, 0x06, 0x8f, 0xff, 0x88, 0xd0,
+  0xee, 0x38, 0x47, 0x42, 0x56, 0x93, 0xf8, 0x07, 0x02, 0x48, 0x94, 0xf3,
+  0xb8, 0xe7, 0x73, 0xa9, 0xde, 0xd5, 0xd0, 0x23, 0x45, 0x37, 0x72, 0x76,
+  0x2b, 0x1e, 0x2f, 0xa8, 0xab, 0x48, 0xa7, 0xfb, 0x9e, 0x80, 0x13, 0x49,
+  0x82, 0x26, 0x98, 0xbe, 0x97, 0xd1, 0x4f, 0x9f, 0x17, 0x8f, 0x19, 0xc7,
+  0x9f, 0x08, 0xd0, 0x20, 0x62, 0xb7, 0x58, 0xe0, 0x9b, 0x22, 0x42, 0xa5,
+  0x26, 0xd0, 0x9b, 0x8b, 0x21, 0x56, 0xbd, 0x0c, 0x9d, 0x4e, 0x66, 0xeb,
+  0x33, 0x42, 0xc4, 0xf1, 0x49, 0x81, 0x0d, 0x5a, 0x52, 0x26, 0x72, 0xfb,
+  0x09, 0x0e, 0x8e, 0x3a, 0xc0, 0x0d, 0x8e, 0x3e, 0x56, 0x3f, 0xfd, 0x24,
+  0x68, 0x4f, 0x8f, 0xf5, 0x78, 0x63, 0x4d, 0xc1, 0xfd, 0xd9, 0x97, 0x95,
+  0x6d, 0x48, 0xe8, 0x03, 0xfd, 0x62, 0xfe, 0x29, 0x21, 0xe0, 0xa9, 0x0d,
+  0x77, 0x90, 0x3e, 0xe1, 0x66, 0x92, 0x5b, 0x31, 0x4a, 0x53, 0x69, 0x1e,
+  0xbd, 0x25, 0xf4, 0xcd, 0xe7, 0x3d, 0xdb, 0xc1, 0x7e, 0x21, 0x47, 0xb6,
+  0xff, 0xb2, 0x71, 0x61, 0x3b, 0xd9, 0x72, 0x55, 0x71, 0xbc, 0x7f, 0xfe,
+  0xb5, 0x90, 0xc2, 0xec, 0xc5, 0x7b, 0xee, 0xa3, 0x13, 0x36, 0x70, 0x44,
+  0x7d, 0xb4, 0xb4, 0xc7, 0x96, 0x24, 0x14, 0x8f, 0x98, 0xe5, 0x65, 0xb1,
+  0xa5, 0x76, 0x29, 0x69, 0x32, 0x34, 0x55, 0x74, 0x18, 0x87, 0x19, 0x72,
+  0xb1, 0x60, 0x14, 0xf3, 0x14, 0xc8, 0x13, 0x44, 0xbb, 0x2c, 0x18, 0x89,
+  0x33, 0xb0, 0x7a, 0x9e, 0x28, 0x72, 0x72, 0x9f, 0x4e, 0x9a, 0xd0, 0x48,
+  0x45, 0x6f, 0x7d, 0x6d, 0x6e, 0x49, 0x68, 0xdf, 0x37, 0x8a, 0xf0, 0x60,
+  0x74, 0xc0, 0x1c, 0x85, 0x30, 0x80, 0x71, 0xd6, 0xa9, 0xf3, 0x06, 0x9f,
+  0x76, 0x5c, 0x66, 0xcd, 0xc7, 0xfe, 0x08, 0x89, 0x67, 0x82, 0x81, 0xae,
+  0x91, 0x91, 0x8c, 0x47, 0x2d, 0xf8, 0x31, 0xc6, 0x0d, 0x20, 0xce, 0xfa,
+  0xed, 0x59, 0x8f, 0x5f, 0x9f, 0xbe, 0x36, 0xff, 0x32, 0x12, 0x49, 0x00,
+  0x6a, 0xf0, 0x1f, 0xac, 0x3f, 0xc6, 0xcf, 0xf0, 0xaa, 0xcb, 0x9e, 0xc9,
+  0x50, 0x34, 0x8a, 0xb0, 0xf1, 0xb5, 0x99, 0x7e, 0x21, 0xe6, 0xdf, 0x52,
+  0x2f, 0xe9, 0x40, 0xc5, 0xec, 0x7e, 0xc5, 0x48, 0x6a, 0x0d, 0xfc, 0x69,
+  0x7b, 0x88, 0xd3, 0x33, 0xa9, 0xc8, 0x50, 0x28, 0xfd, 0xa3, 0x92, 0x1e,
+  0xa3, 0x29, 0x39, 0xcd, 0x3f, 0x70, 0x3e, 0x3c, 0x41, 0x30, 0xbb, 0xba,
+  0xa0, 0x49, 0x95, 0x79, 0x65, 0x95, 0x53, 0x59, 0xda, 0xa4, 0x36, 0x90,
+  0x1a, 0x16, 0xd6, 0x17, 0xde, 0xcd, 0x6e, 0x38, 0x33, 0x51, 0x73, 0x29,
+  0xdf, 0xd7, 0x16, 0x7d, 0x3b, 0x23, 0xad, 0xfa, 0x49, 0xa2, 0x6f, 0xd4,
+  0x37, 0xe5, 0x4f, 0xb5, 0x00, 0xaa, 0x45, 0xd9, 0xf4, 0x09, 0x3c, 0xb3,
+  0x98, 0x15, 0x2f, 0xfc, 0xa3, 0xf1, 0x82, 0x7a, 0x30, 0x8a, 0x08, 0x5e,
+  0xf0, 0xe5, 0xef, 0xf7, 0x76, 0xff, 0xae, 0x80, 0x3d, 0x63, 0x73, 0xe3,
+  0xe3, 0x2d, 0x4c, 0x45, 0x1b, 0x3a, 0x7f, 0x59, 0x2e, 0x15, 0x56, 0xad,
+  0xfe, 0xa1, 0x42, 0x2c, 0xb8, 0xad, 0x25, 0xf9, 0x59, 0x4a, 0x97, 0x74,
+  0xff, 0xc0, 0x2f, 0xb8, 0x22, 0x0a, 0x71, 0xe7, 0xc1, 0x03, 0x65, 0xbb,
+  0x9a, 0xa5, 0xbf, 0x07, 0xaa, 0x25, 0x28, 0xa7, 0x7d, 0xb4, 0xff, 0x36,
+  0x3d, 0x44, 0xac, 0x55, 0xc6, 0x82, 0xaf, 0x2a, 0x13, 0xbf, 0x75, 0xbe,
+  0xee, 0xcf, 0xd4, 0xd2, 0x1e, 0xcc, 0xca, 0x4f, 0x54, 0x4a, 0xd9, 0x09,
+  0xf3, 0x71, 0x4a, 0x08, 0xb2, 0x63, 0xdf, 0x3c, 0xd8, 0x23, 0x89, 0x4e,
+  0x92, 0xd2, 0xd7, 0x2f, 0xde, 0xe1, 0x1c, 0x0e, 0xd0, 0x21, 0xc8, 0x45,
+  0x45, 0x5e, 0x6c, 0xdd, 0xd5, 0x72, 0xfb, 0x9d, 0x9c, 0x67, 0xf7, 0xe1,
+  0xf1, 0x7e, 0x83, 0x4e, 0xbc, 0xb1, 0xae, 0xb0, 0xf6, 0x54, 0xcb, 0x1a,
+  0xbe, 0xce, 0xa9, 0xfd, 0x23, 0xd6, 0x35, 0x80, 0xdd, 0xc1, 0x3b, 0x9c,
+  0x89, 0x20, 0x4d, 0xe5, 0x07, 0x5a, 0x92, 0xc8, 0xa3, 0x0c, 0x05, 0x1d,
+  0x2c, 0xf1, 0x8f, 0xcf, 0x13, 0xbe, 0x30, 0xd1, 0x5d, 0x8c, 0x29, 0x20,
+  0xd4, 0x0a, 0x15, 0xd0, 0x6c, 0xec, 0x8f, 0x87, 0xc2, 0xcd, 0xd7, 0x0f,
+  0x39, 0x5c, 0xff, 0x67, 0x16, 0x5c, 0x1f, 0x6d, 0xb8, 0x79, 0x04, 0x70,
+  0x73, 0xa6, 0x05, 0x6e, 0x6e, 0xa2, 0xad, 0x93, 0xbf, 0x61, 0x38, 0x21,
+  0x87, 0xd5, 0x72, 0xcb, 0x56, 0x5a, 0x13, 0xc5, 0xfd, 0x76, 0x4e, 0x8d,
+  0x51, 0x54, 0xec, 0xf2, 0xda, 0x1c, 0xbe, 0x44, 0x84, 0x6b, 0x10, 0xcc,
+  0xda, 0x5b, 0x6d, 0x56, 0xf5, 0x96, 0x7d, 0x78, 0x95, 0x5b, 0x95, 0xcb,
+  0xba, 0x89, 0x3a, 0xdf, 0xfa, 0xd3, 0x16, 0xf3, 0xcb, 0x95, 0x6d, 0xd9,
+  0x70, 0x5c, 0xfe, 0x28, 0x63, 0xa1, 0x6e, 0x19, 0x1f, 0xc5, 0xce, 0x75,
+  0xfa, 0xdd, 0xb2, 0x1e, 0x45, 0xd7, 0x81, 0xed, 0x7d, 0x07, 0x8f, 0xe3,
+  0xec, 0xb2, 0xca, 0x72, 0x44, 0x47, 0xd4, 0xe2, 0x9d, 0x46, 0xd8, 0x22,
+  0x0d, 0x5f, 0xb5, 0x09, 0x74, 0x9e, 0x29, 0x9b, 0xf5, 0x2f, 0xde, 0x7b,
+  0x4b, 0x26, 0xef, 0x3d, 0xf5, 0x86, 0x79, 0xb8, 0xe4, 0x4d, 0xa5, 0xee,
+  0x3e, 0x3b, 0xfd, 0x39, 0xc9, 0x57, 0xdb, 0x28, 0x66, 0x7a, 0x43, 0x68,
+  0xa5, 0x6e, 0xcc, 0x52, 0xae, 0x3d, 0x9d, 0xde, 0xf9, 0x6f, 0x22, 0x71,
+  0x95, 0x6d, 0xce, 0xe7, 0x75, 0xa2, 0xdf, 0x40, 0xf8, 0xb0, 0x4e, 0x21,
+  0x09, 0x5b, 0x25, 0xec, 0x9f, 0x26, 0x48, 0xea, 0x5c, 0x51, 0xa5, 0xc5,
+  0x72, 0x34, 0x49, 0x7f, 0x0a, 0x1a, 0x83, 0x95, 0x0f, 0x7b, 0xe2, 0xe2,
+  0x1e, 0xcf, 0xa2, 0x73, 0x49, 0xe1, 0xd5, 0x97, 0x6d, 0xd8, 0xc0, 0x32,
+  0xdd, 0xf6, 0xf5, 0x08, 0x5a, 0x70, 0x65, 0xfd, 0x3c, 0x61, 0x3a, 0x9f,
+  0x37, 0x88, 0x7b, 0xa7, 0x84, 0x2d, 0x06, 0xf0, 0xf6, 0x6e, 0xa8, 0x07,
+  0xeb, 0xb6, 0x1e, 0x61, 0x8a, 0x3b, 0xa0, 0x6c, 0x7f, 0x7a, 0xe7, 0x7e,
+  0x5f, 0xb6, 0xb0, 0x0d, 0xc5, 0x16, 0x91, 0x1f, 0x0d, 0x99, 0x82, 0x23,
+  0x09, 0xb0, 0xf9, 0x29, 0xae, 0xc3, 0x1b, 0x85, 0x83, 0x9a, 0x4c, 0xd2,
+  0x18, 0xb0, 0x14, 0xe2, 0x39, 0xe8, 0xcf, 0xef, 0x45, 0x92, 0xa0, 0xb1,
+  0x64, 0xf5, 0xff, 0x07, 0x80, 0x09, 0x5a, 0xe8, 0x8f, 0x41, 0x06, 0x04,
+  0x81, 0xb0, 0xe7, 0xcd, 0xe3, 0x2e, 0x9f, 0x34, 0x71, 0x97, 0x55, 0x3d,
+  0x63, 0x40, 0xc1, 0x12, 0xda, 0xf3, 0xb0, 0xd2, 0xaf, 0xe8, 0x83, 0xdf,
+  0xc5, 0x82, 0x54, 0xbd, 0x34, 0xae, 0xb5, 0xa4, 0x8b, 0xb9, 0xd8, 0xac,
+  0x9c, 0x9f, 0xc8, 0x12, 0x4d, 0x4e, 0xd6, 0x03, 0x1d, 0xf6, 0x09, 0x1a,
+  0x9b, 0xf7, 0x90, 0x99, 0xc5, 0x06, 0x40, 0x79, 0x01, 0x5a, 0x8e, 0x17,
+  0x61, 0x77, 0xa4, 0x03, 0xda, 0xff, 0xf9, 0x19, 0x20, 0x47, 0xbf, 0x0a,
+  0x61, 0x0e, 0x77, 0xe4, 0x61, 0x08, 0x6f, 0xde, 0x7f, 0x93, 0x5e, 0x28,
+  0x64, 0xba, 0x8b, 0x67, 0x2d, 0xc4, 0xcb, 0x6d, 0x7e, 0x39, 0x09, 0xcd,
+  0xc2, 0x57, 0x7d, 0x77, 0x06, 0xc6, 0x41, 0x09, 0xe9, 0x8d, 0x74, 0xe9,
+  0xc9, 0x3c, 0x18, 0x16, 0x55, 0xea, 0x76, 0x05, 0x12, 0xc6, 0x28, 0xfe,
+  0x11, 0x39, 0x9b, 0xe4, 0x82, 0xa2, 0xbb, 0x64, 0xb3, 0xb0, 0x0d, 0xa5,
+  0x63, 0xd5, 0x81, 0x8e, 0x0c, 0x21, 0x7a, 0x68, 0x51, 0x82, 0xc1, 0xbf,
+  0xe9, 0xa8, 0x1d, 0x1e, 0x89, 0xad, 0x46, 0xbd, 0xb0, 0x68, 0x95, 0xc0,
+  0x6f, 0x5c, 0x74, 0x8f, 0xb9, 0x5e, 0x6d, 0xb1, 0xa4, 0x38, 0x78, 0x2d,
+  0xf6, 0xed, 0x44, 0x7e, 0xe1, 0x9b, 0xf3, 0x97, 0x13, 0xb4, 0x13, 0x99,
+  0xfa, 0x4a, 0x84, 0x1c, 0xb9, 0xaf, 0xf8, 0xb0, 0x2d, 0x11, 0xd1, 0x91,
+  0xb4, 0xa9, 0x01, 0x29, 0xda, 0x0e, 0x6a, 0x46, 0x53, 0x97, 0xcb, 0x3a,
+  0x94, 0xf1, 0x8e, 0x1c, 0xb9, 0x43, 0x1a, 0x5d, 0x81, 0x1e, 0xcf, 0xdc,
+  0xa1, 0x38, 0x50, 0x8d, 0x76, 0x6c, 0x07, 0x9e, 0x84, 0x1b, 0x3b, 0x5a,
+  0x85, 0xa5, 0x74, 0x1f, 0x74, 0xfa, 0x6e, 0xe7, 0xad, 0x80, 0x36, 0x9d,
+  0x48, 0x2e, 0xc4, 0x43, 0x9a, 0xda, 0xe9, 0x5e, 0xd4, 0xbb, 0x15, 0x7c,
+  0xab, 0x5b, 0x2d, 0x73, 0xde, 0xc4, 0xa2, 0xe6, 0xa1, 0x95, 0x8f, 0x58,
+  0x08, 0xf8, 0x18, 0x99, 0x88, 0xa8, 0x2f, 0x65, 0x83, 0x2b, 0x74, 0xc2,
+  0x7c, 0x6e, 0x08, 0x1e, 0xaf, 0x26, 0xc9, 0x71, 0x73, 0xbd, 0xf7, 0x07,
+  0x34, 0x30, 0x1d, 0xc3, 0x65, 0x75, 0x48, 0x7f, 0x5c, 0x1d, 0x34, 0x65,
+  0x07, 0x96, 0x8e, 0x3c, 0xe1, 0x1a, 0xa2, 0x1f, 0x20, 0xb8, 0xbf, 0x07,
+  0x44, 0x58, 0x30, 0x45, 0x84, 0xf0, 0xb0, 0xa8, 0x0d, 0x66, 0xbb, 0x4c,
+  0x51, 0xc0, 0xe5, 0x72, 0x7a, 0x72, 0xf1, 0x38, 0x79, 0x56, 0x48, 0xb9,
+  0xc1, 0xc8, 0xa3, 0xfe, 0x44, 0x68, 0x61, 0xd1, 0xb0, 0x27, 0x6f, 0x58,
+  0x4e, 0x01, 0x63, 0xf9, 0xf0, 0xd0, 0x61, 0x89, 0xcd, 0x6e, 0x58, 0x3c,
+  0xf0, 0x0d, 0x56, 0xcd, 0xf0, 0x07, 0xcb, 0xd2, 0x9f, 0xd5, 0xbb, 0x14,
+  0x0a, 0x2b, 0x1e, 0xa0, 0x27, 0xac, 0x2d, 0x6e, 0xe0, 0xcb, 0x60, 0x8c,
+  0x58, 0x0f, 0xda, 0xdc, 0x19, 0xf8, 0x01, 0x3e, 0x8b, 0xa2, 0x71, 0xe5,
+  0x29, 0x29, 0x46, 0x93, 0x3f, 0x1f, 0x08, 0x4f, 0x4d, 0x8f, 0x22, 0xdc,
+  0x3c, 0x34, 0x6e, 0xea, 0x45, 0x68, 0x5a, 0x7e, 0xa5, 0x8d, 0x8d, 0xb2,
+  0x4f, 0x79, 0xce, 0x4f, 0x03, 0xba, 0xcc, 0x34, 0xb7, 0x7a, 0x1c, 0x84,
+  0x0f, 0x09, 0x8d, 0x0c, 0x2a, 0x36, 0x7a, 0x76, 0x87, 0xc1, 0x0d, 0x68,
+  0xcb, 0xc7, 0xbb, 0x88, 0xd6, 0x29, 0x3a, 0x6a, 0xb3, 0x37, 0x10, 0x7d,
+  0x2f, 0xe6, 0xe0, 0xab, 0x6d, 0xcb, 0xe1, 0xe4, 0x45, 0xec, 0xb4, 0xef,
+  0x57, 0xf7, 0x6b, 0xc5, 0xcf, 0xf8, 0xab, 0xf8, 0xfe, 0x71, 0x8c, 0x53,
+  0x78, 0x53, 0xa5, 0x3f, 0xce, 0xc7, 0xe2, 0x0f, 0x43, 0x26, 0x06, 0x93,
+  0xf2, 0xb8, 0x0f, 0x20, 0x11, 0xea, 0xab, 0x82, 0x2e, 0x86, 0x14, 0x8a,
+  0xa4, 0xc4, 0x91, 0x8b, 0xf0, 0x0c, 0x1b, 0xb0, 0x00, 0xf7, 0xe1, 0x7f,
+  0xb3, 0xa7, 0xb6, 0x33, 0x0d, 0x8d, 0xaf, 0x3c, 0x3c, 0x39, 0xfe, 0x11,
+  0x85, 0x89, 0x1a, 0x02, 0x1a, 0xcf, 0x4c, 0x11, 0xd1, 0xa1, 0xee, 0x2d,
+  0x3a, 0x91, 0x57, 0x47, 0x73, 0xd7, 0x66, 0x8a, 0x10, 0xfd, 0x56, 0x6a,
+  0x38, 0xcc, 0xda, 0xd5, 0x8b, 0x95, 0x3a, 0x46, 0xf6, 0xeb, 0xe7, 0x8c,
+  0x5b, 0x36, 0xe9, 0xaa, 0x56, 0x58, 0x4b, 0xa7, 0xab, 0x62, 0x7e, 0x4e,
+  0x38, 0x55, 0xe6, 0xcb, 0xbf, 0x6f, 0x7b, 0x7b, 0xfd, 0xe5, 0xbf, 0x01,
+  0x2d, 0x1a, 0xf7, 0xe4, 0xa4, 0xe3, 0x16, 0x48, 0xdf, 0xbd, 0x67, 0xff,
+  0x69, 0xe4, 0x65, 0xe8, 0x6d, 0x19, 0xac, 0x2a, 0xee, 0x2e, 0x9d, 0xd1,
+  0xc1, 0x56, 0xdf, 0xd2, 0xfe, 0xaf, 0xa6, 0xd6, 0xb1, 0xdd, 0x63, 0xa5,
+  0xd1, 0x01, 0x6b, 0x57, 0x3c, 0x72, 0x17, 0x25, 0x16, 0x19, 0xce, 0x18,
+  0x85, 0xef, 0xa4, 0xb0, 0x95, 0x29, 0x60, 0x84, 0xbd, 0x62, 0x0c, 0xc7,
+  0x4e, 0x9f, 0x53, 0x38, 0x2a, 0xfa, 0x2f, 0x4a, 0x99, 0x07, 0xed, 0xe4,
+  0x03, 0xd8, 0x09, 0x7e, 0x88, 0x33, 0xe1, 0xc8, 0x98, 0x1b, 0xe5, 0x48,
+  0x18, 0xff, 0x9d, 0xb0, 0xf3, 0x5c, 0x61, 0x48, 0x38, 0xd5, 0x5a, 0x34,
+  0x02, 0x7a, 0x31, 0x46, 0x39, 0xc6, 0x2a, 0x7b, 0x91, 0xdd, 0x53, 0xab,
+  0x7c, 0xc4, 0x40, 0x0b, 0xcb, 0x46, 0x7c, 0x6c, 0xb8, 0x07, 0xbf, 0xaa,
+  0xee, 0x5a, 0x75, 0x12, 0x2d, 0x15, 0xf9, 0xe5, 0x34, 0x0a, 0x2e, 0x54,
+  0x84, 0x2d, 0x33, 0xbe, 0x95, 0xcb, 0x42, 0xeb, 0x09, 0x5c, 0x3c, 0x53,
+  0xbd, 0xb5, 0xde, 0xf1, 0xad, 0x1f, 0xc0, 0xb4, 0x31, 0x56, 0xda, 0xab,
+  0xd8, 0xdc, 0x78, 0x6d, 0x64, 0x4a, 0xdb, 0x9c, 0x79, 0x53, 0x9b, 0x48,
+  0xcb, 0x13, 0x89, 0xb4, 0x62, 0x00, 0xaa, 0xdd, 0x29, 0xd8, 0x98, 0xb7,
+  0xc4, 0x60, 0x66, 0x31, 0x36, 0xa8, 0x9e, 0x81, 0x98, 0x1b, 0x07, 0x84,
+  0x8c, 0x29, 0x92, 0x7e, 0xfa, 0xd8, 0x07, 0x07, 0x34, 0xf2, 0x82, 0x8f,
+  0x6b, 0xcc, 0x00, 0x4f, 0xd8, 0xd0, 0xe1, 0x59, 0xb2, 0x6b, 0x9a, 0xda,
+  0xa6, 0xc1, 0xa6, 0xba, 0xf6, 0x70, 0xa7, 0x35, 0xa5, 0x8d, 0x38, 0xe5,
+  0x45, 0x2d, 0x4e, 0x7a, 0x3a, 0xd5, 0x4d, 0xcd, 0x53, 0xfb, 0x34, 0xc4,
+  0x34, 0xea, 0x24, 0x75, 0xb4, 0x67, 0x33, 0x69, 0x8d, 0x37, 0x8d, 0x3c,
+  0xb5, 0x47, 0x7d, 0x19, 0xbd, 0xfa, 0xcf, 0x84, 0x05, 0x5c, 0x39, 0x75,
+  0x0c, 0xd3, 0x59, 0x7b, 0x78, 0x02, 0xbf, 0xca, 0x39, 0x1a, 0x2a, 0xb0,
+  0x48, 0xf9, 0x5d, 0xa1, 0x3e, 0xad, 0x5a, 0x87, 0x18, 0xee, 0x32, 0x9e,
+  0xcd, 0x41, 0xa2, 0x50, 0xdb, 0x06, 0x17, 0x8e, 0x5b, 0x81, 0xbb, 0x4b,
+  0xd3, 0x0d, 0x6e, 0xe3, 0x5b, 0x9c, 0x82, 0x80, 0x9d, 0x97, 0x64, 0xed,
+  0xa9, 0x87, 0x59, 0x7e, 0x81, 0xb5, 0x64, 0x1c, 0x43, 0x86, 0xb5, 0x5b,
+  0x24, 0x90, 0x48, 0x06, 0x66, 0x73, 0xe0, 0xeb, 0xa9, 0x3e, 0x0e, 0xd2,
+  0x68, 0xa7, 0x77, 0x3a, 0x2f, 0x08, 0xe5, 0xf8, 0x17, 0x63, 0x87, 0x91,
+  0x6e, 0x55, 0xcd, 0xef, 0x4e, 0x25, 0x11, 0x10, 0xea, 0x81, 0x6f, 0xee,
+  0xdc, 0x2a, 0x46, 0xca, 0xd4, 0x8f, 0x7f, 0x5e, 0x64, 0x05, 0xc6, 0xa7,
+  0x78, 0x3f, 0x6f, 0x04, 0x80, 0x96, 0xca, 0xdd, 0xac, 0x81, 0xc1, 0xc1,
+  0x58, 0xb5, 0x6a, 0x96, 0xae, 0x4c, 0x02, 0x81, 0xac, 0x20, 0xae, 0x89,
+  0x22, 0x6a, 0xe3, 0x40, 0xdb, 0x58, 0xd4, 0xa1, 0xe1, 0xa6, 0x4f, 0x67,
+  0x61, 0x4d, 0x38, 0xd1, 0xff, 0x8f, 0x32, 0x9e, 0x41, 0xd2, 0xc9, 0x5a,
+  0xeb, 0x75, 0xce, 0xd1, 0xaf, 0x96, 0x21, 0xeb, 0x3e, 0x53, 0x91, 0xdf,
+  0xd2, 0x12, 0x36, 0x3e, 0x51, 0x49, 0xe1, 0x8a, 0x5d, 0xd7, 0x43, 0x07,
+  0x27, 0xf9, 0x7d, 0x31, 0xcf, 0xc2, 0x7d, 0xff, 0x3b, 0xec, 0x0c, 0x8e,
+  0xb6, 0x3d, 0x0f, 0xc8, 0xb4, 0x67, 0xb8, 0x1f, 0xa8, 0x3a, 0x23, 0xaf,
+  0xc2, 0x40, 0x92, 0xa2, 0x25, 0x7a, 0xb8, 0x53, 0xf9, 0xa6, 0x2d, 0xa7,
+  0xea, 0xf4, 0xbf, 0x25, 0x53, 0xd3, 0x84, 0x03, 0x68, 0xc0, 0x40, 0xa7,
+  0xe7, 0x2d, 0x78, 0x0a, 0xe3, 0x5e, 0x5b, 0x6d, 0x49, 0xa3, 0x1e, 0x18,
+  0x2a, 0xd6, 0xdf, 0xe4, 0x20, 0x0c, 0x20, 0xa4, 0x3a, 0x0e, 0x5e, 0x12,
+  0x9d, 0xe7, 0x58, 0x7b, 0xcd, 0x05, 0x95, 0x79, 0xeb, 0x6e, 0xc4, 0x16,
+  0xa1, 0x99, 0x82, 0xb6, 0xc5, 0x49, 0x94, 0xc7, 0xc9, 0x55, 0x35, 0x61,
+  0x39, 0x7e, 0xd2, 0x48, 0xc9, 0xf4, 0xbb, 0xed, 0x7e, 0x3c, 0x2d, 0x0f,
+  0x0b, 0x81, 0x1e, 0x44, 0x88, 0xfe, 0x9a, 0x17, 0x39, 0xd8, 0x33, 0x1a,
+  0x8d, 0x46, 0x29, 0x21, 0xbd, 0xd0, 0x87, 0xd8, 0x7a, 0xd9, 0xbc, 0xe3,
+  0x16, 0x92, 0xcc, 0x3e, 0xbe, 0x8b, 0x8c, 0x30, 0x89, 0x7c, 0x89, 0x58,
+  0xc4, 0x51, 0x33, 0xc4, 0x43, 0x06, 0x2e, 0x04, 0x9a, 0xf8, 0x30, 0x4a,
+  0x53, 0x25, 0x7b, 0xb1, 0x9d, 0x52, 0xda, 0x68, 0xaa, 0x10, 0xd1, 0xa6,
+  0x00, 0x06, 0xb3, 0x1a, 0x10, 0xce, 0x8d, 0x47, 0xed, 0x36, 0x1e, 0xab,
+  0x51, 0xd4, 0xa1, 0x53, 0x61, 0xf5, 0xad, 0x85, 0xe0, 0xdb, 0x95, 0x6d,
+  0x3e, 0x9c, 0xfd, 0x64, 0x69, 0xd4, 0xa8, 0x8c, 0xe8, 0xcb, 0x2c, 0xa7,
+  0x36, 0x38, 0xfc, 0xde, 0x36, 0x76, 0x3a, 0x7e, 0xc7, 0x13, 0xfb, 0x3e,
+  0xeb, 0x5a, 0x27, 0x5d, 0xfe, 0x53, 0x18, 0xe9, 0x68, 0x93, 0xf2, 0x2e,
+  0xcd, 0x04, 0xe3, 0x80, 0x26, 0x09, 0xd1, 0x22, 0x93, 0xcb, 0xa5, 0xd8,
+  0x9a, 0xbb, 0xb0, 0xae, 0xc7, 0xee, 0xb7, 0xa1, 0xdd, 0x90, 0x51, 0x91,
+  0x9c, 0x50, 0x38, 0xfb, 0x90, 0x0e, 0x2a, 0x01, 0x33, 0xee, 0x13, 0x69,
+  0xae, 0xd2, 0xed, 0x2b, 0x95, 0x0b, 0x98, 0x14, 0xcf, 0xe5, 0x4b, 0xc1,
+  0xf7, 0x56, 0xaa, 0xe3, 0xf0, 0x68, 0x61, 0x18, 0x25, 0x2f, 0xaa, 0x98,
+  0x22, 0xee, 0x5f, 0xc5, 0x75, 0xc1, 0x7e, 0xbc, 0x3b, 0xd0, 0x0e, 0x27,
+  0xc8, 0x3b, 0x3a, 0xd9, 0x5c, 0xf6, 0xea, 0x40, 0x41, 0x76, 0x3b, 0x49,
+  0xc5, 0x4b, 0x97, 0x2f, 0x69, 0xfb, 0x74, 0x57, 0x88, 0x61, 0xdc, 0x91,
+  0x63, 0x93, 0xaa, 0x46, 0x27, 0x0c, 0x5a, 0x3f, 0xb3, 0x12, 0x08, 0x1a,
+  0x47, 0x93, 0xb7, 0x0a, 0x4c, 0x63, 0xbb, 0xee, 0x7f, 0x62, 0x52, 0x38,
+  0x75, 0xc7, 0x8b, 0xe5, 0x4d, 0x17, 0xfd, 0xb2, 0x7c, 0x5e, 0xcd, 0x43,
+  0xa5, 0xe8, 0xcd, 0x65, 0xda, 0xbf, 0xe5, 0x9d, 0xb2, 0x71, 0x58, 0x12,
+  0xd8, 0x99, 0xcd, 0x2d, 0xe4, 0x39, 0x51, 0x6c, 0x2e, 0x10, 0x4a, 0x0a,
+  0x8f, 0xec, 0xa5, 0xfa, 0x8b, 0x7a, 0x63, 0xe3, 0x29, 0x6d, 0xd4, 0x99,
+  0x86, 0x0e, 0x25, 0x92, 0xd0, 0xe0, 0xac, 0x87, 0x14, 0x1f, 0xec, 0xb7,
+  0xa9, 0xfc, 0x12, 0xeb, 0xac, 0x1a, 0xdd, 0x20, 0x1a, 0x74, 0x28, 0x50,
+  0x1e, 0x3a, 0x55, 0x06, 0x41, 0x75, 0x12, 0x22, 0x84, 0x5f, 0x1e, 0x5e,
+  0xb9, 0x40, 0x5c, 0xf5, 0xce, 0xa0, 0x0a, 0x96, 0xbe, 0x4d, 0xb7, 0x48,
+  0xb2, 0x3e, 0x19, 0x68, 0x5c, 0xa6, 0xd2, 0xef, 0x39, 0x45, 0xd7, 0x4b,
+  0x9e, 0x3b, 0xad, 0xd5, 0x1d, 0x5d, 0x21, 0xde, 0x7a, 0x62, 0x87, 0x13,
+  0x89, 0x52, 0x7a, 0x26, 0x79, 0x8c, 0x0f, 0x7b, 0x28, 0xf2, 0xfc, 0x98,
+  0xb4, 0x91, 0x73, 0x2f, 0xd1, 0x6a, 0xc8, 0x9b, 0xc8, 0xbb, 0x48, 0xf4,
+  0x50, 0xee, 0xcc, 0x47, 0xce, 0x58, 0x9a, 0xa8, 0x70, 0xea, 0x54, 0xf8,
+  0x0b, 0x3a, 0xec, 0x74, 0x03, 0x0a, 0x9f, 0x41, 0xa3, 0x0c, 0x97, 0x2c,
+  0xfd, 0xea, 0xea, 0x16, 0x81, 0x11, 0xaa, 0x83, 0xc5, 0xd8, 0x75, 0xe4,
+  0xe7, 0x04, 0x9d, 0x62, 0x31, 0xcf, 0xc5, 0x4c, 0x5e, 0xfe, 0xf3, 0x4d,
+  0x73, 0xab, 0x25, 0x8a, 0x77, 0x5c, 0xd3, 0xc4, 0xe9, 0x73, 0xee, 0xf2,
+  0x9d, 0xc3, 0xb1, 0xa6, 0xd5, 0x95, 0x30, 0xde, 0x6f, 0xc9, 0x3f, 0x67,
+  0x92, 0x7f, 0x46, 0x95, 0x52, 0x40, 0x08, 0x92, 0x4d, 0x25, 0x50, 0xac,
+  0xc3, 0xec, 0x68, 0x65, 0x97, 0xdc, 0xc0, 0x3a, 0xcb, 0x56, 0x23, 0x48,
+  0x7f, 0xd0, 0xce, 0xbe, 0x9e, 0x4e, 0xb7, 0xe3, 0xd8, 0xcb, 0x10, 0xf2,
+  0x4e, 0x8e, 0x90, 0x59, 0xf9, 0xea, 0x92, 0x9d, 0x92, 0xee, 0x2f, 0xf0,
+  0xb1, 0xe8, 0x97, 0x3d, 0xb5, 0xad, 0x9e, 0x86, 0xb9, 0x34, 0xb4, 0xd5,
+  0x72, 0x55, 0xa8, 0x1d, 0x96, 0x0e, 0x9e, 0x63, 0xf0, 0x72, 0xc4, 0x76,
+  0x07, 0x5a, 0x4b, 0xb2, 0xf6, 0xde, 0x3f, 0xc9, 0xbf, 0xfd, 0xde, 0xee,
+  0xe1, 0x0c, 0x70, 0x2f, 0xcf, 0xe6, 0x8e, 0x25, 0x89, 0x55, 0x5a, 0x92,
+  0x75, 0x87, 0x5b, 0x4d, 0xbc, 0xd8, 0xa6, 0x44, 0x86, 0x25, 0xbd, 0xf9,
+  0x9c, 0xfb, 0x26, 0xff, 0xbf, 0x00, 0x08, 0xf7, 0x10, 0xc8, 0xad, 0x6c,
+  0x06, 0xcf, 0xc1, 0xdb, 0x9a, 0x9a, 0x4c, 0xbe, 0x79, 0xf6, 0xe1, 0xf6,
+  0x0a, 0x98, 0x5f, 0xd2, 0xff, 0xae, 0xa9, 0x76, 0x93, 0x53, 0xd0, 0x65,
+  0x84, 0x65, 0x18, 0x4a, 0xe6, 0x4a, 0xd3, 0x98, 0x6f, 0x9f, 0xff, 0x39,
+  0x14, 0xf5, 0xce, 0xdb, 0x17, 0xed, 0x46, 0xae, 0xe3, 0xd9, 0x59, 0xfd,
+  0x39, 0xd7, 0xc7, 0xed, 0x95, 0xb0, 0xd9, 0xd9, 0x79, 0xf0, 0xff, 0x2f,
+  0xec, 0x24, 0xc7, 0x2e, 0x6a, 0x75, 0x94, 0xa8, 0xf0, 0x0f, 0x70, 0xbf,
+  0x42, 0x9d, 0x7f, 0x91, 0x75, 0x50, 0xf9, 0x6a, 0x5f, 0x39, 0xdf, 0x76,
+  0x98, 0xef, 0x5a, 0x53, 0x64, 0x89, 0x0e, 0xa7, 0x24, 0xf9, 0x86, 0xda,
+  0xf5, 0x2a, 0x7a, 0x1e, 0x71, 0xfe, 0x25, 0x90, 0x87, 0xa7, 0xa5, 0x89,
+  0x12, 0xb4, 0xfc, 0x1e, 0xd2, 0x02, 0xc7, 0xd9, 0x30, 0x8d, 0x94, 0xe2,
+  0xae, 0x13, 0x35, 0xad, 0xcd, 0x22, 0xb7, 0xff, 0xa5, 0x31, 0xf2, 0x25,
+  0xae, 0x27, 0x43, 0x23, 0xc2, 0xd9, 0x64, 0xc0, 0xbf, 0xa7, 0x78, 0xde,
+  0xab, 0x78, 0x15, 0xe1, 0x47, 0x1b, 0x78, 0xad, 0xba, 0x4b, 0xa6, 0xc4,
+  0x6d, 0xcc, 0xab, 0x6f, 0x45, 0x03, 0x79, 0x3a, 0xc9, 0x8a, 0xae, 0x51,
+  0x79, 0xd3, 0xfa, 0x70, 0x5b, 0x3c, 0x82, 0xf6, 0xce, 0xf5, 0xcf, 0xc8,
+  0x39, 0x3d, 0x59, 0xb9, 0xdc, 0x6f, 0xb0, 0x1f, 0xb1, 0x9f, 0x5b, 0x5c,
+  0x60, 0xae, 0x6e, 0x60, 0xc4, 0x29, 0x99, 0x32, 0xc0, 0x3e, 0x63, 0xc0,
+  0xc3, 0xd6, 0x8b, 0xe2, 0xe3, 0x34, 0x4d, 0xd7, 0x50, 0x97, 0xca, 0xfc,
+  0x42, 0x14, 0xc7, 0x37, 0xae, 0xbd, 0x3d, 0xf4, 0x46, 0x57, 0x98, 0x29,
+  0x86, 0x78, 0xd1, 0x35, 0x05, 0x4c, 0xd8, 0xea, 0xb7, 0x18, 0xb1, 0x8a,
+  0x30, 0x31, 0xa7, 0x89, 0x0e, 0xa9, 0xbb, 0x99, 0x14, 0x22, 0x00, 0x95,
+  0xc0, 0x13, 0x80, 0xe7, 0x3a, 0x5a, 0x87, 0x4d, 0x4c, 0x7d, 0x9b, 0xdc,
+  0x90, 0xfe, 0x62, 0x15, 0x52, 0x6d, 0xc2, 0x21, 0x06, 0xc4, 0xd3, 0xbb,
+  0x6f, 0x47, 0x1d, 0x3e, 0xf9, 0xb3, 0x1c, 0xb9, 0xdf, 0xab, 0x8f, 0x80,
+  0xa4, 0xeb, 0x0f, 0x81, 0x3b, 0x28, 0xcf, 0xba, 0xbc, 0x94, 0x24, 0x23,
+  0x54, 0x32, 0x42, 0x4a, 0xef, 0x16, 0xb7, 0xad, 0x01, 0x1f, 0xfd, 0xc2,
+  0x8d, 0xb4, 0xcd, 0x93, 0x05, 0xba, 0xb1, 0x36, 0xcd, 0xd7, 0x96, 0x86,
+  0xd0, 0x67, 0x69, 0x36, 0xad, 0xdc, 0x54, 0x88, 0x40, 0x63, 0x93, 0xdf,
+  0x42, 0xec, 0x09, 0xa6, 0xaa, 0x2f, 0xcf, 0x64, 0x18, 0x71, 0xf6, 0x6f,
+  0x8e, 0xa7, 0xb4, 0xcb, 0x83, 0xa0, 0x96, 0x6c, 0x10, 0x81, 0x90, 0xe9,
+  0xe8, 0x72, 0x3d, 0x3e, 0x2a, 0x2e, 0x52, 0x6b, 0xb9, 0x04, 0xf8, 0xd5,
+  0xb3, 0x36, 0x7d, 0x77, 0xcb, 0xa6, 0xeb, 0x62, 0xd2, 0x7a, 0xde, 0x02,
+  0x19, 0x0e, 0x9e, 0xa5, 0x2e, 0x0c, 0x06, 0x93, 0x3b, 0x62, 0x8e, 0x45,
+  0xd2, 0x92, 0x50, 0x8b, 0x0f, 0xc6, 0x85, 0x2f, 0x0d, 0x35, 0xe9, 0x75,
+  0x4c, 0x09, 0x79, 0x8f, 0xa8, 0x8a, 0x26, 0x8b, 0x23, 0x19, 0x55, 0xe7,
+  0xad, 0x4c, 0x93, 0xa5, 0x7d, 0xf2, 0x88, 0x99, 0x9a, 0x3f, 0x53, 0x7e,
+  0x65, 0xcc, 0x91, 0x0e, 0x63, 0x05, 0xb2, 0x08, 0xed, 0x49, 0xa0, 0x99,
+  0x30, 0xf0, 0x88, 0x18, 0xea, 0x60, 0x50, 0xd4, 0x10, 0xca, 0x83, 0xa4,
+  0x71, 0xcc, 0x7c, 0x90, 0xa0, 0xb5, 0x8f, 0x76, 0x08, 0x85, 0xe2, 0x4b,
+  0xa2, 0x38, 0x63, 0x98, 0xab, 0x1b, 0x77, 0xa4, 0x86, 0x27, 0x6e, 0xf9,
+  0x9b, 0x68, 0x0e, 0x3a, 0x16, 0xd8, 0xa6, 0xc8, 0xb6, 0x8e, 0x1a, 0xad,
+  0x79, 0x97, 0xc8, 0x71, 0x7b, 0x45, 0x47, 0x36, 0x0c, 0x4f, 0xd9, 0xdb,
+  0x67, 0xfc, 0x08, 0x11, 0xd9, 0x61, 0x0b, 0xac, 0x4f, 0xd7, 0xb7, 0x41,
+  0xcc, 0x0d, 0x7e, 0xf5, 0xc6, 0xbe, 0xd0, 0x20, 0x4a, 0xd5, 0xb4, 0xbd,
+  0xfc, 0x6d, 0x11, 0xac, 0x7e, 0x50, 0x6e, 0xcd, 0xf2, 0x67, 0xe7, 0xdc,
+  0xe2, 0x77, 0xfb, 0xe6, 0x4d, 0x13, 0x07, 0x1e, 0x22, 0xcb, 0x87, 0xdb,
+  0x08, 0xea, 0xb7, 0x4e, 0xd2, 0xb1, 0xdd, 0x98, 0xa4, 0x5f, 0x66, 0xce,
+  0xf7, 0x02, 0x45, 0xac, 0x25, 0x32, 0x2b, 0xf1, 0x84, 0xf4, 0x98, 0x62,
+  0x6c, 0xce, 0x89, 0x9a, 0x74, 0x5e, 0x68, 0x2d, 0xd9, 0xe3, 0xc8, 0xd4,
+  0x38, 0x54, 0x6c, 0x28, 0xb0, 0x78, 0x63, 0x61, 0x5b, 0x1e, 0xef, 0x52,
+  0x7b, 0xfd, 0x85, 0xc0, 0x0f, 0xb1, 0x2d, 0x9b, 0x58, 0x62, 0xa3, 0x17,
+  0x03, 0xed, 0x5c, 0x20, 0x0b, 0x7b, 0xba, 0xc4, 0x99, 0x65, 0x81, 0xed,
+  0xc6, 0x66, 0x0b, 0x44, 0xa8, 0xa9, 0xb8, 0x38, 0x35, 0xd5, 0xc4, 0x3e,
+  0x2c, 0xbc, 0xce, 0x29, 0x02, 0x09, 0x66, 0x7f, 0xb3, 0x38, 0x04, 0x06,
+  0x6b, 0x47, 0x1a, 0xd8, 0xa4, 0xcb, 0x1f, 0xa2, 0x2a, 0xa8, 0xf4, 0xfe,
+  0x9c, 0xc7, 0xef, 0x37, 0x02, 0x56, 0xfa, 0x26, 0x1c, 0x8f, 0x8e, 0x99,
+  0xe3, 0x23, 0x01, 0x40, 0x17, 0x0b, 0x4f, 0x9a, 0xc4, 0x7c, 0xe5, 0x08,
+  0x84, 0x88, 0x29, 0x37, 0x8e, 0x14, 0x6d, 0xba, 0x06, 0x00, 0x00, 0x00,
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d,
+  0x6d, 0x6f, 0xdb, 0x46, 0x9a, 0xdf, 0xf3, 0x2b, 0x26, 0x6a, 0xaf, 0x92,
+  0x10, 0x4b, 0x96, 0x9d, 0xb8, 0x49, 0x65, 0xcb, 0xdb, 0x6c, 0xd2, 0x6c,
+  0x73, 0x48, 0x9b, 0x60, 0x9d, 0xa2, 0x38, 0x14, 0xc5, 0x86, 0x12, 0x47,
+  0x16, 0x37, 0x14, 0xa9, 0x23, 0x29, 0x3b, 0x6e, 0x6a, 0xa0, 0x69, 0x6f,
+  0xaf, 0x0b, 0xa4, 0xb8, 0xee, 0xcb, 0x01, 0x57, 0xec, 0x5d, 0x7b, 0xbd,
+  0xdb, 0xfb, 0x70, 0xc0, 0x7d, 0x71, 0xd3, 0x78, 0xe3, 0xe6, 0xad, 0x7f,
+  0x81, 0xfe, 0x0b, 0xfb, 0x4b, 0xee, 0x79, 0x66, 0x86, 0xe4, 0xcc, 0x70,
+  0x48, 0x51, 0x72, 0xdb, 0xed, 0x02, 0x9b, 0x6c, 0x1d, 0x8b, 0x1c, 0x3e,
+  0xf3, 0xbc, 0xbf, 0xcd, 0x43, 0xed, 0xc6, 0xe9, 0xcb, 0xd7, 0x2f, 0xdd,
+  0xfc, 0x87, 0x1b, 0xaf, 0x91, 0x51, 0x34, 0x76, 0x37, 0x4f, 0x6d, 0xe0,
+  0x3f, 0xc4, 0xb5, 0xbc, 0xed, 0x5e, 0x2d, 0x98, 0xd6, 0xf0, 0x02, 0xb5,
+  0xec, 0xcd, 0x53, 0x04, 0xfe, 0x6c, 0x8c, 0x69, 0x64, 0x91, 0xc1, 0xc8,
+  0x0a, 0x42, 0x1a, 0xf5, 0x6a, 0x6f, 0xdd, 0xbc, 0xd2, 0xba, 0x50, 0x93,
+  0x6f, 0x79, 0xd6, 0x98, 0xf6, 0x6a, 0x3b, 0x0e, 0xdd, 0x9d, 0xf8, 0x41,
+  0x54, 0x23, 0x03, 0xdf, 0x8b, 0xa8, 0x07, 0x4b, 0x77, 0x1d, 0x3b, 0x1a,
+  0xf5, 0x6c, 0xba, 0xe3, 0x0c, 0x68, 0x8b, 0x7d, 0x58, 0x22, 0x8e, 0xe7,
+  0x44, 0x8e, 0xe5, 0xb6, 0xc2, 0x81, 0xe5, 0xd2, 0xde, 0x4a, 0xbb, 0x93,
+  0x80, 0x8a, 0x9c, 0xc8, 0xa5, 0x9b, 0xf1, 0x1f, 0xe3, 0x6f, 0x8f, 0x3f,
+  0x88, 0x0f, 0xe2, 0x07, 0xf1, 0x93, 0xf8, 0x30, 0x7e, 0x16, 0x1f, 0xc5,
+  0x87, 0x04, 0xfe, 0x39, 0x38, 0xbe, 0x17, 0x3f, 0xc7, 0xff, 0xe2, 0xa7,
+  0x1b, 0xcb, 0x7c, 0x29, 0x7f, 0x2c, 0x8c, 0xf6, 0xf0, 0x77, 0xf6, 0x01,
+  0xff, 0xf4, 0x7d, 0x7b, 0x8f, 0xdc, 0x4d, 0x3f, 0xe2, 0x9f, 0x21, 0xe0,
+  0xd3, 0x1a, 0x5a, 0x63, 0xc7, 0xdd, 0xeb, 0x92, 0x96, 0x35, 0x99, 0xb8,
+  0xb4, 0x15, 0xee, 0x85, 0x11, 0x1d, 0x2f, 0x91, 0x9f, 0xba, 0x8e, 0x77,
+  0xfb, 0x0d, 0x6b, 0xb0, 0xc5, 0x3e, 0x5f, 0x81, 0x95, 0x4b, 0xa4, 0xb6,
+  0x45, 0xb7, 0x7d, 0x4a, 0xde, 0xba, 0x5a, 0x5b, 0x22, 0x3f, 0xf7, 0xfb,
+  0x7e, 0xe4, 0x2f, 0x91, 0xd7, 0xa9, 0xbb, 0x43, 0x23, 0x67, 0x60, 0x2d,
+  0x91, 0x8b, 0x01, 0xe0, 0xbf, 0x44, 0x42, 0xcb, 0x0b, 0x5b, 0x21, 0x0d,
+  0x9c, 0xe1, 0xba, 0xb2, 0x5b, 0xdf, 0x1a, 0xdc, 0xde, 0x0e, 0xfc, 0xa9,
+  0x67, 0xb7, 0x06, 0xbe, 0xeb, 0x07, 0x5d, 0xf2, 0xc2, 0xb0, 0x33, 0x5c,
+  0x1d, 0xae, 0xa9, 0xcb, 0x92, 0x7b, 0x67, 0xcf, 0x9e, 0x55, 0x6f, 0x8c,
+  0xad, 0x60, 0xdb, 0xf1, 0xba, 0xa4, 0xa3, 0x5e, 0x9e, 0x58, 0xb6, 0xed,
+  0x78, 0xdb, 0x5d, 0xb2, 0xda, 0x99, 0xdc, 0x51, 0x6f, 0xd9, 0x4e, 0x38,
+  0x71, 0x2d, 0xa0, 0x6d, 0xe8, 0x52, 0xed, 0xd6, 0x2f, 0xa7, 0x61, 0xe4,
+  0x0c, 0xf7, 0x5a, 0x42, 0x24, 0x5d, 0x32, 0x80, 0x9f, 0x34, 0x50, 0x17,
+  0x59, 0xae, 0xb3, 0xed, 0xb5, 0x1c, 0xa0, 0x3f, 0xe4, 0x30, 0x5a, 0x61,
+  0x64, 0x05, 0x91, 0x86, 0x96, 0xe3, 0xb5, 0x46, 0xd4, 0xd9, 0x1e, 0x01,
+  0x90, 0x95, 0x4e, 0x67, 0x67, 0xb4, 0x9e, 0xe7, 0x71, 0xe8, 0xbc, 0x47,
+  0xe1, 0xee, 0x39, 0x19, 0xc1, 0xfd, 0x4c, 0x34, 0x6d, 0xc4, 0xc2, 0x72,
+  0x3c, 0x1a, 0x68, 0x02, 0x32, 0xb1, 0x6c, 0x38, 0x2c, 0xa2, 0x7f, 0x4d,
+  0xa7, 0xbf, 0xef, 0x07, 0x36, 0x0d, 0x5a, 0x81, 0x65, 0x3b, 0xd3, 0x10,
+  0xb1, 0xcb, 0x2f, 0x00, 0x92, 0x46, 0x96, 0xed, 0xef, 0x02, 0x5b, 0x09,
+  0xa0, 0x47, 0x56, 0x56, 0xe1, 0x47, 0xb0, 0xdd, 0xb7, 0x1a, 0x9d, 0x25,
+  0x22, 0xfe, 0xd7, 0x5e, 0x69, 0xaa, 0x8f, 0x31, 0x8d, 0x65, 0xd4, 0xfe,
+  0x9d, 0x2e, 0xa2, 0x3b, 0x2d, 0x71, 0x73, 0xad, 0x63, 0xde, 0xcd, 0x79,
+  0x8f, 0x21, 0x2b, 0x50, 0x83, 0x4b, 0x46, 0x8e, 0x8c, 0x56, 0x34, 0x4e,
+  0x44, 0xf4, 0x4e, 0xd4, 0x62, 0xf2, 0x30, 0x8b, 0x2a, 0x61, 0xcf, 0x8a,
+  0xb5, 0xda, 0x3f, 0x67, 0x9b, 0x14, 0xa7, 0x15, 0xf9, 0x93, 0x9c, 0xf2,
+  0x88, 0x5b, 0xa0, 0xca, 0x91, 0x3f, 0x06, 0xa4, 0x8b, 0x04, 0xe4, 0xd1,
+  0x68, 0xd7, 0x0f, 0x6e, 0xb7, 0xac, 0xc1, 0x80, 0x86, 0x61, 0x0b, 0x6d,
+  0x63, 0x4e, 0x04, 0x65, 0x3d, 0x58, 0xd5, 0x39, 0x93, 0x60, 0xff, 0xf2,
+  0xcb, 0x2f, 0x97, 0xe2, 0xa7, 0xaa, 0xf8, 0x2c, 0x04, 0x2d, 0x0d, 0xc5,
+  0x64, 0x97, 0x4e, 0xe7, 0x7c, 0x5f, 0xd7, 0x22, 0x86, 0xbe, 0x4d, 0x07,
+  0x7e, 0x60, 0x45, 0x8e, 0x0f, 0x34, 0x78, 0xbe, 0x47, 0xe7, 0xd8, 0xaa,
+  0x3b, 0xf2, 0x77, 0x72, 0xea, 0x9b, 0x03, 0x0a, 0x8a, 0x4c, 0x03, 0x78,
+  0xa0, 0x00, 0x72, 0x64, 0xf5, 0x43, 0x0d, 0x44, 0x89, 0x09, 0x97, 0xf2,
+  0x46, 0x52, 0xff, 0x74, 0x01, 0x68, 0x76, 0xe8, 0xbb, 0x8e, 0x4d, 0x5e,
+  0xa0, 0x1d, 0xfc, 0x5b, 0x88, 0x44, 0xab, 0x3f, 0x85, 0x47, 0x3c, 0xdd,
+  0x5b, 0xa2, 0x03, 0x00, 0x6b, 0x04, 0x5b, 0x59, 0x99, 0xe5, 0xd9, 0xa2,
+  0x00, 0x9c, 0xe0, 0xc4, 0x0a, 0x40, 0x11, 0x4c, 0x38, 0xe9, 0xec, 0x55,
+  0xec, 0x78, 0x25, 0x67, 0xc7, 0xb2, 0xee, 0xbc, 0x6c, 0xbc, 0xb9, 0x2b,
+  0x1c, 0x10, 0x58, 0x9d, 0xa6, 0x59, 0xd3, 0x20, 0x44, 0x84, 0x26, 0xbe,
+  0x53, 0x6c, 0x34, 0x39, 0xb5, 0x63, 0xe8, 0x3b, 0x5c, 0x66, 0x96, 0xeb,
+  0x82, 0x0b, 0x38, 0x1b, 0x12, 0x6a, 0x85, 0xb4, 0x94, 0xc1, 0x67, 0x53,
+  0x06, 0x1b, 0xc9, 0x37, 0x33, 0xd9, 0xa8, 0x38, 0x26, 0xbf, 0x77, 0x1e,
+  0xff, 0xce, 0x82, 0xd6, 0xb6, 0x06, 0x91, 0xb3, 0x43, 0xe7, 0x50, 0x7c,
+  0x85, 0x86, 0x56, 0xd1, 0x4a, 0x7d, 0x37, 0x11, 0x36, 0x8a, 0x94, 0xb5,
+  0xd8, 0x78, 0xa4, 0x87, 0xcd, 0xb8, 0xa6, 0x30, 0xfa, 0xae, 0x3f, 0xb8,
+  0x6d, 0x06, 0x32, 0xf4, 0x83, 0x31, 0x6a, 0xe2, 0x74, 0xa2, 0x3d, 0xac,
+  0x99, 0xc4, 0x4a, 0x91, 0x3f, 0x73, 0xad, 0x3e, 0x75, 0x2b, 0x6e, 0x3c,
+  0xcb, 0x4d, 0x96, 0xeb, 0xa0, 0xb4, 0xa9, 0xe3, 0x4d, 0xa6, 0xd1, 0x3b,
+  0xd1, 0xde, 0x04, 0x72, 0x22, 0xf4, 0x0c, 0xb5, 0x77, 0x97, 0xe6, 0xbe,
+  0xe7, 0x4d, 0xc7, 0x7d, 0x1a, 0xd4, 0xde, 0xd5, 0x70, 0x2f, 0x0c, 0x48,
+  0x99, 0x51, 0x15, 0x78, 0x07, 0xb8, 0x93, 0xb9, 0x85, 0xc1, 0x60, 0x50,
+  0x1a, 0x40, 0xd7, 0xe6, 0x8d, 0x68, 0xa5, 0xc6, 0x5b, 0xc0, 0x9a, 0xc1,
+  0x88, 0x0e, 0x6e, 0x03, 0x94, 0x1c, 0x91, 0x42, 0x08, 0x41, 0x92, 0x6a,
+  0xe8, 0xc8, 0x30, 0xa3, 0x43, 0xd5, 0xe8, 0x12, 0x96, 0x43, 0x36, 0x56,
+  0xda, 0xab, 0xcd, 0x82, 0x7c, 0x43, 0xec, 0x21, 0x94, 0xa8, 0x54, 0x1d,
+  0x1c, 0x0f, 0x1d, 0x76, 0x2b, 0xef, 0x7f, 0x95, 0xec, 0xc8, 0x18, 0x93,
+  0x8b, 0x7c, 0x8f, 0x96, 0xfa, 0xd8, 0xcc, 0xd3, 0x40, 0xea, 0x5b, 0xa2,
+  0xd2, 0x2e, 0x1d, 0x46, 0x26, 0x1f, 0x2f, 0x04, 0xcc, 0x83, 0x7b, 0x91,
+  0x90, 0x93, 0xa7, 0xa5, 0x00, 0x40, 0x0b, 0xec, 0x93, 0xbb, 0x11, 0x23,
+  0x26, 0x25, 0xa1, 0x68, 0xdb, 0x32, 0xee, 0x5e, 0x39, 0x7a, 0xf7, 0x23,
+  0x3d, 0xd8, 0x28, 0x8a, 0x5b, 0x18, 0xdb, 0x4c, 0x71, 0x64, 0x96, 0xce,
+  0x96, 0x46, 0x84, 0x13, 0x44, 0x1a, 0x39, 0x66, 0xe8, 0xfe, 0x9b, 0x05,
+  0x90, 0x42, 0xd2, 0x5b, 0x93, 0xc0, 0x01, 0x56, 0xed, 0xcd, 0x0e, 0x02,
+  0x26, 0x07, 0x2e, 0xee, 0xed, 0x8e, 0x40, 0x13, 0x67, 0x6e, 0x51, 0x35,
+  0xda, 0x74, 0x3a, 0x6b, 0x2f, 0xf7, 0xcf, 0x16, 0x83, 0x0b, 0xa7, 0x2c,
+  0xf9, 0x99, 0x0d, 0x68, 0xf5, 0x82, 0x75, 0xfe, 0xdc, 0xda, 0x22, 0x18,
+  0xdb, 0x50, 0x73, 0x56, 0x41, 0xd5, 0x1e, 0x9c, 0x5d, 0x5b, 0x68, 0x87,
+  0x2e, 0x28, 0xb4, 0xd5, 0x77, 0xa9, 0x3d, 0x7b, 0x8f, 0x9c, 0x63, 0x4c,
+  0x94, 0xc8, 0xf3, 0x31, 0xe9, 0x75, 0xfd, 0x5d, 0x6a, 0x9b, 0xf7, 0x81,
+  0x82, 0x29, 0x9a, 0x86, 0x2d, 0x61, 0x3b, 0x85, 0x4a, 0x9e, 0xf7, 0xac,
+  0x79, 0x24, 0xe8, 0x2b, 0x74, 0x40, 0x87, 0xf3, 0x29, 0xbb, 0xa2, 0xb2,
+  0x7d, 0xdf, 0xb5, 0xd7, 0xe7, 0x4a, 0xda, 0xab, 0xc6, 0xd3, 0x76, 0x48,
+  0x3d, 0xe0, 0x47, 0x01, 0x99, 0x73, 0x94, 0x06, 0xab, 0xe7, 0xe6, 0xa4,
+  0x20, 0x61, 0xce, 0xb9, 0x57, 0xd6, 0x3a, 0x6b, 0xe7, 0xcd, 0x05, 0x33,
+  0x7a, 0x0f, 0x62, 0x8e, 0xc9, 0xaf, 0x8e, 0xa9, 0xed, 0x58, 0xa4, 0x21,
+  0x15, 0x6e, 0xe7, 0x2e, 0xc0, 0xf2, 0xa6, 0xae, 0x13, 0xf9, 0xe6, 0x81,
+  0x22, 0x40, 0xcd, 0x17, 0xec, 0x2b, 0x9f, 0x0a, 0xcb, 0x5b, 0x83, 0x04,
+  0x35, 0x40, 0x7a, 0x91, 0x9a, 0x77, 0x77, 0xfb, 0x46, 0x79, 0x58, 0x7d,
+  0x7f, 0x1a, 0xb5, 0x9c, 0x41, 0x9a, 0xc4, 0x4f, 0xfc, 0x34, 0x9f, 0xed,
+  0x43, 0x0c, 0x98, 0x26, 0x76, 0xc1, 0xe3, 0x46, 0x2a, 0xd7, 0x24, 0xb8,
+  0xa6, 0x17, 0x8c, 0xb2, 0x49, 0xf3, 0xe6, 0xc1, 0xf9, 0xb5, 0xf3, 0x42,
+  0x20, 0x46, 0xb7, 0x2a, 0xfb, 0xc4, 0xc4, 0x11, 0xae, 0x82, 0x23, 0x04,
+  0x54, 0x25, 0x14, 0x15, 0xa7, 0xa4, 0xbb, 0x3a, 0x5c, 0x3a, 0xf6, 0x6d,
+  0x0b, 0xe3, 0xf3, 0xa9, 0x82, 0x30, 0x94, 0x11, 0x37, 0x74, 0xee, 0x24,
+  0x96, 0xf8, 0x5e, 0xcb, 0x81, 0x6a, 0xeb, 0x0e, 0xcb, 0x8a, 0x04, 0x57,
+  0x79, 0x18, 0xec, 0x48, 0x94, 0x8b, 0xdf, 0x73, 0xf9, 0x93, 0xd4, 0xd0,
+  0x10, 0x57, 0xf2, 0x06, 0x29, 0xba, 0x04, 0xec, 0x6f, 0x7b, 0x4d, 0x64,
+  0x1a, 0x85, 0x49, 0x41, 0x69, 0xc3, 0xc5, 0xd0, 0xc3, 0x29, 0x4a, 0xad,
+  0xd8, 0x4d, 0x7f, 0x62, 0x0d, 0x9c, 0x68, 0x2f, 0xc5, 0x5f, 0x30, 0xbd,
+  0x45, 0x77, 0x00, 0x68, 0x98, 0xa8, 0x49, 0x4e, 0x04, 0xe2, 0x31, 0xb9,
+  0x9c, 0x49, 0xd9, 0xcb, 0x7f, 0xb6, 0xfc, 0x09, 0x4d, 0x54, 0x26, 0xdd,
+  0x64, 0xc5, 0xbc, 0x89, 0x35, 0x8d, 0x7c, 0x09, 0x80, 0x56, 0x13, 0x64,
+  0x32, 0x09, 0xa8, 0x6b, 0x61, 0xa2, 0x5f, 0xc4, 0xc7, 0x17, 0x86, 0x14,
+  0xff, 0xea, 0x9c, 0x58, 0xcb, 0x38, 0x91, 0x4b, 0x54, 0x2f, 0x5c, 0xb8,
+  0x50, 0x20, 0x38, 0xd9, 0x90, 0xb3, 0x0e, 0x0c, 0x5e, 0x4d, 0x44, 0xfa,
+  0x4a, 0xda, 0xa2, 0x2a, 0x6c, 0x0f, 0x19, 0xda, 0x42, 0x6b, 0x59, 0x5b,
+  0x88, 0x0b, 0x3c, 0x49, 0x2d, 0x2d, 0x0f, 0x02, 0xab, 0x50, 0x3e, 0xcb,
+  0xa6, 0x57, 0x3d, 0x29, 0xd6, 0xa3, 0x5a, 0x0f, 0x21, 0x38, 0xb4, 0xf6,
+  0x0c, 0xdc, 0x72, 0xfd, 0x90, 0x6a, 0x3a, 0x6f, 0x59, 0xd6, 0x7a, 0x05,
+  0x6b, 0xed, 0x68, 0xd6, 0x9a, 0x29, 0x8d, 0x64, 0xad, 0x67, 0x57, 0x95,
+  0x8b, 0x79, 0x0f, 0x6a, 0x34, 0x58, 0x96, 0xea, 0x26, 0x9c, 0xd2, 0xe0,
+  0x26, 0x8d, 0x52, 0xb9, 0xbf, 0xa9, 0xd1, 0xc3, 0x2d, 0x79, 0x49, 0xbd,
+  0x36, 0xf4, 0x07, 0xd3, 0x30, 0x67, 0xdd, 0x1d, 0xf6, 0xf0, 0xab, 0xb7,
+  0xe9, 0xde, 0x30, 0xb0, 0xc6, 0x34, 0x4c, 0xb8, 0xc7, 0xd7, 0x0d, 0x03,
+  0x7f, 0x4c, 0xee, 0x4a, 0x6a, 0x9e, 0xcf, 0xee, 0x3b, 0xed, 0x57, 0x9a,
+  0xeb, 0xfb, 0x82, 0x2d, 0xd2, 0xda, 0x15, 0xc3, 0xda, 0x15, 0x5c, 0xf9,
+  0x37, 0x4d, 0x9d, 0x4f, 0x53, 0x59, 0x17, 0x7d, 0x59, 0xb4, 0xd1, 0x37,
+  0x96, 0x79, 0xdf, 0x7f, 0x03, 0x23, 0xa1, 0xe8, 0xaa, 0x6f, 0xd8, 0xce,
+  0x0e, 0x19, 0xb8, 0x56, 0x18, 0x42, 0xd5, 0x96, 0x84, 0x38, 0xd1, 0xb5,
+  0x67, 0xf7, 0x47, 0x2b, 0x9b, 0xf1, 0x7f, 0xc6, 0x07, 0xf1, 0xb3, 0xf8,
+  0x30, 0x7e, 0x72, 0xfc, 0x09, 0x39, 0xfe, 0x48, 0xef, 0xe1, 0x1f, 0x7f,
+  0x0a, 0x80, 0x57, 0xa4, 0x2e, 0xfd, 0x46, 0x38, 0xb1, 0xbc, 0x04, 0x68,
+  0x16, 0x22, 0x6a, 0xc4, 0xf7, 0x06, 0xae, 0x33, 0xb8, 0xdd, 0xab, 0xa1,
+  0x87, 0x7a, 0x03, 0xc5, 0xd8, 0x68, 0xd6, 0x36, 0xff, 0xfc, 0xfb, 0xcf,
+  0x00, 0x45, 0x78, 0x44, 0xda, 0x55, 0xc2, 0xca, 0xd0, 0xaa, 0x93, 0xf0,
+  0xc3, 0x3f, 0xf1, 0xbf, 0xe2, 0xe9, 0xc1, 0xf1, 0x87, 0x88, 0x1a, 0x89,
+  0x8f, 0xe2, 0x47, 0xe4, 0xf8, 0x5e, 0x7c, 0x78, 0xfc, 0x61, 0x7c, 0xd4,
+  0x25, 0x1b, 0x16, 0x19, 0x05, 0x74, 0xd8, 0xab, 0xbd, 0x50, 0x23, 0x8e,
+  0x0d, 0x85, 0xb9, 0x3f, 0x79, 0xc3, 0xf6, 0xc2, 0x6b, 0x08, 0x85, 0x44,
+  0x90, 0x5c, 0xe0, 0xa9, 0xc7, 0x2f, 0xfa, 0xae, 0x85, 0x50, 0x37, 0x96,
+  0x2d, 0x09, 0x87, 0x65, 0x40, 0x42, 0xa6, 0x4a, 0xc2, 0x09, 0x9b, 0x7c,
+  0x1a, 0x12, 0x1b, 0xa2, 0xdf, 0x96, 0xad, 0x48, 0x3a, 0x70, 0xbc, 0x45,
+  0x22, 0x51, 0x1f, 0x8e, 0xfc, 0xdd, 0x9b, 0x56, 0xbf, 0x51, 0xdf, 0x75,
+  0x86, 0x4e, 0x1d, 0x38, 0xf0, 0xb6, 0x73, 0xc5, 0xd9, 0x58, 0xe6, 0xcb,
+  0x2b, 0x42, 0x35, 0x81, 0x43, 0xf9, 0x05, 0xbe, 0x8b, 0x10, 0x4d, 0x27,
+  0x2d, 0xf9, 0x1d, 0x8c, 0x24, 0x22, 0x97, 0x10, 0xb1, 0x9a, 0xbc, 0x69,
+  0x62, 0x6d, 0x82, 0x16, 0xe9, 0x19, 0x9d, 0x35, 0x59, 0x5f, 0x47, 0x63,
+  0x10, 0x5b, 0xc8, 0xaa, 0xf4, 0xcd, 0xf8, 0x4b, 0xc0, 0xe9, 0x4f, 0x80,
+  0xd3, 0x53, 0xc2, 0x90, 0xfc, 0x0a, 0xe4, 0xf7, 0xe1, 0xf1, 0xfd, 0xee,
+  0xc6, 0x32, 0xbf, 0x9f, 0x7f, 0x4e, 0xd6, 0x52, 0xa5, 0xee, 0x37, 0x6c,
+  0xc2, 0x1e, 0x60, 0xdd, 0x08, 0xc2, 0xbb, 0x11, 0x68, 0x72, 0x7e, 0x4d,
+  0x9c, 0x64, 0x21, 0x69, 0xa0, 0x7a, 0x94, 0xab, 0x03, 0xf8, 0x12, 0x7a,
+  0xc9, 0x75, 0x80, 0xb4, 0x1a, 0xd9, 0xb1, 0xdc, 0x29, 0x2c, 0x18, 0x5a,
+  0x6e, 0xc8, 0xa5, 0x35, 0xc2, 0xea, 0xa5, 0x57, 0x9b, 0x4e, 0x6c, 0x2b,
+  0xa2, 0x3f, 0x73, 0xfd, 0xbe, 0xe5, 0x6e, 0xd1, 0x28, 0x02, 0x87, 0xd1,
+  0xa8, 0x3b, 0xe1, 0xc5, 0x1b, 0xf5, 0x25, 0xc2, 0x16, 0x37, 0xc1, 0x5b,
+  0xf9, 0xdb, 0xdb, 0x2e, 0x7d, 0x5b, 0xc0, 0x46, 0xad, 0x36, 0xa3, 0xc5,
+  0xbb, 0x14, 0xc0, 0x23, 0x65, 0xeb, 0xcd, 0xf8, 0x0f, 0x20, 0xa6, 0x23,
+  0x14, 0xd4, 0xf1, 0x87, 0xc5, 0x4c, 0xe0, 0xd2, 0xfa, 0x41, 0x79, 0x73,
+  0xf1, 0x46, 0xca, 0x97, 0x28, 0x98, 0x56, 0x66, 0x0b, 0xae, 0x5d, 0x9c,
+  0x2b, 0xb0, 0xe9, 0x66, 0xfc, 0xdf, 0xa0, 0x13, 0x1f, 0xc7, 0x8f, 0xe3,
+  0x03, 0x12, 0x3f, 0xcc, 0xcc, 0x3b, 0x3e, 0x98, 0x87, 0x3d, 0xba, 0x7e,
+  0x2b, 0x3a, 0x3e, 0x60, 0xbc, 0x17, 0x98, 0x87, 0xb5, 0x72, 0xc6, 0x96,
+  0x6a, 0xb5, 0x4e, 0x43, 0x18, 0x3a, 0x36, 0x50, 0xf0, 0x39, 0x68, 0xf6,
+  0x23, 0x30, 0xc0, 0x03, 0x71, 0xd0, 0x99, 0x38, 0x25, 0xd2, 0xd8, 0xda,
+  0xba, 0x7a, 0xb9, 0x59, 0xac, 0xed, 0x39, 0x21, 0xb1, 0x6e, 0x22, 0x43,
+  0x9a, 0x81, 0x9e, 0x25, 0x04, 0xe1, 0x31, 0x13, 0xd2, 0xda, 0x9d, 0x36,
+  0x3e, 0x86, 0x62, 0x19, 0x39, 0x61, 0x9b, 0x89, 0xd3, 0x24, 0x8a, 0x0a,
+  0xfa, 0x35, 0x17, 0x1b, 0x26, 0xf0, 0x08, 0xe0, 0x81, 0xac, 0x80, 0x00,
+  0x02, 0x86, 0xfe, 0x1c, 0x03, 0xc8, 0x42, 0x64, 0xa7, 0xa0, 0xe6, 0x27,
+  0x3d, 0x79, 0xf4, 0x87, 0x21, 0x7f, 0x5e, 0x5b, 0xcc, 0xd1, 0x9c, 0x76,
+  0x4e, 0x19, 0xdd, 0xd3, 0x90, 0x6e, 0x45, 0x10, 0xef, 0x07, 0x57, 0x6f,
+  0x2c, 0x40, 0xba, 0xf4, 0x74, 0x42, 0x3d, 0x03, 0x4f, 0xed, 0xd4, 0x36,
+  0xc5, 0xfd, 0xc9, 0x15, 0x87, 0xba, 0x76, 0x58, 0x68, 0xa1, 0xba, 0x68,
+  0x65, 0xbc, 0x36, 0xe3, 0xcf, 0x40, 0xb3, 0xbf, 0xe5, 0xd2, 0x05, 0x85,
+  0x7f, 0x8e, 0x2a, 0x0f, 0xd6, 0x0a, 0xa9, 0x02, 0x18, 0x2d, 0xfe, 0x0a,
+  0x29, 0xc2, 0xc7, 0xa0, 0xfa, 0xf7, 0xc0, 0x9a, 0x8f, 0xe2, 0x6f, 0xc8,
+  0xd5, 0x1b, 0x2d, 0xb0, 0x89, 0x87, 0xa0, 0x10, 0x70, 0xad, 0x5c, 0x1b,
+  0x0a, 0x44, 0x52, 0x22, 0x29, 0x66, 0x24, 0x0a, 0x51, 0x35, 0x29, 0xbd,
+  0x51, 0xbb, 0xb4, 0x35, 0xc2, 0x12, 0xa3, 0x5e, 0x4d, 0x3d, 0xf3, 0xa8,
+  0x20, 0xdb, 0x99, 0x8a, 0x90, 0x73, 0x09, 0x29, 0xb7, 0x14, 0xea, 0xcb,
+  0x8d, 0xa1, 0xcc, 0x0f, 0x2c, 0xae, 0x15, 0xa1, 0xa6, 0x12, 0x85, 0x06,
+  0x51, 0xc2, 0xea, 0xef, 0x88, 0x1f, 0x3f, 0x03, 0x7c, 0x77, 0xad, 0x3d,
+  0x50, 0xa1, 0xff, 0x05, 0xe5, 0xf9, 0x97, 0xf8, 0xd1, 0x09, 0xf9, 0x91,
+  0xc0, 0x5b, 0x94, 0x29, 0xe2, 0xf9, 0x1f, 0x01, 0x67, 0xb6, 0xa6, 0x7d,
+  0x40, 0x12, 0x18, 0xf3, 0x1f, 0x6c, 0x38, 0x86, 0x85, 0x41, 0x34, 0xb1,
+  0x87, 0x69, 0x66, 0x7b, 0x32, 0x4e, 0x09, 0xf8, 0x8b, 0x32, 0x8a, 0x3f,
+  0xfe, 0x23, 0xe0, 0xd3, 0xe5, 0x37, 0xb7, 0x6a, 0x9b, 0xf0, 0xe3, 0x84,
+  0xec, 0x40, 0x30, 0x8b, 0xf2, 0x02, 0x9e, 0x3d, 0x09, 0x23, 0xe6, 0x4d,
+  0x5b, 0xac, 0x49, 0x9a, 0xb2, 0x54, 0x76, 0x5f, 0x27, 0xca, 0x64, 0x58,
+  0x36, 0xf6, 0x59, 0xfc, 0xf4, 0xf8, 0x53, 0x02, 0x8a, 0xc7, 0x93, 0xb2,
+  0x23, 0x2d, 0x29, 0x3b, 0x69, 0x4a, 0x73, 0x71, 0xb6, 0x23, 0xe3, 0xcb,
+  0xfe, 0x62, 0x49, 0x0c, 0xe3, 0x82, 0x94, 0xc6, 0x14, 0xf3, 0xe2, 0x44,
+  0x09, 0x4e, 0x05, 0x46, 0x64, 0x4b, 0x17, 0x61, 0x86, 0x51, 0xb7, 0xd4,
+  0x22, 0x13, 0x0f, 0xf2, 0xa4, 0xe3, 0x26, 0xb9, 0xd2, 0xb4, 0x76, 0x68,
+  0xa2, 0x7d, 0x98, 0x2b, 0xc4, 0xff, 0x05, 0x84, 0xff, 0x8a, 0x95, 0x70,
+  0xd8, 0x07, 0xc0, 0x98, 0xcf, 0xa7, 0xf9, 0xe0, 0x57, 0xe4, 0xd3, 0x37,
+  0x8c, 0x3d, 0x6f, 0x3b, 0x2d, 0x53, 0x79, 0x5b, 0x58, 0x7c, 0x8a, 0x32,
+  0xd6, 0x54, 0x7f, 0xea, 0x35, 0xb7, 0x24, 0x55, 0xf9, 0xd0, 0xd3, 0xc4,
+  0x0a, 0x33, 0x8d, 0xe2, 0x0c, 0x8c, 0x0b, 0x01, 0x2e, 0xdc, 0x98, 0x8e,
+  0x27, 0xd7, 0x95, 0xe2, 0x9a, 0x46, 0x78, 0x0d, 0xb3, 0x1d, 0xda, 0x60,
+  0x65, 0x0d, 0x90, 0xfd, 0x3b, 0xa0, 0xeb, 0x89, 0xb9, 0x60, 0x2f, 0xd9,
+  0x8b, 0x1f, 0x86, 0xa9, 0x5b, 0x0d, 0x87, 0x45, 0x7b, 0xf1, 0xca, 0x12,
+  0x37, 0x3b, 0xbe, 0xbf, 0xd0, 0x76, 0xa9, 0xf8, 0xc4, 0x7e, 0x3f, 0xa7,
+  0x00, 0xff, 0x0d, 0xcb, 0x9b, 0x5a, 0xae, 0xb4, 0x67, 0x90, 0x5d, 0x4d,
+  0x6a, 0xb4, 0x3f, 0xff, 0xf3, 0xe3, 0x82, 0x66, 0x84, 0x41, 0x9d, 0x24,
+  0x09, 0xa8, 0xc7, 0x64, 0x99, 0x7b, 0x9d, 0x86, 0x97, 0xc5, 0x25, 0x5d,
+  0xef, 0x8a, 0xfc, 0x5c, 0x02, 0x50, 0x39, 0x90, 0x12, 0x00, 0xd9, 0xb5,
+  0x0c, 0xa0, 0xce, 0x8c, 0xf8, 0x4b, 0xa6, 0x7f, 0xf7, 0x98, 0x79, 0x7e,
+  0xca, 0x2b, 0xaf, 0x2e, 0x69, 0xb5, 0xb0, 0xfa, 0x7a, 0x3a, 0xd7, 0xee,
+  0x15, 0x1a, 0x19, 0xa2, 0x64, 0x75, 0xbc, 0x9b, 0x81, 0xb3, 0x8d, 0xb2,
+  0xc5, 0x78, 0x7d, 0xc4, 0x36, 0x7d, 0x0a, 0x36, 0x81, 0xf9, 0xf0, 0x33,
+  0x30, 0x83, 0x43, 0x02, 0x69, 0x31, 0xda, 0xc5, 0xc7, 0xe9, 0xd0, 0x6b,
+  0x03, 0x92, 0x64, 0x10, 0xaa, 0x3c, 0xfc, 0x7a, 0xb0, 0xc4, 0x70, 0x2c,
+  0x71, 0xa2, 0x8a, 0xef, 0x10, 0x53, 0x24, 0xbc, 0x52, 0xcf, 0x30, 0x80,
+  0x98, 0x40, 0x27, 0xbd, 0x5a, 0xa7, 0xbd, 0x32, 0xd3, 0x91, 0x08, 0x3b,
+  0x6b, 0x67, 0x4f, 0x97, 0x3a, 0x94, 0x19, 0xd2, 0xaf, 0xce, 0x2e, 0xeb,
+  0x8e, 0xcc, 0xae, 0x83, 0xf8, 0x31, 0x90, 0x5d, 0x85, 0x61, 0xdc, 0x0e,
+  0xbe, 0x2b, 0x96, 0x65, 0x58, 0x2c, 0xc2, 0xb2, 0xf4, 0xe9, 0x2a, 0x2c,
+  0xfb, 0x21, 0x9d, 0xad, 0xb9, 0x3d, 0x5b, 0xe0, 0x7b, 0x73, 0x38, 0x66,
+  0x59, 0x06, 0x76, 0x6d, 0x59, 0x87, 0x36, 0x75, 0xc3, 0xac, 0xed, 0x5e,
+  0x2b, 0x68, 0x88, 0x8a, 0x83, 0xa7, 0x1d, 0x1a, 0xb8, 0x96, 0x4c, 0x04,
+  0x3b, 0x3d, 0x48, 0x3b, 0xbd, 0x65, 0x2d, 0x55, 0xa5, 0xab, 0x9f, 0xf3,
+  0x14, 0x72, 0x47, 0x59, 0x3a, 0x97, 0x28, 0xdc, 0xe9, 0xa5, 0xc8, 0x19,
+  0xd3, 0x70, 0xdd, 0xd8, 0x57, 0x4e, 0xe9, 0xbb, 0x64, 0x0e, 0x2a, 0xa3,
+  0xd5, 0xcd, 0xf8, 0x0b, 0xc2, 0xd8, 0xf8, 0x3c, 0xfe, 0x9a, 0x31, 0xf3,
+  0x29, 0xfc, 0x3d, 0xdc, 0x58, 0x86, 0x3b, 0xea, 0xd2, 0xc9, 0xe6, 0x46,
+  0x08, 0x0a, 0xe1, 0x6d, 0x43, 0x6e, 0xa0, 0x2d, 0x3f, 0x30, 0x8a, 0x42,
+  0x9b, 0x76, 0x27, 0xd8, 0xf8, 0xc4, 0xec, 0x3e, 0xc9, 0x24, 0x1e, 0xb0,
+  0x1c, 0xff, 0x3e, 0xb6, 0xec, 0x19, 0xd8, 0x8d, 0xe5, 0x49, 0x6e, 0x4b,
+  0x6c, 0x77, 0x03, 0xc4, 0xaf, 0xe1, 0x27, 0xab, 0xba, 0xb1, 0xe2, 0x26,
+  0xac, 0x47, 0xff, 0x00, 0x7b, 0xf4, 0xc6, 0x47, 0x7e, 0x8f, 0x70, 0xf1,
+  0x34, 0x68, 0x75, 0xcd, 0x74, 0x3f, 0xed, 0x92, 0x8f, 0x2d, 0xc7, 0x8d,
+  0xfc, 0xae, 0xed, 0xb6, 0x27, 0xa0, 0x7e, 0xee, 0xab, 0xf8, 0xb9, 0x8d,
+  0xef, 0x0c, 0xe8, 0x57, 0xb0, 0x55, 0xae, 0x40, 0xd2, 0xdc, 0x83, 0x51,
+  0xf5, 0x65, 0x63, 0x1c, 0x3a, 0x2e, 0x2d, 0xca, 0x60, 0x85, 0xa7, 0x1f,
+  0x04, 0x34, 0xba, 0x02, 0xcb, 0xae, 0xe2, 0x63, 0x89, 0x4a, 0xc8, 0x80,
+  0x37, 0xc2, 0x41, 0xe0, 0x4c, 0x22, 0x69, 0x1b, 0x97, 0x46, 0x64, 0x5b,
+  0xb6, 0xd9, 0x90, 0xf4, 0xc8, 0xdd, 0xfd, 0xf5, 0x6c, 0xc5, 0x70, 0xea,
+  0x0d, 0xb0, 0x09, 0x40, 0x92, 0xb6, 0x39, 0xa4, 0x17, 0x6f, 0x5a, 0x63,
+  0xda, 0xcc, 0xcd, 0x5b, 0x7a, 0x21, 0xe0, 0x8a, 0xd3, 0xbc, 0x3d, 0x62,
+  0xfb, 0x83, 0xe9, 0x18, 0xc7, 0x1d, 0xff, 0x71, 0x4a, 0x83, 0xbd, 0x2d,
+  0xea, 0xd2, 0x41, 0xe4, 0x07, 0x17, 0x5d, 0xb7, 0x51, 0x97, 0xa7, 0x21,
+  0xeb, 0xcd, 0x75, 0x03, 0x0c, 0x6e, 0x7c, 0x55, 0xc0, 0xf0, 0x95, 0x3a,
+  0x14, 0xc4, 0x01, 0xc7, 0x25, 0x5f, 0xb3, 0x06, 0x23, 0xc4, 0x96, 0xf4,
+  0x36, 0xf1, 0x5a, 0x9b, 0x99, 0xc3, 0x35, 0x27, 0x8c, 0xda, 0x01, 0x1d,
+  0x83, 0xe9, 0x35, 0xea, 0xbc, 0x3b, 0x5f, 0x6f, 0x6a, 0x00, 0x04, 0x02,
+  0x29, 0x0c, 0xf4, 0x39, 0x00, 0x03, 0xfe, 0xa9, 0x0e, 0x23, 0x45, 0x7d,
+  0x9b, 0x46, 0xaf, 0xb9, 0x14, 0x7f, 0xfd, 0xe9, 0xde, 0x55, 0x3b, 0xe5,
+  0x9e, 0x04, 0xc9, 0xb2, 0xed, 0x0c, 0x8c, 0x0a, 0x85, 0x1d, 0x3b, 0xb7,
+  0xf9, 0xb1, 0xcb, 0xec, 0x27, 0xf6, 0x0d, 0x52, 0xd3, 0x5b, 0xca, 0x46,
+  0xa9, 0x61, 0x17, 0x1a, 0x6f, 0xcb, 0x2c, 0xd7, 0xf0, 0xae, 0xf3, 0x46,
+  0x73, 0xbd, 0x99, 0xb4, 0xc4, 0xaa, 0x91, 0x5b, 0x57, 0xbb, 0xc6, 0xf0,
+  0x38, 0xd3, 0xe0, 0x76, 0x32, 0x34, 0xd3, 0xcb, 0xf6, 0xfe, 0x09, 0xa9,
+  0xa3, 0x36, 0xd7, 0x49, 0x97, 0xd4, 0xd9, 0x38, 0x6a, 0xbd, 0xe2, 0x16,
+  0x59, 0x85, 0x37, 0x03, 0x3c, 0x87, 0x8a, 0xf0, 0xd9, 0x46, 0x55, 0x18,
+  0xa7, 0xf7, 0xfb, 0x8c, 0xec, 0x4b, 0xbb, 0x7b, 0x65, 0xfc, 0x93, 0x9b,
+  0x8b, 0xf3, 0x32, 0x51, 0x6d, 0xd0, 0x19, 0xa8, 0xcc, 0x30, 0x98, 0x97,
+  0x4c, 0xd7, 0xb7, 0xec, 0x2c, 0x6a, 0xea, 0xd3, 0xef, 0x34, 0x02, 0xf5,
+  0xaf, 0x2f, 0x03, 0x3e, 0x60, 0x74, 0x19, 0x97, 0x73, 0x69, 0x43, 0x3b,
+  0x1a, 0x51, 0xaf, 0x01, 0xb9, 0xf1, 0x04, 0x18, 0x42, 0xd1, 0x58, 0x92,
+  0xdf, 0xdb, 0xbf, 0x0c, 0x7d, 0xaf, 0xd1, 0x2c, 0x7a, 0x04, 0x72, 0x06,
+  0x0b, 0x97, 0xdf, 0x35, 0x16, 0x7f, 0xc8, 0x5e, 0x1f, 0x08, 0x75, 0x7d,
+  0xc8, 0x25, 0xae, 0x01, 0xa6, 0xd4, 0x26, 0x61, 0xe2, 0xa7, 0xd8, 0x71,
+  0x79, 0x48, 0x03, 0x88, 0xa1, 0x5d, 0xc8, 0x2a, 0x10, 0x52, 0x73, 0xdd,
+  0x08, 0x26, 0xe7, 0xe0, 0x70, 0xad, 0x79, 0xe9, 0xc4, 0x9f, 0x4c, 0x5d,
+  0xc8, 0x63, 0xae, 0x40, 0x76, 0xd6, 0x28, 0x00, 0xc7, 0x33, 0x9d, 0xe4,
+  0x54, 0xd4, 0xb4, 0x6a, 0xdf, 0x40, 0xee, 0xc0, 0x42, 0x5e, 0xd2, 0x20,
+  0xf0, 0x03, 0x24, 0x38, 0x21, 0x8d, 0x5d, 0x68, 0xd4, 0x5f, 0x63, 0xd7,
+  0x51, 0x18, 0x80, 0x62, 0x4a, 0x23, 0xd2, 0xc5, 0x16, 0x34, 0x67, 0x58,
+  0xb9, 0x8a, 0x76, 0x32, 0x35, 0x34, 0x4b, 0xaf, 0x54, 0xbe, 0xb4, 0xd1,
+  0x54, 0x50, 0x7f, 0x84, 0xa5, 0xa3, 0x02, 0x65, 0x67, 0x6e, 0x99, 0xce,
+  0x02, 0xff, 0xb0, 0xae, 0xd3, 0x7c, 0xae, 0xe6, 0x66, 0xd6, 0x55, 0x0c,
+  0x9c, 0x21, 0xd1, 0x77, 0xd3, 0xda, 0x43, 0xe4, 0xa5, 0x97, 0x48, 0xf9,
+  0x8a, 0xb6, 0x4b, 0xbd, 0xed, 0x68, 0x44, 0x36, 0x49, 0xa7, 0x69, 0xd0,
+  0x17, 0x6e, 0x8a, 0xf0, 0x0c, 0xe0, 0x57, 0x0e, 0xe8, 0x9d, 0xce, 0xbb,
+  0x79, 0x91, 0x15, 0xdb, 0x1e, 0x1e, 0x05, 0x35, 0x79, 0xbe, 0x0a, 0xa0,
+  0x01, 0x16, 0x3b, 0x1d, 0x22, 0xef, 0xbf, 0x4f, 0xea, 0xf5, 0x39, 0xe0,
+  0xa4, 0xe7, 0x2a, 0x2a, 0xac, 0xe4, 0xf2, 0xdc, 0xf0, 0x8c, 0xfe, 0x44,
+  0x00, 0x95, 0xee, 0x21, 0x5c, 0x56, 0x1a, 0xe7, 0x41, 0x9b, 0x3d, 0xdc,
+  0x3c, 0xac, 0xc9, 0xf6, 0x57, 0xd8, 0x23, 0x6d, 0x3d, 0x17, 0x49, 0x6a,
+  0x53, 0xd9, 0x04, 0x54, 0xdc, 0x5b, 0x10, 0xb2, 0xe8, 0xc2, 0x9a, 0x00,
+  0xf3, 0x5b, 0x0b, 0xc2, 0xc5, 0x8e, 0xa6, 0x09, 0x28, 0x5c, 0x37, 0x41,
+  0xdc, 0x3f, 0x75, 0xaa, 0xb2, 0xe6, 0x5d, 0x94, 0x99, 0xab, 0xa9, 0x35,
+  0xbf, 0x6f, 0xda, 0x61, 0xa6, 0x12, 0x96, 0x81, 0xcd, 0xd6, 0x24, 0xa0,
+  0xab, 0xc1, 0x96, 0xca, 0xe2, 0x42, 0xd8, 0xf9, 0x12, 0x1a, 0xf7, 0xe8,
+  0x54, 0xc4, 0x5e, 0xaa, 0x22, 0x67, 0xef, 0x90, 0xae, 0xd5, 0x76, 0x30,
+  0xb9, 0x4f, 0x53, 0xed, 0x3a, 0xb1, 0xf0, 0x05, 0x5d, 0x5e, 0xa6, 0x1a,
+  0xa3, 0xfe, 0x6d, 0xba, 0x87, 0xb1, 0x04, 0xd7, 0xb5, 0x21, 0x0e, 0x3b,
+  0x11, 0x24, 0xa5, 0x7a, 0xfe, 0x86, 0xe9, 0xf5, 0x60, 0x1a, 0xe0, 0x3b,
+  0x51, 0x39, 0x54, 0x35, 0xbe, 0x42, 0xb2, 0x49, 0x1a, 0xb8, 0xde, 0x81,
+  0x95, 0x9d, 0x75, 0xf8, 0x67, 0x83, 0x6d, 0x91, 0xb8, 0xbd, 0x16, 0x0e,
+  0x79, 0x39, 0x67, 0xce, 0x98, 0x7c, 0x1f, 0xba, 0xd7, 0xd3, 0x62, 0x9f,
+  0x77, 0xf0, 0xa1, 0x77, 0x9c, 0x77, 0xdf, 0x6d, 0x16, 0x05, 0x55, 0x6d,
+  0x9d, 0x48, 0xf8, 0x73, 0x31, 0xec, 0x54, 0xc1, 0x83, 0xb0, 0x5e, 0x07,
+  0x51, 0xaa, 0xdf, 0x88, 0x1c, 0x32, 0x89, 0xf4, 0x7a, 0x3d, 0x62, 0x6a,
+  0xa2, 0xa0, 0x80, 0x0c, 0x0b, 0x24, 0x61, 0x1b, 0x28, 0x49, 0xc4, 0x3f,
+  0xc1, 0x17, 0xb1, 0xaf, 0x40, 0xe0, 0x8c, 0x1a, 0x5c, 0x56, 0xa5, 0xb8,
+  0x28, 0x88, 0x6b, 0xdc, 0x65, 0x9c, 0x60, 0x30, 0xf2, 0x45, 0x49, 0x9a,
+  0x84, 0xbc, 0xc5, 0x34, 0xc5, 0xd6, 0x44, 0x89, 0x71, 0x5a, 0xbd, 0x62,
+  0x0a, 0x80, 0x19, 0x8d, 0x63, 0xe6, 0x31, 0x0c, 0x54, 0x95, 0xa7, 0x16,
+  0xfb, 0x15, 0x94, 0x38, 0x7b, 0xd6, 0x5c, 0x9f, 0x65, 0xe3, 0x5c, 0x65,
+  0xc9, 0xaa, 0xb4, 0xac, 0x5e, 0x21, 0x96, 0x23, 0x3d, 0xc5, 0x31, 0x79,
+  0x7c, 0xd9, 0x0b, 0xdf, 0x0a, 0x5c, 0xd8, 0xef, 0xd6, 0x28, 0x8a, 0x26,
+  0xdd, 0xe5, 0xe5, 0x17, 0xef, 0x1a, 0x00, 0xec, 0x03, 0x87, 0x07, 0x96,
+  0x7b, 0x4b, 0xdb, 0x2e, 0xd9, 0x52, 0x42, 0xa9, 0x48, 0xb3, 0xa5, 0x25,
+  0x6d, 0x2c, 0xcf, 0x61, 0x47, 0xb1, 0xf7, 0xfa, 0xcc, 0xf5, 0x8e, 0xe7,
+  0xd1, 0xe0, 0x26, 0xbd, 0x13, 0x95, 0x3d, 0xb4, 0x5f, 0x26, 0x8e, 0xac,
+  0x50, 0x56, 0x1a, 0x51, 0xe9, 0x10, 0xa8, 0x56, 0x68, 0x19, 0x92, 0x2f,
+  0x41, 0x39, 0x52, 0x9b, 0x2c, 0x54, 0x72, 0x39, 0x0e, 0x43, 0xb8, 0xfd,
+  0x5e, 0xd5, 0xc0, 0xd1, 0x8e, 0x02, 0x47, 0xc9, 0x65, 0x11, 0x7e, 0x02,
+  0x04, 0xb5, 0x31, 0xa7, 0x89, 0x96, 0x4b, 0x03, 0xf0, 0x66, 0xf1, 0x17,
+  0xc7, 0xbf, 0x8e, 0x8f, 0xe2, 0xaf, 0xb0, 0xdf, 0xd2, 0x25, 0x15, 0x8f,
+  0xb4, 0xb0, 0x61, 0x73, 0x48, 0xe2, 0xa7, 0xf1, 0xf3, 0xf8, 0x4f, 0x78,
+  0xf2, 0x4a, 0xe2, 0xaf, 0x8e, 0xef, 0xf3, 0xe6, 0xdb, 0xb7, 0xc7, 0x1f,
+  0xb1, 0xe5, 0xf7, 0xe3, 0xa7, 0x39, 0x47, 0x39, 0x9b, 0x16, 0x36, 0x51,
+  0xab, 0x5b, 0x44, 0x40, 0xa3, 0x69, 0xe0, 0xc9, 0xce, 0xdd, 0x9c, 0xf3,
+  0xb7, 0x53, 0xa6, 0xf1, 0x5f, 0xd6, 0x75, 0xa6, 0x4a, 0x41, 0xaf, 0x37,
+  0x4f, 0xf8, 0x34, 0x32, 0x37, 0x5b, 0x56, 0x92, 0xb3, 0x9a, 0x17, 0x6e,
+  0x90, 0x0b, 0x26, 0xed, 0x36, 0x4b, 0xa4, 0xd2, 0xf1, 0x1a, 0xfb, 0x18,
+  0x3f, 0x41, 0x69, 0xc4, 0xcf, 0x08, 0x6b, 0xa3, 0x3d, 0x04, 0xc1, 0x7c,
+  0x00, 0x17, 0x0e, 0x92, 0xa6, 0x28, 0x13, 0xd8, 0x21, 0x1b, 0x59, 0x3d,
+  0x24, 0x17, 0x88, 0xe8, 0x2f, 0x3f, 0x48, 0x9a, 0x65, 0x39, 0x69, 0x55,
+  0xcf, 0x31, 0x8c, 0x52, 0xab, 0xfe, 0x78, 0xc8, 0x5a, 0x3e, 0xa6, 0xe7,
+  0x75, 0xc9, 0xeb, 0x06, 0x59, 0xa0, 0x07, 0x8a, 0x9c, 0xb3, 0x0f, 0x42,
+  0x1f, 0xf6, 0x09, 0x75, 0xd9, 0x80, 0xba, 0xc1, 0xe4, 0x66, 0x19, 0xdc,
+  0x4c, 0x73, 0x9b, 0xcb, 0xd8, 0x66, 0xcc, 0xc2, 0x7d, 0x1f, 0x56, 0x76,
+  0x62, 0x1b, 0xcb, 0x97, 0x59, 0x6d, 0xc1, 0x38, 0xfc, 0xa7, 0xd0, 0xe4,
+  0xaa, 0x18, 0x5c, 0x25, 0x73, 0xab, 0x68, 0x6c, 0x27, 0x36, 0x35, 0x76,
+  0x3e, 0xfb, 0x17, 0x33, 0xab, 0x13, 0x19, 0xd5, 0xf7, 0x61, 0x52, 0x06,
+  0xb1, 0x4b, 0xa2, 0x4d, 0x7e, 0xcd, 0x89, 0x5f, 0xae, 0x51, 0x17, 0x6f,
+  0x9b, 0xcd, 0xc6, 0x45, 0xdd, 0x47, 0xfa, 0x24, 0x61, 0x84, 0xea, 0x21,
+  0xdd, 0x31, 0xa7, 0x4e, 0x61, 0x05, 0x6c, 0xf5, 0x8a, 0x38, 0xa7, 0xaf,
+  0x3a, 0xb8, 0xa4, 0xa0, 0xed, 0xcd, 0x59, 0x15, 0xcf, 0x04, 0x2c, 0x0a,
+  0xda, 0xde, 0x7c, 0x35, 0x71, 0x0a, 0x36, 0x67, 0x3d, 0x19, 0xf5, 0x46,
+  0x2f, 0x56, 0x66, 0x39, 0xa8, 0xee, 0x87, 0xea, 0x14, 0xe3, 0x82, 0xfe,
+  0xab, 0x6a, 0x37, 0xa2, 0xd0, 0x40, 0xca, 0x55, 0x5c, 0xa5, 0x35, 0x15,
+  0xcd, 0x82, 0x04, 0x27, 0x33, 0x7a, 0xdf, 0x1f, 0xad, 0x99, 0x4e, 0x7c,
+  0x27, 0x04, 0x27, 0x2a, 0xb3, 0x28, 0xbd, 0x45, 0xa3, 0x77, 0xdf, 0x1f,
+  0x03, 0x52, 0xe5, 0x9d, 0x93, 0xfe, 0x53, 0xc5, 0xdd, 0x61, 0x63, 0x14,
+  0xcb, 0x2c, 0x3f, 0x4c, 0x9d, 0xc7, 0x22, 0x20, 0x32, 0x6b, 0x57, 0x3e,
+  0x2f, 0x06, 0x2c, 0xb5, 0x70, 0xf9, 0xe3, 0x62, 0xa0, 0xb0, 0x51, 0xd5,
+  0x9b, 0xa3, 0xcb, 0x95, 0xf3, 0x3e, 0x5c, 0xa5, 0x04, 0x63, 0xb9, 0x1b,
+  0xc2, 0xf9, 0x86, 0xcb, 0xac, 0xbb, 0x4f, 0x3c, 0xba, 0x4b, 0xae, 0x88,
+  0x8f, 0xc9, 0x53, 0xc9, 0xed, 0xb6, 0x35, 0x99, 0x50, 0xcf, 0x6e, 0xd4,
+  0xb0, 0x27, 0x9f, 0x4e, 0xea, 0x2d, 0x91, 0xbf, 0xdf, 0xba, 0xfe, 0x26,
+  0x60, 0x17, 0xc0, 0x47, 0x67, 0xb8, 0xa7, 0x15, 0x9c, 0xcd, 0xc4, 0x43,
+  0x25, 0x07, 0x14, 0x72, 0xc9, 0x05, 0xb5, 0x78, 0xa6, 0xba, 0x63, 0x1a,
+  0x8d, 0x7c, 0xbb, 0x4b, 0xea, 0x37, 0xae, 0x6f, 0xdd, 0xac, 0x2f, 0x29,
+  0x5f, 0x8c, 0xd6, 0x4d, 0x91, 0x38, 0x25, 0x35, 0xed, 0x2b, 0x1e, 0x65,
+  0x14, 0x1d, 0x5f, 0xa0, 0x39, 0xe1, 0x55, 0xf1, 0x12, 0x3c, 0xb7, 0x26,
+  0x31, 0x35, 0x55, 0x98, 0xfb, 0x7d, 0x9e, 0x1f, 0x4b, 0xb8, 0x27, 0x0d,
+  0x2f, 0xe0, 0x6b, 0x2e, 0xf7, 0x4f, 0x2b, 0x85, 0x78, 0x9a, 0xa9, 0xce,
+  0xb0, 0xcf, 0x1c, 0x20, 0x3c, 0x54, 0x07, 0x76, 0x90, 0x33, 0xec, 0x10,
+  0xa4, 0x3d, 0x06, 0xb4, 0xac, 0x6d, 0x9a, 0x17, 0xa5, 0xa0, 0xb2, 0xca,
+  0xa9, 0x05, 0x30, 0xbf, 0xf0, 0xd0, 0x42, 0xad, 0x8c, 0x79, 0x8b, 0xe2,
+  0x9a, 0xb3, 0x43, 0xb9, 0x2a, 0x24, 0x2f, 0x3e, 0x66, 0xc7, 0x4c, 0xc9,
+  0x3d, 0xe9, 0x8c, 0x29, 0x2f, 0x90, 0x7c, 0x6e, 0x77, 0x3a, 0x95, 0x91,
+  0x6f, 0xec, 0x0e, 0x44, 0xa3, 0xc0, 0xdf, 0x65, 0x7a, 0xc8, 0x50, 0x6e,
+  0xdc, 0x7a, 0xfd, 0xe6, 0xcd, 0x1b, 0x1c, 0xcb, 0xd3, 0x84, 0x4b, 0xaa,
+  0x4b, 0x5e, 0xbc, 0x9b, 0x42, 0xe1, 0x97, 0xf6, 0x6f, 0x35, 0xcb, 0x3c,
+  0x27, 0xf7, 0x2d, 0xba, 0x7a, 0x48, 0x9c, 0xcc, 0xd3, 0x80, 0x5f, 0x85,
+  0x95, 0x90, 0x28, 0xdd, 0xe5, 0x5c, 0xc6, 0x03, 0xf6, 0x4b, 0xbe, 0xe7,
+  0x51, 0xc6, 0xac, 0x6b, 0x7e, 0x18, 0x71, 0x06, 0xa6, 0xec, 0x53, 0x9f,
+  0x67, 0x6a, 0x96, 0x10, 0x6b, 0x6e, 0x1c, 0x55, 0xeb, 0xef, 0x88, 0xd3,
+  0x44, 0xfe, 0xae, 0x7a, 0x2f, 0xeb, 0xf8, 0x16, 0xfb, 0x03, 0x79, 0xa6,
+  0x0c, 0x9e, 0x97, 0x7b, 0x27, 0xb7, 0xcc, 0x03, 0x65, 0x2f, 0xde, 0x65,
+  0xea, 0x26, 0xfa, 0x6f, 0xf0, 0x68, 0x64, 0x79, 0x03, 0xf0, 0x23, 0xfe,
+  0x15, 0x7c, 0x79, 0xbd, 0xb1, 0xd2, 0xdc, 0x67, 0x93, 0x49, 0xb7, 0xd6,
+  0x25, 0x6a, 0x2e, 0xf1, 0x4e, 0xe0, 0x16, 0x93, 0x45, 0x43, 0x9c, 0xef,
+  0xc9, 0xfc, 0xc8, 0x33, 0x4c, 0x6b, 0xb7, 0x8c, 0x17, 0x6c, 0x75, 0x8d,
+  0x4d, 0x5d, 0xa1, 0x3a, 0x0e, 0x14, 0x81, 0x09, 0x3d, 0x64, 0x13, 0x6b,
+  0x87, 0x69, 0x61, 0x46, 0x44, 0x0c, 0x63, 0xc6, 0xcb, 0xe8, 0x7e, 0xc0,
+  0x47, 0x55, 0xbe, 0x65, 0xc3, 0x2a, 0x50, 0x13, 0x30, 0x36, 0x3c, 0x17,
+  0x3d, 0xfa, 0xb1, 0xd6, 0xa1, 0xaa, 0xbf, 0xa0, 0xdf, 0xd0, 0xc4, 0x11,
+  0x50, 0xbb, 0xce, 0xe8, 0x5e, 0x5e, 0x26, 0xf1, 0x1f, 0xf3, 0x5b, 0x21,
+  0xe3, 0x70, 0x84, 0xe6, 0x39, 0x1f, 0xc1, 0x39, 0x82, 0xeb, 0xf7, 0x21,
+  0x20, 0x1f, 0xf0, 0x50, 0xfb, 0x98, 0x27, 0x5d, 0xe2, 0x1e, 0x7b, 0xdb,
+  0x33, 0x2d, 0x4a, 0x90, 0x02, 0xd6, 0x2e, 0x40, 0xdf, 0x00, 0x2e, 0xe6,
+  0xf8, 0x57, 0x24, 0x89, 0xd6, 0x98, 0xa6, 0x61, 0xb4, 0xe6, 0xef, 0x1b,
+  0x3e, 0xc2, 0x98, 0xfe, 0x00, 0x11, 0x70, 0x41, 0xf9, 0x5e, 0xa7, 0x56,
+  0x10, 0xf5, 0xa9, 0x15, 0x6d, 0xd1, 0x01, 0x2b, 0x4c, 0xe3, 0xc7, 0xc7,
+  0x1f, 0xc1, 0x53, 0x0f, 0xd7, 0x09, 0x8e, 0xd8, 0x20, 0x76, 0xc0, 0x15,
+  0xd9, 0x9a, 0x09, 0x6f, 0x48, 0x80, 0x62, 0xfc, 0x16, 0xb0, 0xbf, 0x87,
+  0x63, 0x3d, 0x00, 0x12, 0xbb, 0x13, 0xf0, 0xf8, 0x33, 0x8c, 0xfe, 0x84,
+  0xbd, 0x04, 0x03, 0x18, 0x22, 0x2e, 0xa8, 0x3a, 0x90, 0x10, 0x9c, 0xc2,
+  0x6e, 0x38, 0x6e, 0x78, 0xc3, 0x77, 0xdd, 0x9b, 0xce, 0x98, 0x22, 0x3b,
+  0xbc, 0xa9, 0xeb, 0xae, 0xcb, 0x3a, 0x80, 0x5f, 0xce, 0x88, 0xfb, 0xf0,
+  0xce, 0x6c, 0xd6, 0x70, 0x63, 0x6e, 0x61, 0xd7, 0xf1, 0x6c, 0x7f, 0xb7,
+  0xfd, 0x1a, 0x8e, 0x51, 0x6c, 0xf9, 0xd3, 0x60, 0xa0, 0xf4, 0xf2, 0x75,
+  0xd8, 0xe0, 0xc1, 0xae, 0xe2, 0x6b, 0xe1, 0x10, 0xe3, 0x1a, 0xaa, 0xab,
+  0x5a, 0x62, 0x5f, 0xa8, 0x20, 0xd9, 0xb6, 0x9c, 0x57, 0x28, 0x61, 0x2f,
+  0x64, 0xbb, 0x88, 0xa0, 0x27, 0xed, 0x0b, 0xee, 0x0d, 0xb7, 0x63, 0x57,
+  0xc2, 0x24, 0xd5, 0xe1, 0x8b, 0x71, 0x9c, 0x83, 0x5d, 0xc7, 0xd9, 0x0e,
+  0x0a, 0x0a, 0xd7, 0xa8, 0xe3, 0x52, 0x74, 0xa3, 0x3b, 0xac, 0xdf, 0xae,
+  0xc7, 0x17, 0x05, 0xef, 0x5c, 0xb1, 0xe2, 0x82, 0x78, 0x52, 0x32, 0xd4,
+  0xa5, 0xda, 0xe1, 0x84, 0x91, 0xb5, 0x79, 0x5f, 0xa7, 0xb9, 0x1d, 0x16,
+  0x99, 0x59, 0xdb, 0xbd, 0xc1, 0xc7, 0x53, 0x98, 0x65, 0x0a, 0xd8, 0xfb,
+  0x2a, 0x65, 0xbe, 0x27, 0x42, 0x07, 0x01, 0xb9, 0x28, 0x74, 0x98, 0x6c,
+  0x57, 0x2d, 0xeb, 0x4f, 0x6b, 0x64, 0xce, 0x23, 0xad, 0xb5, 0x4c, 0x5a,
+  0xfb, 0x22, 0x08, 0x19, 0xbb, 0xe5, 0x06, 0x17, 0x53, 0x58, 0xfb, 0xa5,
+  0x63, 0xb9, 0xb3, 0x52, 0xa5, 0x74, 0x61, 0xc1, 0x78, 0x53, 0xe4, 0x5d,
+  0xf7, 0xca, 0x60, 0xa4, 0x63, 0xd5, 0xc5, 0xcf, 0x0f, 0x87, 0x55, 0x00,
+  0x0c, 0x87, 0xb9, 0xe6, 0x3d, 0x9a, 0x14, 0xc7, 0x31, 0xf1, 0x6a, 0xda,
+  0xd1, 0x61, 0x9a, 0xbf, 0x38, 0x21, 0x0b, 0x95, 0x6c, 0xb8, 0xda, 0x14,
+  0x52, 0x55, 0x28, 0xf1, 0x17, 0x50, 0xee, 0x7c, 0x16, 0xff, 0x36, 0xfe,
+  0x43, 0xfc, 0x9b, 0x2e, 0xbe, 0x60, 0x8e, 0x4d, 0x90, 0x8f, 0xc1, 0x9c,
+  0x1f, 0xa3, 0x65, 0xb3, 0xfc, 0xff, 0x21, 0x33, 0xee, 0x6f, 0x99, 0x3b,
+  0x79, 0x8e, 0x63, 0x7d, 0xa7, 0x0d, 0x27, 0xad, 0x0a, 0xff, 0xcc, 0x9e,
+  0x50, 0x09, 0xc8, 0xa6, 0x34, 0x68, 0x26, 0x1c, 0xf1, 0xc5, 0x39, 0x85,
+  0xdb, 0x33, 0xa2, 0xce, 0xf4, 0x44, 0x86, 0x94, 0xce, 0x7a, 0xff, 0x62,
+  0x02, 0x4c, 0xc5, 0x01, 0x89, 0xf8, 0x4b, 0x70, 0xf9, 0x1f, 0xb3, 0xc9,
+  0xdb, 0x6f, 0x12, 0x4f, 0x79, 0x14, 0x3f, 0x65, 0x13, 0x13, 0xf1, 0x6f,
+  0xe2, 0x07, 0xdc, 0x7f, 0x19, 0xde, 0xe4, 0x93, 0xd6, 0xce, 0xda, 0xbb,
+  0x4e, 0xde, 0x27, 0xd5, 0x10, 0x9c, 0x24, 0x23, 0xf0, 0x0c, 0xb5, 0xcf,
+  0x93, 0x71, 0x49, 0x12, 0xff, 0x0e, 0x84, 0xf1, 0xef, 0x1c, 0x29, 0xe5,
+  0xea, 0xff, 0xb1, 0xeb, 0x65, 0x99, 0x8d, 0xca, 0x3d, 0x39, 0x08, 0x66,
+  0xfb, 0xcb, 0xc9, 0xa8, 0x69, 0x5a, 0x50, 0x9e, 0xcd, 0x77, 0xc2, 0xeb,
+  0x9e, 0x79, 0xb6, 0xe8, 0xd6, 0xb2, 0x58, 0xf8, 0x13, 0x84, 0x4c, 0x7b,
+  0x2f, 0xde, 0xc5, 0xb5, 0x48, 0x89, 0xef, 0x31, 0xd4, 0x7d, 0x50, 0x62,
+  0xc8, 0xc3, 0x7e, 0xa8, 0x89, 0x23, 0x3d, 0x7d, 0x3f, 0x5d, 0x96, 0xbe,
+  0x9b, 0x53, 0xf9, 0x43, 0x1c, 0x64, 0xc5, 0x98, 0xfa, 0x84, 0x45, 0xbd,
+  0x4f, 0xe4, 0x98, 0x7b, 0x24, 0xde, 0xf3, 0x14, 0xf1, 0x30, 0x4d, 0x90,
+  0x94, 0x21, 0xed, 0xd2, 0xf4, 0xbc, 0xfc, 0x88, 0x36, 0x4b, 0x9e, 0xb2,
+  0x24, 0xfb, 0xbb, 0x1b, 0x4f, 0x12, 0x19, 0x3e, 0x61, 0x76, 0xc0, 0xe4,
+  0x55, 0x79, 0x40, 0x29, 0xf7, 0xda, 0x44, 0xc1, 0xa4, 0x99, 0xb6, 0xae,
+  0xfe, 0x57, 0x2d, 0x78, 0x10, 0xe6, 0x57, 0x3c, 0x1b, 0x4a, 0x04, 0x9f,
+  0xda, 0xff, 0x8f, 0x56, 0xc6, 0x4c, 0x00, 0x4c, 0xca, 0xdc, 0xf1, 0x11,
+  0x1c, 0x01, 0x2b, 0x12, 0xb3, 0xc8, 0xb2, 0xd9, 0x37, 0x55, 0x95, 0xc4,
+  0xa3, 0x6c, 0x38, 0x1e, 0xe3, 0x11, 0x7f, 0x48, 0x1e, 0x28, 0x9f, 0xf9,
+  0xec, 0xa5, 0x6c, 0x5c, 0x58, 0xc4, 0x63, 0x75, 0xd6, 0xb9, 0x34, 0x22,
+  0xab, 0x4b, 0x59, 0x44, 0xc4, 0x28, 0x18, 0x59, 0x93, 0x4b, 0xfe, 0x94,
+  0x6d, 0xde, 0x59, 0x4f, 0xae, 0x60, 0x6e, 0x01, 0xfb, 0xc9, 0x09, 0xe6,
+  0xc8, 0xf2, 0x6c, 0x97, 0x0f, 0xca, 0x5f, 0xc2, 0xc9, 0x79, 0x9e, 0xf4,
+  0xc8, 0x59, 0xa6, 0x3c, 0xa4, 0xcb, 0xea, 0x7d, 0xc6, 0x10, 0x59, 0x67,
+  0xe4, 0x59, 0xfb, 0x24, 0x67, 0x94, 0x0b, 0x19, 0xe9, 0xeb, 0x5d, 0xc4,
+  0x53, 0xfc, 0xeb, 0xa9, 0xb4, 0x89, 0xdf, 0xec, 0xdb, 0xaa, 0x92, 0xcc,
+  0x80, 0x2f, 0xcb, 0xe7, 0x8f, 0x6c, 0xc6, 0x1f, 0x84, 0xa6, 0x23, 0x9f,
+  0xa4, 0x03, 0x2a, 0xf1, 0x4c, 0x8d, 0x25, 0x3e, 0xe7, 0xc6, 0x4b, 0x95,
+  0x79, 0x5c, 0x8d, 0xa1, 0xe9, 0x20, 0x4e, 0xbd, 0xae, 0x56, 0x67, 0x32,
+  0xd1, 0x05, 0x54, 0x25, 0x33, 0xd4, 0x2a, 0x61, 0x62, 0x97, 0x48, 0x08,
+  0xa3, 0xa1, 0xa7, 0x8e, 0x1c, 0x0a, 0x7f, 0xb6, 0x3a, 0xdd, 0x8c, 0xeb,
+  0x2c, 0x8f, 0xe7, 0x55, 0xa4, 0x4e, 0x86, 0x81, 0x89, 0xec, 0xcd, 0x16,
+  0xfc, 0xd2, 0x12, 0x41, 0x92, 0x2a, 0x7a, 0xd1, 0xe6, 0x02, 0x00, 0x40,
+  0xbc, 0x32, 0xa8, 0x8d, 0xd7, 0xb2, 0x29, 0x43, 0x96, 0xcb, 0xe2, 0x25,
+  0xe5, 0x2c, 0xbf, 0xa0, 0x80, 0x48, 0x06, 0x4d, 0x6a, 0xf1, 0xff, 0x80,
+  0x23, 0xf9, 0x06, 0x5f, 0xdf, 0xc1, 0xf7, 0x78, 0xbe, 0xe2, 0x0d, 0x9c,
+  0x6e, 0x6d, 0x89, 0x6d, 0xd8, 0xc6, 0xaf, 0x1f, 0x49, 0x38, 0x35, 0x9d,
+  0xe0, 0xd8, 0x28, 0x12, 0xd2, 0x60, 0xbb, 0x00, 0x75, 0x78, 0x4b, 0x11,
+  0x68, 0xb1, 0x86, 0x98, 0x69, 0xd3, 0xd5, 0x1a, 0xfe, 0xd9, 0xc6, 0xb1,
+  0x75, 0xde, 0xce, 0xba, 0x08, 0x0e, 0x31, 0xc1, 0x5f, 0x51, 0xa7, 0x33,
+  0x67, 0xc4, 0xd7, 0x6c, 0x61, 0x0d, 0x92, 0x88, 0x2f, 0x33, 0xab, 0xa6,
+  0x34, 0xe0, 0x90, 0x6a, 0xe0, 0x66, 0x8f, 0xac, 0x29, 0xb6, 0x22, 0x73,
+  0x61, 0x8b, 0x09, 0x49, 0x90, 0xc8, 0x5c, 0x11, 0xff, 0x46, 0x1d, 0x9c,
+  0xc1, 0x39, 0x5d, 0x93, 0x9c, 0x91, 0xaa, 0xd0, 0x59, 0x95, 0xa1, 0x09,
+  0x99, 0x51, 0x9d, 0xda, 0xa0, 0x9e, 0x3c, 0x66, 0x98, 0xf2, 0xf2, 0x42,
+  0x53, 0x40, 0x75, 0x13, 0x54, 0xa6, 0x55, 0xa9, 0xcc, 0xe0, 0x5c, 0x97,
+  0xea, 0x0b, 0x55, 0x2a, 0xaa, 0xd2, 0xcc, 0xd7, 0x1b, 0xad, 0x23, 0x84,
+  0x3a, 0x17, 0x7d, 0xc2, 0x43, 0x55, 0x59, 0xfe, 0x0d, 0xb4, 0xe3, 0xeb,
+  0xe3, 0x0f, 0x20, 0xfe, 0x3c, 0xe2, 0x5d, 0xbf, 0x7f, 0xe2, 0xda, 0x03,
+  0xc9, 0x84, 0xa6, 0x32, 0x59, 0xc8, 0xba, 0x55, 0xf2, 0x14, 0xa9, 0xbd,
+  0x78, 0x37, 0x7d, 0x6a, 0xbf, 0x46, 0xc4, 0xcb, 0x65, 0x18, 0xda, 0xb0,
+  0xb9, 0xf3, 0x49, 0xbb, 0xdd, 0xbe, 0xa5, 0xf7, 0x60, 0x33, 0x8a, 0xbf,
+  0xf3, 0x0e, 0xac, 0x5a, 0xfe, 0x96, 0x35, 0xfb, 0x72, 0x8d, 0x3e, 0xbd,
+  0x19, 0x8a, 0x47, 0xb4, 0x0f, 0xd8, 0xcf, 0x03, 0x43, 0xc7, 0x0f, 0x13,
+  0x5b, 0xa5, 0xeb, 0xb7, 0x7f, 0xaa, 0xa8, 0xdb, 0x87, 0xef, 0x22, 0xa7,
+  0x9a, 0x24, 0x23, 0x9e, 0xb8, 0x2b, 0x05, 0xe7, 0x94, 0x99, 0xed, 0xc8,
+  0xbf, 0xe6, 0xef, 0xd2, 0xe0, 0x92, 0x05, 0xf5, 0x73, 0xb3, 0x0d, 0xe2,
+  0x0d, 0xdf, 0x76, 0x22, 0xe0, 0x5f, 0xbb, 0xef, 0x80, 0xf7, 0x33, 0x77,
+  0x88, 0x6b, 0xfc, 0x6d, 0x29, 0x46, 0xc9, 0x03, 0x71, 0xc2, 0xc2, 0x9a,
+  0x25, 0xcf, 0x8e, 0x3f, 0xc5, 0xb6, 0x4a, 0xdb, 0xdc, 0x18, 0x02, 0xb7,
+  0xf1, 0x11, 0x3b, 0x95, 0xfe, 0x10, 0x9b, 0x51, 0x87, 0x2c, 0xfb, 0x78,
+  0x94, 0xca, 0x9c, 0x9d, 0x5c, 0xc7, 0xcf, 0xdb, 0xb5, 0x8a, 0x7d, 0xe5,
+  0xcc, 0x25, 0x61, 0xc3, 0x8b, 0x01, 0xfc, 0x35, 0x02, 0x20, 0x3a, 0x4c,
+  0xc5, 0x30, 0xcd, 0xe1, 0x6f, 0x66, 0xa3, 0x39, 0xef, 0x0f, 0x44, 0x96,
+  0xa2, 0x1c, 0x3e, 0xa5, 0x69, 0x49, 0x06, 0x35, 0xc1, 0x55, 0x16, 0xbb,
+  0x84, 0x20, 0x2a, 0xfa, 0x51, 0x97, 0xd4, 0x20, 0xf9, 0x62, 0x4f, 0x6a,
+  0xd9, 0xd7, 0x7e, 0x53, 0xe9, 0x16, 0xa4, 0x49, 0x45, 0xde, 0x7f, 0x5e,
+  0xbe, 0xfe, 0x86, 0x70, 0xae, 0xfc, 0xbd, 0x04, 0x40, 0x45, 0x8f, 0x53,
+  0xac, 0xde, 0x56, 0x5e, 0xaf, 0x58, 0xd7, 0xab, 0x2c, 0xad, 0x75, 0x25,
+  0xf7, 0x8e, 0xd7, 0x93, 0xd7, 0xb7, 0x92, 0x77, 0xb6, 0x36, 0x96, 0xf9,
+  0xd7, 0xd0, 0x6d, 0x2c, 0xf3, 0xff, 0x97, 0x9a, 0xff, 0x07, 0xda, 0x81,
+  0x9d, 0xd9, 0xb6, 0x66, 0x00, 0x00,
+};
+
+// Варианты одного файла идут подряд, от меньшего к большему
+static const UiAsset ui_bundle_assets[] = {
+  { "/index.html", "/ui/0f0c4be0.html", "text/html", "br", "\"0f0c4be0-br\"", 0, 4845 },
+  { "/index.html", "/ui/0f0c4be0.html", "text/html", "gzip", "\"0f0c4be0-gzip\"", 4848, 5838 },
+};
+
+static const uint8_t ui_bundle_asset_count = 2;
+
+#endif
@@ -1,12 +1,208 @@
 #include "webserver.h"
 #include <time.h>
+#include <memory>
 
- #include "index_html_gz.h"
+#include "ui_bundle.h"
 
-WebServerManager::WebServerManager(SettingsManager& settingsManager, ControlManager& controlManager)
-    : server(80), _settingsManager(settingsManager), _controlManager(controlManager) {}
+namespace {
+
+// Ответ с JSON в буфере внутри самого объекта ответа: длина известна
+// к моменту отправки, отдельного String или документа не нужно.
+template<size_t SIZE>
+class JsonBufferResponse : public AsyncAbstractResponse {
+public:
+    explicit JsonBufferResponse(int code) : _print(_content, SIZE) {
+        _code = code;
+        _contentType = "application/json";
+    }
+
+    Print& getPrint() { return _print; }
+    bool isOverflowed() const { return _print.isOverflowed(); }
+
+    void _respond(AsyncWebServerRequest *request) override {
+        _contentLength = _print.length();
+        AsyncAbstractResponse::_respond(request);
+    }
+
+    bool _sourceValid() const override { return true; }
+
+    size_t _fillBuffer(uint8_t *data, size_t len) override {
+        size_t chunk = _contentLength - _sentPosition;
+        if (chunk > len) chunk = len;
+        memcpy(data, _content + _sentPosition, chunk);
+        _sentPosition += chunk;
+        return chunk;
+    }
+
+private:
+    char _content[SIZE];
+    BufferPrint _print;
+    size_t _sentPosition = 0;
+};
+
+// Держит буфер снимка /getLiveData занятым, пока существует ответ, который его читает
+class SnapshotLease {
+public:
+    explicit SnapshotLease(uint8_t& readers) : _readers(readers) { _readers++; }
+    ~SnapshotLease() { _readers--; }
+
+private:
+    uint8_t& _readers;
+};
+
+// Файл из бандла читается кусками прямо из флеш-памяти в буфер отправки
+AsyncWebServerResponse* beginAssetResponse(AsyncWebServerRequest *request, const UiAsset& asset) {
+    const UiAsset* source = &asset;
+    AsyncWebServerResponse *response = request->beginResponse(asset.contentType, asset.length,
+        [source](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            return UiBundle::read(*source, index, buffer, maxLen);
+        });
+    if (asset.encoding[0]) {
+        response->addHeader("Content-Encoding", asset.encoding);
+    }
+    return response;
+}
+
+const char* getAcceptEncoding(AsyncWebServerRequest *request) {
+    AsyncWebHeader* header = request->getHeader("Accept-Encoding");
+    return header ? header->value().c_str() : nullptr;
+}
+
+bool statFile(const char* path, time_t& lastWrite, size_t& size) {
+    if (!SPIFFS.exists(path)) return false;
+    File file = SPIFFS.open(path, "r");
+    if (!file) return false;
+    lastWrite = file.getLastWrite();
+    size = file.size();
+    file.close();
+    return true;
+}
+
+void sendStatus(AsyncWebServerRequest *request, int code, const char* status, const char* message = nullptr) {
+    JsonBufferResponse<128> *response = new JsonBufferResponse<128>(code);
+    JsonWriter json(response->getPrint());
+    json.beginObject();
+    json.add("status", status);
+    if (message) json.add("message", message);
+    json.endObject();
+    request->send(response);
+}
+
+// Ответ, который пишется строками прямо в буфер отправки: generator(row, size)
+// кладёт в row очередную строку и возвращает её длину, 0 - конец ответа.
+// Строка, не влезшая в буфер целиком, дописывается следующим вызовом.
+template<typename Generator>
+struct RowStream {
+    Generator generator;
+    char row[96];
+    uint8_t rowLength;
+    uint8_t rowPosition;
+    bool isDone;
+
+    size_t fill(uint8_t *buffer, size_t maxLen) {
+        size_t written = 0;
+        while (written < maxLen) {
+            if (rowPosition < rowLength) {
+                size_t chunk = rowLength - rowPosition;
+                if (chunk > maxLen - written) chunk = maxLen - written;
+                memcpy(buffer + written, row + rowPosition, chunk);
+                rowPosition += chunk;
+                written += chunk;
+                continue;
+            }
+            if (isDone) break;
+
+            int length = generator(row, sizeof(row));
+            if (length <= 0) {
+                isDone = true;
+                break;
+            }
+            rowLength = (length < (int)sizeof(row)) ? length : sizeof(row) - 1;
+            rowPosition = 0;
+        }
+        return written;
+    }
+};
+
+template<typename Generator>
+AsyncWebServerResponse* beginRowResponse(AsyncWebServerRequest *request, const char* contentType, const Generator& generator) {
+    RowStream<Generator> stream = { generator, "", 0, 0, false };
+    return request->beginChunkedResponse(contentType,
+        [stream](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+            return stream.fill(buffer, maxLen);
+        });
+}
+
+}
+
+WebServerManager::WebServerManager(SettingsManager& settingsManager, ControlManager& controlManager, HistoryManager& historyManager,
+                                   RollupManager& rollupManager, EventJournal& eventJournal, TelemetryStore& telemetryStore,
+                                   TaskScheduler& scheduler)
+    : server(80), _settingsManager(settingsManager), _controlManager(controlManager), _historyManager(historyManager),
+      _rollupManager(rollupManager), _eventJournal(eventJournal), _telemetryStore(telemetryStore), _scheduler(scheduler),
+      _liveEvents("/liveEvents") {}
+
+const WebServerManager::Route WebServerManager::ROUTES[] = {
+    { "/", HTTP_GET, ROUTE_CLASS_ASSET, &WebServerManager::_handleGetIndex, nullptr, nullptr, 0 },
+    { "/ui/*", HTTP_GET, ROUTE_CLASS_ASSET, &WebServerManager::_handleGetAsset, nullptr, nullptr, 0 },
+    { "/getAllSettings", HTTP_GET, ROUTE_CLASS_API, &WebServerManager::_handleGetAllSettings, nullptr, nullptr, 0 },
+    { "/getLiveData", HTTP_GET, ROUTE_CLASS_LIVE, &WebServerManager::_handleGetLiveData, nullptr, nullptr, 0 },
+#if PROFILING_ENABLED
+    { "/getTimings", HTTP_GET, ROUTE_CLASS_API, &WebServerManager::_handleGetTimings, nullptr, nullptr, 0 },
+#endif
+    { "/getRouteStats", HTTP_GET, ROUTE_CLASS_LIVE, &WebServerManager::_handleGetRouteStats, nullptr, nullptr, 0 },
+    { "/saveSettings", HTTP_POST, ROUTE_CLASS_WRITE, &WebServerManager::_handleSaveSettings, nullptr, nullptr, 0 },
+    { "/api/settings", HTTP_PATCH, ROUTE_CLASS_WRITE, &WebServerManager::_handlePatchSettings, nullptr,
+      &WebServerManager::_handlePatchSettingsBody, SETTINGS_PATCH_BODY_SIZE },
+    { "/setPump", HTTP_GET, ROUTE_CLASS_CONTROL, &WebServerManager::_handleSetPump, nullptr, nullptr, 0 },
+    { "/resetManualMode", HTTP_GET, ROUTE_CLASS_CONTROL, &WebServerManager::_handleResetManualMode, nullptr, nullptr, 0 },
+    { "/getSonarTrace", HTTP_GET, ROUTE_CLASS_API, &WebServerManager::_handleGetSonarTrace, nullptr, nullptr, 0 },
+    { "/setSonarTrace", HTTP_GET, ROUTE_CLASS_WRITE, &WebServerManager::_handleSetSonarTrace, nullptr, nullptr, 0 },
+    { "/history", HTTP_GET, ROUTE_CLASS_API, &WebServerManager::_handleGetHistory, nullptr, nullptr, 0 },
+    { "/getRollups", HTTP_GET, ROUTE_CLASS_API, &WebServerManager::_handleGetRollups, nullptr, nullptr, 0 },
+    { "/getHistoryRange", HTTP_GET, ROUTE_CLASS_API, &WebServerManager::_handleGetHistoryRange, nullptr, nullptr, 0 },
+    { "/getEvents", HTTP_GET, ROUTE_CLASS_API, &WebServerManager::_handleGetEvents, nullptr, nullptr, 0 },
+    { "/getTelemetry", HTTP_GET, ROUTE_CLASS_API, &WebServerManager::_handleGetTelemetry, nullptr, nullptr, 0 },
+    { "/uploadFile", HTTP_POST, ROUTE_CLASS_WRITE, &WebServerManager::_handleUploadDone, &WebServerManager::_handleFileUpload, nullptr, 0 },
+};
+
+const uint8_t WebServerManager::ROUTE_COUNT = sizeof(ROUTES) / sizeof(ROUTES[0]);
+
+// Пороги допуска по классам маршрутов. Управление насосом проходит всегда;
+// тяжёлым ответам нужен запас кучи и крупный свободный блок. Самый крупный
+// блок записи - документ /saveSettings (SETTINGS_DOC_SIZE) плюс тело формы.
+const WebServerManager::RouteClassLimits WebServerManager::ROUTE_CLASS_LIMITS[ROUTE_CLASS_COUNT] = {
+    // name      maxInFlight minFreeHeap minFreeBlock retryAfterSec
+    { "control", 0,          0,          0,           0 },
+    { "live",    4,          6144,       2048,        1 },
+    { "api",     2,          10240,      4096,        2 },
+    { "write",   1,          8192,       4608,        2 },
+    { "asset",   2,          8192,       4096,        2 },
+};
+
+// Адреса, которые спрашивают не люди: проверки captive portal, иконки,
+// служебные файлы. Отвечаются кодом без тела и без файловой системы.
+const WebServerManager::KnownPath WebServerManager::KNOWN_PATHS[] = {
+    { "/generate_204", 204 },
+    { "/gen_204", 204 },
+    { "/hotspot-detect.html", 204 },
+    { "/library/test/success.html", 204 },
+    { "/connecttest.txt", 204 },
+    { "/ncsi.txt", 204 },
+    { "/success.txt", 204 },
+    { "/canonical.html", 204 },
+    { "/favicon.ico", 404 },
+    { "/apple-touch-icon.png", 404 },
+    { "/apple-touch-icon-precomposed.png", 404 },
+    { "/robots.txt", 404 },
+    { "/wpad.dat", 404 },
+};
+
+const uint8_t WebServerManager::KNOWN_PATH_COUNT = sizeof(KNOWN_PATHS) / sizeof(KNOWN_PATHS[0]);
 
 void WebServerManager::begin() {
+    static_assert(sizeof(ROUTES) / sizeof(ROUTES[0]) <= MAX_ROUTES, "Increase MAX_ROUTES");
+    static_assert(sizeof(KNOWN_PATHS) / sizeof(KNOWN_PATHS[0]) <= MAX_KNOWN_PATHS, "Increase MAX_KNOWN_PATHS");
 
    if (!_settingsManager.settings.isWifiTurnedOn) {
         Serial.println("WEB SERVER OFF, WiFi is turned off in settings.");
@@ -15,43 +211,242 @@ void WebServerManager::begin() {
 
     Serial.println("WebServer: Starting server...");
 
-    server.on("/", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        request->send(_getIndexResponse(request));
-    });
+    _resolveIndex();
+
+    // ETag /getLiveData не должен совпасть с выданным до перезагрузки
+    _liveSnapshotEtag = RANDOM_REG32;
+
+    for (uint8_t i = 0; i < ROUTE_COUNT; i++) {
+        // Запрос с телом или загрузкой уже прошёл допуск на первом куске
+        ArRequestHandlerFunction onRequest = [this, i](AsyncWebServerRequest *request) {
+            _routeHits[i]++;
+            RequestState* state = (RequestState*)request->_tempObject;
+            if (!state) {
+                if (!_admitRequest(request, ROUTES[i].routeClass)) return;
+                _trackRequest(request, ROUTES[i].routeClass);
+            } else if (!state->isAdmitted) {
+                _sendRejected(request, ROUTES[i].routeClass);
+                return;
+            }
+            (this->*ROUTES[i].handler)(request);
+        };
+        ArUploadHandlerFunction onUpload = nullptr;
+        if (ROUTES[i].upload) {
+            onUpload = [this, i](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) {
+                if (index == 0 && !request->_tempObject) _beginStream(request, ROUTES[i].routeClass, 0);
+                RequestState* state = (RequestState*)request->_tempObject;
+                if (!state || !state->isAdmitted) return;
+                (this->*ROUTES[i].upload)(request, filename, index, data, len, final);
+            };
+        }
+        ArBodyHandlerFunction onBody = nullptr;
+        if (ROUTES[i].body) {
+            onBody = [this, i](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+                if (index == 0 && !request->_tempObject) {
+                    bool isTooLarge = total > ROUTES[i].maxBodySize;
+                    RequestState* state = _beginStream(request, ROUTES[i].routeClass, isTooLarge ? 0 : total);
+                    if (state && state->isAdmitted && isTooLarge) {
+                        state->status = 413;
+                        state->message = "Body is too large";
+                    }
+                }
+                RequestState* state = (RequestState*)request->_tempObject;
+                if (!state || !state->isAdmitted || state->status != 0) return;
+                (this->*ROUTES[i].body)(request, data, len, index, total);
+            };
+        }
+        server.on(ROUTES[i].path, ROUTES[i].method, onRequest, onUpload, onBody);
+    }
 
     server.onNotFound([this](AsyncWebServerRequest *request) {
-        request->send(_getIndexResponse(request));
+        this->_handleNotFound(request);
     });
 
-    server.on("/getAllSettings", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        this->_handleGetAllSettings(request);
+    _liveEvents.onConnect([this](AsyncEventSourceClient *client) {
+        const RouteClassLimits& limits = ROUTE_CLASS_LIMITS[ROUTE_CLASS_LIVE];
+        if (_liveEvents.count() > MAX_LIVE_CLIENTS || ESP.getFreeHeap() < limits.minFreeHeap) {
+            _rejectedHits[ROUTE_CLASS_LIVE]++;
+            client->close();
+            return;
+        }
+        if (_refreshLiveSnapshot()) {
+            client->send(_liveSnapshot[_liveSnapshotFront], "live", millis());
+        }
     });
+    server.addHandler(&_liveEvents);
 
-    server.on("/getLiveData", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        this->_handleGetLiveData(request);
-    });
+    server.begin();
+    Serial.println("WebServer: Server started on port 80.");
+}
 
-    server.on("/saveSettings", HTTP_POST, [this](AsyncWebServerRequest *request) {
-        this->_handleSaveSettings(request);
-    });
+// Хватает ли кучи и мест класса для ещё одного запроса. Управление насосом
+// проходит всегда; отказ сразу учитывается в статистике.
+bool WebServerManager::_hasCapacity(RouteClass routeClass) {
+    const RouteClassLimits& limits = ROUTE_CLASS_LIMITS[routeClass];
+    if (routeClass == ROUTE_CLASS_CONTROL) return true;
 
-    server.on("/setPump", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        this->_handleSetPump(request);
-    });
+    if (_inFlight[routeClass] < limits.maxInFlight && ESP.getFreeHeap() >= limits.minFreeHeap &&
+        ESP.getMaxFreeBlockSize() >= limits.minFreeBlock) {
+        return true;
+    }
+    _rejectedHits[routeClass]++;
+    return false;
+}
+
+void WebServerManager::_sendRejected(AsyncWebServerRequest *request, RouteClass routeClass) {
+    char retryAfter[4];
+    snprintf(retryAfter, sizeof(retryAfter), "%u", ROUTE_CLASS_LIMITS[routeClass].retryAfterSec);
+    AsyncWebServerResponse *response = request->beginResponse(503);
+    response->addHeader("Retry-After", retryAfter);
+    request->send(response);
+}
 
-    server.on("/resetManualMode", HTTP_GET, [this](AsyncWebServerRequest *request) {
-        this->_handleResetManualMode(request);
+// Допуск запроса: при нехватке кучи или превышении числа одновременных
+// запросов его класса сразу 503 с Retry-After, до выделения памяти под ответ.
+bool WebServerManager::_admitRequest(AsyncWebServerRequest *request, RouteClass routeClass) {
+    if (_hasCapacity(routeClass)) return true;
+    _sendRejected(request, routeClass);
+    return false;
+}
+
+// Запрос занимает место своего класса до отключения клиента, то есть пока
+// ответ не отправлен целиком.
+void WebServerManager::_trackRequest(AsyncWebServerRequest *request, RouteClass routeClass) {
+    _inFlight[routeClass]++;
+    request->onDisconnect([this, routeClass]() {
+        _inFlight[routeClass]--;
     });
+}
 
-    server.on("/uploadFile", HTTP_POST, [](AsyncWebServerRequest *request) {
-            request->send(200);
-        },
-        [this](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) {
-            this->_handleFileUpload(request, filename, index, data, len, final);
-        });
+// Допуск запроса с телом или загрузкой на первом куске: отклонённый запрос
+// ничего не пишет во флеш и не получает буфер, а 503 отправляется один раз,
+// когда библиотека вызовет обработчик запроса. Если буфер под тело не
+// выделился, запрос тоже считается отклонённым по памяти.
+WebServerManager::RequestState* WebServerManager::_beginStream(AsyncWebServerRequest *request, RouteClass routeClass,
+                                                               size_t bodyLength) {
+    bool isAdmitted = _hasCapacity(routeClass);
+    if (!isAdmitted) bodyLength = 0;
 
-    server.begin();
-    Serial.println("WebServer: Server started on port 80.");
+    RequestState* state = (RequestState*)malloc(sizeof(RequestState) + ((bodyLength > 0) ? bodyLength + 1 : 0));
+    if (!state && bodyLength > 0) {
+        _rejectedHits[routeClass]++;
+        isAdmitted = false;
+        bodyLength = 0;
+        state = (RequestState*)malloc(sizeof(RequestState));
+    }
+    if (!state) return nullptr;
+
+    memset(state, 0, sizeof(RequestState));
+    state->isAdmitted = isAdmitted;
+    state->bodyLength = bodyLength;
+    request->_tempObject = state;
+
+    if (isAdmitted) _trackRequest(request, routeClass);
+    return state;
+}
+
+void WebServerManager::_handleGetIndex(AsyncWebServerRequest *request) {
+    request->send(_getIndexResponse(request));
+}
+
+// Единственный ответ на загрузку: итог записан обработчиком кусков в RequestState
+void WebServerManager::_handleUploadDone(AsyncWebServerRequest *request) {
+    RequestState* state = (RequestState*)request->_tempObject;
+    if (!state) {
+        request->send(400, "text/plain", "No file received");
+    } else if (state->status != 0) {
+        request->send(state->status, "text/plain", state->message);
+    } else {
+        request->send(200, "text/plain", state->message ? state->message : "OK");
+    }
+}
+
+// Страница отдаётся только переходам браузера; остальное - пустой 204/404
+void WebServerManager::_handleNotFound(AsyncWebServerRequest *request) {
+    const String& url = request->url();
+    for (uint8_t i = 0; i < KNOWN_PATH_COUNT; i++) {
+        if (url == KNOWN_PATHS[i].path) {
+            _knownPathHits[i]++;
+            request->send(KNOWN_PATHS[i].code);
+            return;
+        }
+    }
+
+    int slash = url.lastIndexOf('/');
+    int dot = url.lastIndexOf('.');
+    bool isPage = dot <= slash || url.endsWith(".html") || url.endsWith(".htm");
+
+    AsyncWebHeader* fetchMode = request->getHeader("Sec-Fetch-Mode");
+    AsyncWebHeader* accept = request->getHeader("Accept");
+    bool isNavigation = fetchMode ? fetchMode->value() == "navigate" : (accept && accept->value().indexOf("text/html") >= 0);
+
+    if (request->method() == HTTP_GET && isPage && isNavigation) {
+        _navigationHits++;
+        if (!_admitRequest(request, ROUTE_CLASS_ASSET)) return;
+        _trackRequest(request, ROUTE_CLASS_ASSET);
+        request->send(_getIndexResponse(request));
+        return;
+    }
+
+    if (isPage) {
+        _otherMissHits++;
+    } else {
+        _assetMissHits++;
+    }
+    request->send(404);
+}
+
+void WebServerManager::_handleGetRouteStats(AsyncWebServerRequest *request) {
+    AsyncResponseStream *response = request->beginResponseStream("application/json", ROUTE_STATS_RESPONSE_SIZE);
+    JsonWriter json(*response);
+    json.beginObject();
+
+    json.beginArray("routes");
+    for (uint8_t i = 0; i < ROUTE_COUNT; i++) {
+        json.beginObject();
+        json.add("path", ROUTES[i].path);
+        json.add("hits", _routeHits[i]);
+        json.endObject();
+    }
+    json.endArray();
+
+    json.beginArray("known");
+    for (uint8_t i = 0; i < KNOWN_PATH_COUNT; i++) {
+        json.beginObject();
+        json.add("path", KNOWN_PATHS[i].path);
+        json.add("status", KNOWN_PATHS[i].code);
+        json.add("hits", _knownPathHits[i]);
+        json.endObject();
+    }
+    json.endArray();
+
+    json.beginArray("classes");
+    for (uint8_t i = 0; i < ROUTE_CLASS_COUNT; i++) {
+        json.beginObject();
+        json.add("name", ROUTE_CLASS_LIMITS[i].name);
+        json.add("inFlight", _inFlight[i]);
+        json.add("rejected", _rejectedHits[i]);
+        json.endObject();
+    }
+    json.endArray();
+
+    json.add("freeHeap", ESP.getFreeHeap());
+    json.add("maxFreeBlock", ESP.getMaxFreeBlockSize());
+    json.add("navigation", _navigationHits);
+    json.add("missingAssets", _assetMissHits);
+    json.add("other", _otherMissHits);
+    json.endObject();
+
+    if (request->hasParam("reset")) {
+        memset(_routeHits, 0, sizeof(_routeHits));
+        memset(_knownPathHits, 0, sizeof(_knownPathHits));
+        memset(_rejectedHits, 0, sizeof(_rejectedHits));
+        _navigationHits = 0;
+        _assetMissHits = 0;
+        _otherMissHits = 0;
+    }
+
+    request->send(response);
 }
 
 void WebServerManager::_handleResetManualMode(AsyncWebServerRequest *request) {
@@ -59,47 +454,221 @@ void WebServerManager::_handleResetManualMode(AsyncWebServerRequest *request) {
 
     _controlManager.setManualMode(false);
 
-    request->send(200, "application/json", "{\"status\":\"success\"}");
+    sendStatus(request, 200, "success");
 }
 
 void WebServerManager::_handleGetAllSettings(AsyncWebServerRequest *request) {
     Serial.println("WebServer: Received request for /getAllSettings");
-    String jsonString = _settingsManager.serializeSettings(_settingsManager.settings);
-    request->send(200, "application/json", jsonString);
+    AsyncResponseStream *response = request->beginResponseStream("application/json", SETTINGS_RESPONSE_SIZE);
+    _settingsManager.writeSettings(*response, _settingsManager.settings);
+    request->send(response);
+}
+
+void WebServerManager::loop() {
+    if (_liveEvents.count() == 0) return;
+
+    unsigned long heartbeatMs = _settingsManager.settings.liveHeartbeatSec * 1000UL;
+    if (!_isLiveDataChanged() && millis() - _liveSentMs < heartbeatMs) return;
+
+    if (!_refreshLiveSnapshot()) return;
+
+    // Новая точка отсчёта для зоны нечувствительности - отправленное состояние
+    _rememberLiveData();
+    _liveEvents.send(_liveSnapshot[_liveSnapshotFront], "live", millis());
+}
+
+bool WebServerManager::_isLiveDataChanged() {
+    uint8_t pumpMask = 0;
+    uint8_t errorMask = 0;
+    bool isDistanceChanged = false;
+    uint16_t deadbandMm = _settingsManager.settings.liveDeadbandMm;
+
+    for (uint8_t ch = 0; ch < _controlManager.getChannelCount(); ch++) {
+        if (_controlManager.getPumpState(ch)) pumpMask |= 1 << ch;
+        if (_controlManager.isErrorState(ch)) errorMask |= 1 << ch;
+
+        uint16_t distanceMm = _controlManager.getCurrentDistance(ch);
+        uint16_t deltaMm = (distanceMm > _liveDistanceMm[ch]) ? distanceMm - _liveDistanceMm[ch] : _liveDistanceMm[ch] - distanceMm;
+        if (deltaMm > 0 && deltaMm >= deadbandMm) isDistanceChanged = true;
+    }
+
+    return isDistanceChanged || pumpMask != _livePumpMask || errorMask != _liveErrorMask ||
+           _settingsManager.settings.control.manualMode_pump != _liveManualMode;
+}
+
+void WebServerManager::_rememberLiveData() {
+    _livePumpMask = 0;
+    _liveErrorMask = 0;
+    for (uint8_t ch = 0; ch < _controlManager.getChannelCount(); ch++) {
+        _liveDistanceMm[ch] = _controlManager.getCurrentDistance(ch);
+        if (_controlManager.getPumpState(ch)) _livePumpMask |= 1 << ch;
+        if (_controlManager.isErrorState(ch)) _liveErrorMask |= 1 << ch;
+    }
+    _liveManualMode = _settingsManager.settings.control.manualMode_pump;
+    _liveSentMs = millis();
+}
+
+// Перерисовывает снимок не чаще одного раза на обновление ControlManager.
+// ETag меняется, только если текст ответа действительно другой.
+bool WebServerManager::_refreshLiveSnapshot() {
+    uint32_t stateVersion = _controlManager.getStateVersion();
+    if (_isLiveSnapshotValid && stateVersion == _liveSnapshotStateVersion) return true;
+
+    uint8_t back = _liveSnapshotFront ^ 1;
+    if (_liveSnapshotReaders[back] > 0) return _isLiveSnapshotValid;
+
+    BufferPrint print(_liveSnapshot[back], LIVE_SNAPSHOT_SIZE);
+    JsonWriter json(print);
+    _writeLiveData(json);
+    if (print.isOverflowed()) {
+        Serial.println("WebServer: Live snapshot does not fit, skipped.");
+        return _isLiveSnapshotValid;
+    }
+    size_t length = print.length();
+    _liveSnapshotStateVersion = stateVersion;
+
+    if (_isLiveSnapshotValid && length == _liveSnapshotLength[_liveSnapshotFront] &&
+        memcmp(_liveSnapshot[back], _liveSnapshot[_liveSnapshotFront], length) == 0) {
+        return true;
+    }
+
+    _liveSnapshotLength[back] = length;
+    _liveSnapshotFront = back;
+    _liveSnapshotEtag++;
+    _isLiveSnapshotValid = true;
+    return true;
 }
 
 void WebServerManager::_handleGetLiveData(AsyncWebServerRequest *request) {
-    DynamicJsonDocument doc(256);
-    doc["currentDistance"] = _controlManager.getCurrentDistance();
-    doc["pumpState"] = _controlManager.getPumpState();
-    doc["isErrorState"] = _controlManager.isErrorState();
-    doc["manualMode_pump"] = _settingsManager.settings.control.manualMode_pump;
+    if (!_refreshLiveSnapshot()) {
+        sendStatus(request, 503, "error", "Live data is not ready");
+        return;
+    }
+
+    char etag[12];
+    snprintf(etag, sizeof(etag), "\"%08x\"", (unsigned)_liveSnapshotEtag);
+
+    AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+    if (ifNoneMatch && ifNoneMatch->value() == etag) {
+        AsyncWebServerResponse *response = request->beginResponse(304);
+        response->addHeader("ETag", etag);
+        request->send(response);
+        return;
+    }
+
+    // Ответ читает буфер по ссылке, поэтому буфер заблокирован, пока жив ответ:
+    // аренда уничтожается вместе с функцией заполнения
+    uint8_t front = _liveSnapshotFront;
+    std::shared_ptr<SnapshotLease> lease = std::make_shared<SnapshotLease>(_liveSnapshotReaders[front]);
+
+    size_t length = _liveSnapshotLength[front];
+    AsyncWebServerResponse *response = request->beginResponse("application/json", length,
+        [this, front, length, lease](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            size_t chunk = length - index;
+            if (chunk > maxLen) chunk = maxLen;
+            memcpy(buffer, _liveSnapshot[front] + index, chunk);
+            return chunk;
+        });
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
+void WebServerManager::_writeLiveData(JsonWriter& json) {
+    json.beginObject();
+    json.addTenths("currentDistance", _controlManager.getCurrentDistance());
+    json.addTenths("levelRate", _controlManager.getLevelRate());
+    json.add("pumpState", _controlManager.getPumpState());
+    json.add("isErrorState", _controlManager.isErrorState());
+    json.add("manualMode_pump", _settingsManager.settings.control.manualMode_pump);
+
+    json.beginArray("channels");
+    for (uint8_t ch = 0; ch < _controlManager.getChannelCount(); ch++) {
+        json.beginObject();
+        json.addTenths("currentDistance", _controlManager.getCurrentDistance(ch));
+        json.addTenths("levelRate", _controlManager.getLevelRate(ch));
+        json.add("pumpState", _controlManager.getPumpState(ch));
+        json.add("isErrorState", _controlManager.isErrorState(ch));
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+}
+
+#if PROFILING_ENABLED
+void WebServerManager::_handleGetTimings(AsyncWebServerRequest *request) {
+    JsonBufferResponse<TIMINGS_RESPONSE_SIZE> *response = new JsonBufferResponse<TIMINGS_RESPONSE_SIZE>(200);
+    JsonWriter json(response->getPrint());
+    json.beginObject();
+    json.beginObject("sections");
+    for (uint8_t i = 0; i < PROFILE_SECTION_COUNT; i++) {
+        ProfileSection section = (ProfileSection)i;
+        const LatencyHistogram& histogram = Profiler::getHistogram(section);
+
+        json.beginObject(Profiler::getSectionName(section));
+        json.add("count", histogram.getCount());
+        json.add("p50", histogram.getPercentile(50));
+        json.add("p99", histogram.getPercentile(99));
+        json.add("max", histogram.getMax());
+        json.endObject();
+    }
+    json.endObject();
+
+    // Задачи планировщика: запуски, пропуски срока, худшие время и опоздание
+    json.beginArray("tasks");
+    for (uint8_t i = 0; i < _scheduler.getTaskCount(); i++) {
+        const SchedulerTask& task = _scheduler.getTask(i);
+        json.beginObject();
+        json.add("name", task.name);
+        json.add("active", task.isActive);
+        json.add("periodUs", task.periodUs);
+        json.add("deadlineUs", task.deadlineUs);
+        json.add("runs", task.runs);
+        json.add("overruns", task.overruns);
+        json.add("lastExecUs", task.lastExecUs);
+        json.add("worstExecUs", task.worstExecUs);
+        json.add("worstLatenessUs", task.worstLatenessUs);
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+
+    if (request->hasParam("reset")) {
+        Profiler::reset();
+        _scheduler.resetStats();
+    }
 
-    String response;
-    serializeJson(doc, response);
-    request->send(200, "application/json", response);
+    if (response->isOverflowed()) {
+        delete response;
+        sendStatus(request, 500, "error", "Timings do not fit the response buffer");
+        return;
+    }
+    request->send(response);
 }
+#endif
 
 void WebServerManager::_handleSaveSettings(AsyncWebServerRequest *request) {
     Serial.println("\n--- WebServer: Received POST to /saveSettings ---");
 
     if (!request->hasParam("dataSettings", true)) {
-        request->send(400, "application/json", "{\"status\":\"error\", \"message\":\"Missing 'dataSettings' parameter\"}");
+        sendStatus(request, 400, "error", "Missing 'dataSettings' parameter");
         return;
     }
 
-    String body = request->getParam("dataSettings", true)->value();
+    const String& body = request->getParam("dataSettings", true)->value();
     if (body.isEmpty()) {
-        request->send(400, "application/json", "{\"status\":\"error\", \"message\":\"Empty 'dataSettings' parameter\"}");
+        sendStatus(request, 400, "error", "Empty 'dataSettings' parameter");
         return;
     }
 
-    StaticJsonDocument<4096> newDoc;
+    // В куче, а не на стеке: допуск класса "write" уже проверил свободный блок
+    DynamicJsonDocument newDoc(SETTINGS_DOC_SIZE);
     DeserializationError error = deserializeJson(newDoc, body);
 
     if (error) {
-        String errorMsg = "Failed to parse JSON: " + String(error.c_str());
-        request->send(400, "application/json", "{\"status\":\"error\", \"message\":\"" + errorMsg + "\"}");
+        char message[64];
+        snprintf(message, sizeof(message), "Failed to parse JSON: %s", error.c_str());
+        sendStatus(request, 400, "error", message);
         return;
     }
 
@@ -110,22 +679,22 @@ void WebServerManager::_handleSaveSettings(AsyncWebServerRequest *request) {
     if (_settingsManager.settings.isWifiTurnedOn != newDoc["isWifiTurnedOn"].as<bool>()) needsReboot = true;
     if (_settingsManager.settings.isAP != newDoc["isAP"].as<bool>()) needsReboot = true;
 
-    if (_settingsManager.settings.ssidAP != newDoc["ssidAP"].as<String>()) needsReboot = true;
-    if (_settingsManager.settings.passwordAP != newDoc["passwordAP"].as<String>()) needsReboot = true;
+    if (_settingsManager.settings.ssidAP != (newDoc["ssidAP"] | "")) needsReboot = true;
+    if (_settingsManager.settings.passwordAP != (newDoc["passwordAP"] | "")) needsReboot = true;
 
-    if (_settingsManager.settings.mDNS != newDoc["mDNS"].as<String>()) needsReboot = true;
+    if (_settingsManager.settings.mDNS != (newDoc["mDNS"] | "")) needsReboot = true;
 
 if (newDoc.containsKey("networkSettings") && newDoc["networkSettings"].is<JsonArray>() && newDoc["networkSettings"].size() > 0) {
     JsonObject newNet = newDoc["networkSettings"][0];
     NetworkSetting& currentNet = _settingsManager.settings.networkSettings[0];
 
     IPAddress newIP, newGateway, newSubnet;
-    newIP.fromString(newNet["staticIP"].as<String>());
-    newGateway.fromString(newNet["staticGateway"].as<String>());
-    newSubnet.fromString(newNet["staticSubnet"].as<String>());
+    newIP.fromString(newNet["staticIP"] | "");
+    newGateway.fromString(newNet["staticGateway"] | "");
+    newSubnet.fromString(newNet["staticSubnet"] | "");
 
-    if (currentNet.ssid != newNet["ssid"].as<String>()) needsReboot = true;
-    if (currentNet.password != newNet["password"].as<String>()) needsReboot = true;
+    if (currentNet.ssid != (newNet["ssid"] | "")) needsReboot = true;
+    if (currentNet.password != (newNet["password"] | "")) needsReboot = true;
     if (currentNet.useStaticIP != newNet["useStaticIP"].as<bool>()) needsReboot = true;
 
     if (currentNet.staticIP != newIP) needsReboot = true;
@@ -140,87 +709,556 @@ if (newDoc.containsKey("networkSettings") && newDoc["networkSettings"].is<JsonAr
         _settingsManager.settings.isSaveRequested = true;
         _settingsManager.settings.isRebootRequested = needsReboot;
 
-        String responseMessage = needsReboot ? "Settings received. Saving and rebooting..." : "Settings received. Saving...";
-        request->send(200, "application/json", "{\"status\":\"success\", \"message\":\"" + responseMessage + "\"}");
+        sendStatus(request, 200, "success", needsReboot ? "Settings received. Saving and rebooting..." : "Settings received. Saving...");
 
         Serial.printf("Flags set: Save=%d, Reboot=%d. Waiting for main loop.\n", _settingsManager.settings.isSaveRequested, _settingsManager.settings.isRebootRequested);
 
     } else {
-        request->send(500, "application/json", "{\"status\":\"error\", \"message\":\"Failed to apply settings\"}");
+        sendStatus(request, 500, "error", "Failed to apply settings");
     }
     Serial.println("--- End of /saveSettings request ---\n");
 }
 
+// Тело PATCH приходит кусками до вызова обработчика запроса и копируется
+// в буфер RequestState, выделенный по Content-Length при допуске.
+void WebServerManager::_handlePatchSettingsBody(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                                                size_t index, size_t total) {
+    RequestState* state = (RequestState*)request->_tempObject;
+    if (state->bodyLength != total || index + len > total) return;
+
+    char* body = state->body();
+    memcpy(body + index, data, len);
+    if (index + len == total) body[total] = '\0';
+}
+
+void WebServerManager::_handlePatchSettings(AsyncWebServerRequest *request) {
+    if (!request->contentType().startsWith("application/json")) {
+        sendStatus(request, 415, "error", "Expected application/json");
+        return;
+    }
+
+    // Причину отказа (слишком большое тело) записывает обработчик кусков
+    RequestState* state = (RequestState*)request->_tempObject;
+    if (state && state->status != 0) {
+        sendStatus(request, state->status, "error", state->message);
+        return;
+    }
+    if (!state || state->bodyLength == 0) {
+        if (request->contentLength() > 0) {
+            // Тело было, но состояние под него не выделилось
+            _rejectedHits[ROUTE_CLASS_WRITE]++;
+            _sendRejected(request, ROUTE_CLASS_WRITE);
+        } else if (request->getHeader("Transfer-Encoding")) {
+            sendStatus(request, 411, "error", "Content-Length required");
+        } else {
+            sendStatus(request, 400, "error", "Empty body");
+        }
+        return;
+    }
+    char* body = state->body();
+
+    // Разбор на месте: строки документа указывают в буфер тела, а фильтр
+    // отбрасывает ключи, которых нет среди настроек
+    DynamicJsonDocument filter(SETTINGS_PATCH_FILTER_SIZE);
+    _settingsManager.fillPatchFilter(filter);
+    DynamicJsonDocument patch(SETTINGS_PATCH_DOC_SIZE);
+    DeserializationError error = deserializeJson(patch, body, DeserializationOption::Filter(filter));
+
+    if (error || !patch.is<JsonObject>()) {
+        char message[64];
+        snprintf(message, sizeof(message), "Failed to parse JSON: %s", error ? error.c_str() : "not an object");
+        sendStatus(request, 400, "error", message);
+        return;
+    }
+
+    // Патч применяется к копии: при ошибке в любом поле не меняется ничего
+    DeviceSettings patched = _settingsManager.settings;
+    SettingsPatchResult result;
+
+    JsonBufferResponse<SETTINGS_PATCH_RESPONSE_SIZE> *response = new JsonBufferResponse<SETTINGS_PATCH_RESPONSE_SIZE>(200);
+    JsonWriter json(response->getPrint());
+    json.beginObject();
+    json.add("status", "success");
+    json.beginArray("changed");
+    bool isPatched = _settingsManager.patchSettings(patch.as<JsonObjectConst>(), patched, json, result);
+    json.endArray();
+    json.add("restartRequired", result.needsReboot);
+    json.endObject();
+
+    if (!isPatched || response->isOverflowed()) {
+        delete response;
+        char message[64];
+        snprintf(message, sizeof(message), "Invalid value: %s", result.invalidField ? result.invalidField : "too many fields");
+        sendStatus(request, 400, "error", message);
+        return;
+    }
+
+    if (result.changedCount > 0) {
+        DeviceSettings& settings = _settingsManager.settings;
+        bool isRebootPending = settings.isRebootRequested;
+        settings = patched;
+        settings.isSaveRequested = true;
+        settings.isRebootRequested = isRebootPending || result.needsReboot;
+    }
+
+    Serial.printf("WebServer: Settings patch changed %u field(s), reboot=%d.\n", result.changedCount, result.needsReboot);
+    request->send(response);
+}
+
 void WebServerManager::_handleSetPump(AsyncWebServerRequest *request) {
     if (request->hasParam("state")) {
-        String state = request->getParam("state")->value();
+        const String& state = request->getParam("state")->value();
+
+        uint8_t channel = 0;
+        if (request->hasParam("channel")) {
+            long value = request->getParam("channel")->value().toInt();
+            if (value < 0 || value >= _controlManager.getChannelCount()) {
+                sendStatus(request, 400, "error", "Invalid channel");
+                return;
+            }
+            channel = value;
+        }
+
         _controlManager.setManualMode(true);
         if (state == "on") {
-            _controlManager.setPumpState(true);
+            _controlManager.setPumpState(true, channel);
         } else if (state == "off") {
-            _controlManager.setPumpState(false);
+            _controlManager.setPumpState(false, channel);
 
         } else {
-            request->send(400, "application/json", "{\"status\":\"error\", \"message\":\"Invalid state value\"}");
+            sendStatus(request, 400, "error", "Invalid state value");
             return;
         }
-        request->send(200, "application/json", "{\"status\":\"success\"}");
+        sendStatus(request, 200, "success");
     } else {
-        request->send(400, "application/json", "{\"status\":\"error\", \"message\":\"Missing 'state' parameter\"}");
+        sendStatus(request, 400, "error", "Missing 'state' parameter");
     }
 }
 
-AsyncWebServerResponse* WebServerManager::_getIndexResponse(AsyncWebServerRequest *request) {
-    bool hasHtml = SPIFFS.exists("/index.html");
-    bool hasGz = SPIFFS.exists("/index.html.gz");
-    time_t htmlTime = 0, gzTime = 0;
-    time_t now = time(nullptr);
-
-    if (hasHtml) {
-        File htmlFile = SPIFFS.open("/index.html", "r");
-        if (htmlFile) {
-            htmlTime = htmlFile.getLastWrite();
-            htmlFile.close();
+// Выгружаются записи, которые были в кольце в момент запроса: номера
+// фиксируются сразу, а новые отсчёты, пришедшие во время выгрузки, в файл
+// не попадают. Записи отдаются только целиком. Если запись успели
+// вытеснить, поток обрывается и файл просто короче.
+void WebServerManager::_handleGetSonarTrace(AsyncWebServerRequest *request) {
+    SonarTraceRecorder& recorder = _controlManager.getTraceRecorder();
+    uint32_t endSequence = recorder.getTotalRecorded();
+    uint32_t firstSequence = endSequence - recorder.getCount();
+
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/octet-stream",
+        [&recorder, firstSequence, endSequence](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+            SonarTraceHeader header;
+            SonarTraceRecorder::fillHeader(header);
+
+            size_t written = 0;
+            if (index < sizeof(header)) {
+                written = sizeof(header) - index;
+                if (written > maxLen) written = maxLen;
+                memcpy(buffer, (const uint8_t*)&header + index, written);
+                if (index + written < sizeof(header)) return written;
+            }
+
+            uint32_t sequence = firstSequence + (index + written - sizeof(header)) / sizeof(SonarTraceRecord);
+            SonarTraceRecord record;
+            while (sequence < endSequence && maxLen - written >= sizeof(record)) {
+                if (!recorder.getRecordBySequence(sequence, record)) {
+                    Serial.println("WebServer: Sonar trace overwritten during download, truncated.");
+                    break;
+                }
+                memcpy(buffer + written, &record, sizeof(record));
+                written += sizeof(record);
+                sequence++;
+            }
+            return written;
+        });
+    response->addHeader("Content-Disposition", "attachment; filename=\"sonar_trace.bin\"");
+    request->send(response);
+}
+
+void WebServerManager::_handleGetHistory(AsyncWebServerRequest *request) {
+    // Размер заранее неизвестен (последний блок ещё растёт), поэтому ответ
+    // chunked; данные копируются из кольца прямо в буфер отправки.
+    HistoryManager& history = _historyManager;
+    HistoryCursor cursor;
+    history.openCursor(cursor);
+
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/octet-stream",
+        [&history, cursor](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+            return history.read(cursor, buffer, maxLen);
+        });
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+void WebServerManager::_handleGetRollups(AsyncWebServerRequest *request) {
+    RollupManager& rollups = _rollupManager;
+    uint32_t now = rollups.getUptimeSec();
+
+    uint32_t to = request->hasParam("to") ? strtoul(request->getParam("to")->value().c_str(), nullptr, 10) : now;
+    uint32_t from = request->hasParam("from") ? strtoul(request->getParam("from")->value().c_str(), nullptr, 10) : (now > 3600 ? now - 3600 : 0);
+    long maxPoints = request->hasParam("maxPoints") ? request->getParam("maxPoints")->value().toInt() : 500;
+    if (to > now) to = now;
+    if (from > to || maxPoints < 1 || maxPoints > 2000) {
+        sendStatus(request, 400, "error", "Invalid range");
+        return;
+    }
+
+    uint8_t level = rollups.selectLevel(from, to, maxPoints);
+    uint32_t resolution = rollups.getResolution(level);
+
+    // Точки [начало, min, max, avg, секунд насоса, включений], расстояния в мм
+    uint32_t next = from - from % resolution;
+    uint8_t stage = 0;
+    AsyncWebServerResponse *response = beginRowResponse(request, "application/json",
+        [&rollups, level, resolution, from, to, now, next, stage](char* row, size_t size) mutable -> int {
+            if (stage == 0) {
+                stage = 1;
+                return snprintf(row, size, "{\"resolution\":%lu,\"from\":%lu,\"to\":%lu,\"now\":%lu,\"points\":[",
+                                (unsigned long)resolution, (unsigned long)from, (unsigned long)to, (unsigned long)now);
+            }
+
+            RollupBucket bucket;
+            while (stage != 3 && next <= to) {
+                uint32_t start = next;
+                next += resolution;
+                if (!rollups.getBucket(level, start, bucket)) continue;
+
+                const char* separator = (stage == 1) ? "" : ",";
+                stage = 2;
+                if (bucket.count == 0) {
+                    return snprintf(row, size, "%s[%lu,null,null,null,%u,%u]",
+                                    separator, (unsigned long)start, bucket.pumpOnSecs, bucket.pumpStarts);
+                }
+                return snprintf(row, size, "%s[%lu,%u,%u,%lu,%u,%u]",
+                                separator, (unsigned long)start, bucket.minMm, bucket.maxMm,
+                                (unsigned long)(bucket.sum / bucket.count), bucket.pumpOnSecs, bucket.pumpStarts);
+            }
+
+            if (stage == 3) return 0;
+            stage = 3;
+            return snprintf(row, size, "]}");
+        });
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+void WebServerManager::_handleGetHistoryRange(AsyncWebServerRequest *request) {
+    uint32_t now = _historyManager.getUptimeSec();
+
+    uint32_t to = request->hasParam("to") ? strtoul(request->getParam("to")->value().c_str(), nullptr, 10) : now;
+    uint32_t from = request->hasParam("from") ? strtoul(request->getParam("from")->value().c_str(), nullptr, 10) : _historyManager.getOldestSec();
+    long maxPoints = request->hasParam("maxPoints") ? request->getParam("maxPoints")->value().toInt() : 300;
+    if (from > to || maxPoints < 2 || maxPoints > 2000) {
+        sendStatus(request, 400, "error", "Invalid range");
+        return;
+    }
+
+    // Точки [секунда, мм, насос] считаются по одной прямо при отправке,
+    // поэтому память ответа не зависит от диапазона
+    HistoryDownsampler downsampler(_historyManager, from, to, maxPoints);
+    uint8_t stage = 0;
+    AsyncWebServerResponse *response = beginRowResponse(request, "application/json",
+        [downsampler, now, stage](char* row, size_t size) mutable -> int {
+            if (stage == 0) {
+                stage = 1;
+                return snprintf(row, size, "{\"from\":%lu,\"to\":%lu,\"now\":%lu,\"points\":[",
+                                (unsigned long)downsampler.getFromSec(), (unsigned long)downsampler.getToSec(),
+                                (unsigned long)now);
+            }
+
+            HistoryPoint point;
+            if (stage != 3 && downsampler.next(point)) {
+                const char* separator = (stage == 1) ? "" : ",";
+                stage = 2;
+                return snprintf(row, size, "%s[%lu,%u,%u]", separator,
+                                (unsigned long)point.sec, point.distanceMm, point.isPumpOn ? 1 : 0);
+            }
+
+            if (stage == 3) return 0;
+            stage = 3;
+            return snprintf(row, size, "]}");
+        });
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+void WebServerManager::_handleGetEvents(AsyncWebServerRequest *request) {
+    static const size_t MAX_PAGE = 50;
+
+    uint32_t since = request->hasParam("since") ? strtoul(request->getParam("since")->value().c_str(), nullptr, 10) : 0;
+    long limit = request->hasParam("limit") ? request->getParam("limit")->value().toInt() : MAX_PAGE;
+    if (limit < 1 || limit > (long)MAX_PAGE) {
+        sendStatus(request, 400, "error", "Invalid limit");
+        return;
+    }
+
+    // Страница копируется сразу: к моменту отправки кольцо может уйти вперёд.
+    // Клиент передаёт next следующим запросом как since. Страница одна на
+    // ответ и лежит в куче, а не на стеке обработчика и не в копии лямбды.
+    struct EventPage {
+        EventRecord records[MAX_PAGE];
+        uint8_t count;
+        uint8_t position;
+        uint8_t stage;
+        uint32_t next;
+        uint32_t lastSeq;
+    };
+    std::shared_ptr<EventPage> page = std::make_shared<EventPage>();
+    page->count = _eventJournal.read(since, page->records, limit);
+    page->position = 0;
+    page->stage = 0;
+    page->next = page->count ? page->records[page->count - 1].seq : since;
+    page->lastSeq = _eventJournal.getLastSeq();
+
+    AsyncWebServerResponse *response = beginRowResponse(request, "application/json",
+        [page](char* row, size_t size) -> int {
+            if (page->stage == 0) {
+                page->stage = 1;
+                return snprintf(row, size, "{\"lastSeq\":%lu,\"events\":[", (unsigned long)page->lastSeq);
+            }
+
+            if (page->position < page->count) {
+                const EventRecord& rec = page->records[page->position];
+                return snprintf(row, size, "%s{\"seq\":%lu,\"ts\":%lu,\"type\":\"%s\",\"reason\":\"%s\",\"channel\":%u,\"distanceMm\":%u}",
+                                page->position++ ? "," : "", (unsigned long)rec.seq, (unsigned long)rec.timestamp,
+                                ControlManager::getEventName(rec.type), ControlManager::getReasonName(rec.reason),
+                                rec.channel, rec.distanceMm);
+            }
+
+            if (page->stage == 2) return 0;
+            page->stage = 2;
+            return snprintf(row, size, "],\"next\":%lu,\"hasMore\":%s}",
+                            (unsigned long)page->next, page->next < page->lastSeq ? "true" : "false");
+        });
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+void WebServerManager::_handleGetTelemetry(AsyncWebServerRequest *request) {
+    static const size_t MAX_PAGE = 60;
+
+    uint32_t now = _telemetryStore.getTime();
+    uint32_t to = request->hasParam("to") ? strtoul(request->getParam("to")->value().c_str(), nullptr, 10) : now;
+    uint32_t from = request->hasParam("from") ? strtoul(request->getParam("from")->value().c_str(), nullptr, 10) : (now > 3600 ? now - 3600 : 0);
+    long channel = request->hasParam("channel") ? request->getParam("channel")->value().toInt() : 0;
+    long limit = request->hasParam("limit") ? request->getParam("limit")->value().toInt() : MAX_PAGE;
+    if (to > now) to = now;
+    if (from > to || channel < 0 || channel >= CONTROL_MAX_CHANNELS) {
+        sendStatus(request, 400, "error", "Invalid range");
+        return;
+    }
+    if (limit < 1 || limit > (long)MAX_PAGE) {
+        sendStatus(request, 400, "error", "Invalid limit");
+        return;
+    }
+
+    // Страница читается с флеша сразу, как в /getEvents, и лежит в куче одна
+    // на ответ. Канал пишется раз в 10 с (telemetryTask), метки в секундах
+    // не повторяются, поэтому клиент продолжает с from=next.
+    struct TelemetryPage {
+        TelemetryRecord records[MAX_PAGE];
+        uint8_t count;
+        uint8_t limit;
+        uint8_t channel;
+        uint8_t position;
+        uint8_t stage;
+    };
+    std::shared_ptr<TelemetryPage> page = std::make_shared<TelemetryPage>();
+    page->count = 0;
+    page->limit = limit;
+    page->channel = channel;
+    page->position = 0;
+    page->stage = 0;
+    _telemetryStore.query(from, to, [](const TelemetryRecord& record, void* context) -> bool {
+        TelemetryPage& page = *(TelemetryPage*)context;
+        if (record.channel != page.channel) return true;
+        page.records[page.count++] = record;
+        return page.count < page.limit;
+    }, page.get());
+
+    bool hasMore = page->count == page->limit && page->records[page->count - 1].timestamp < to;
+    uint32_t next = page->count ? page->records[page->count - 1].timestamp + 1 : to + 1;
+
+    // Записи [секунда, мм, флаги]; флаги - TELEMETRY_FLAG_*
+    AsyncWebServerResponse *response = beginRowResponse(request, "application/json",
+        [page, now, hasMore, next](char* row, size_t size) -> int {
+            if (page->stage == 0) {
+                page->stage = 1;
+                return snprintf(row, size, "{\"now\":%lu,\"channel\":%u,\"records\":[", (unsigned long)now, page->channel);
+            }
+
+            if (page->position < page->count) {
+                const TelemetryRecord& rec = page->records[page->position];
+                return snprintf(row, size, "%s[%lu,%u,%u]", page->position++ ? "," : "",
+                                (unsigned long)rec.timestamp, rec.distanceMm, rec.flags);
+            }
+
+            if (page->stage == 2) return 0;
+            page->stage = 2;
+            return snprintf(row, size, "],\"next\":%lu,\"hasMore\":%s}", (unsigned long)next, hasMore ? "true" : "false");
+        });
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+void WebServerManager::_handleSetSonarTrace(AsyncWebServerRequest *request) {
+    if (!request->hasParam("flash")) {
+        sendStatus(request, 400, "error", "Missing 'flash' parameter");
+        return;
+    }
+
+    SonarTraceRecorder& recorder = _controlManager.getTraceRecorder();
+    const String& flash = request->getParam("flash")->value();
+    if (flash == "on") {
+        if (!recorder.startFlashSpill()) {
+            sendStatus(request, 500, "error", "Failed to open trace file");
+            return;
         }
+    } else if (flash == "off") {
+        recorder.stopFlashSpill();
+    } else {
+        sendStatus(request, 400, "error", "Invalid flash value");
+        return;
+    }
+    sendStatus(request, 200, "success");
+}
+
+// Выбор вариантов страницы из SPIFFS, их ETag (FNV-1a по содержимому) и дата
+// изменения. Выполняется при старте и после загрузки файла, а не на каждый запрос.
+// Сжатые варианты не старше index.html имеют приоритет над ним, как и раньше.
+void WebServerManager::_resolveIndex() {
+    static const char* const COMPRESSED_PATHS[] = { "/index.html.gz", "/index.html.br" };
+    static const char* const COMPRESSED_ENCODINGS[] = { "gzip", "br" };
+
+    time_t htmlTime = 0, lastWrite = 0;
+    size_t htmlSize = 0;
+    bool hasHtml = statFile("/index.html", htmlTime, htmlSize);
+
+    _indexVariantCount = 0;
+    for (uint8_t i = 0; i < 2; i++) {
+        time_t writeTime = 0;
+        size_t size = 0;
+        if (!statFile(COMPRESSED_PATHS[i], writeTime, size)) continue;
+        if (hasHtml && writeTime < htmlTime) continue;
+
+        IndexVariant& variant = _indexVariants[_indexVariantCount++];
+        variant.path = COMPRESSED_PATHS[i];
+        variant.encoding = COMPRESSED_ENCODINGS[i];
+        variant.size = size;
+        if (writeTime > lastWrite) lastWrite = writeTime;
+    }
+    if (_indexVariantCount == 0 && hasHtml) {
+        IndexVariant& variant = _indexVariants[_indexVariantCount++];
+        variant.path = "/index.html";
+        variant.encoding = "";
+        variant.size = htmlSize;
+        lastWrite = htmlTime;
     }
-    if (hasGz) {
-        File gzFile = SPIFFS.open("/index.html.gz", "r");
-        if (gzFile) {
-            gzTime = gzFile.getLastWrite();
-            gzFile.close();
+
+    // От меньшего к большему: клиенту отдаётся первый разрешённый
+    if (_indexVariantCount == 2 && _indexVariants[1].size < _indexVariants[0].size) {
+        IndexVariant smaller = _indexVariants[1];
+        _indexVariants[1] = _indexVariants[0];
+        _indexVariants[0] = smaller;
+    }
+
+    for (uint8_t i = 0; i < _indexVariantCount; i++) {
+        IndexVariant& variant = _indexVariants[i];
+        uint32_t hash = 2166136261UL;
+        uint8_t buffer[256];
+        File file = SPIFFS.open(variant.path, "r");
+        size_t length;
+        while (file && (length = file.read(buffer, sizeof(buffer))) > 0) {
+            for (size_t j = 0; j < length; j++) {
+                hash = (hash ^ buffer[j]) * 16777619UL;
+            }
         }
+        file.close();
+        snprintf(variant.etag, sizeof(variant.etag), "\"%08x\"", (unsigned)hash);
+
+        Serial.printf("[WebServer] Serving: %s (%u bytes), ETag: %s\n", variant.path, (unsigned)variant.size, variant.etag);
     }
 
-    AsyncWebServerResponse *response = nullptr;
-    String selectedFile = "";
-    String reason = "";
+    // Без синхронизации времени при записи getLastWrite() даёт 0 - тогда только ETag
+    _indexLastModified[0] = '\0';
+    if (lastWrite > 0) {
+        strlcpy(_indexLastModified, _getHTTPDate(lastWrite).c_str(), sizeof(_indexLastModified));
+    }
 
-    if (hasHtml && (!hasGz || htmlTime > gzTime)) {
-        response = request->beginResponse(SPIFFS, "/index.html", "text/html");
-        selectedFile = "/index.html";
-        reason = (!hasGz) ? "GZ file not exists" : "HTML is newer";
-    } else if (hasGz) {
-        response = request->beginResponse(SPIFFS, "/index.html.gz", "text/html");
-        response->addHeader("Content-Encoding", "gzip");
-        selectedFile = "/index.html.gz";
-        reason = (!hasHtml) ? "HTML file not exists" : "GZ is newer or equal";
-    } else {
+    if (_indexVariantCount == 0) {
+        const UiAsset* asset = UiBundle::find("/index.html", nullptr);
+        Serial.printf("[WebServer] Serving: %s, Reason: No files in SPIFFS\n", asset ? asset->hashedPath : "NONE");
+    }
+}
+
+const WebServerManager::IndexVariant* WebServerManager::_selectIndexVariant(const char* acceptEncoding) const {
+    const IndexVariant* fallback = nullptr;
+    for (uint8_t i = 0; i < _indexVariantCount; i++) {
+        const IndexVariant& variant = _indexVariants[i];
+        if (UiBundle::isEncodingAccepted(acceptEncoding, variant.encoding)) return &variant;
+        if (!fallback || strcmp(variant.encoding, "gzip") == 0) fallback = &variant;
+    }
+    return fallback;
+}
+
+bool WebServerManager::_isIndexNotModified(AsyncWebServerRequest *request, const char* etag) {
+    AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+    if (ifNoneMatch) {
+        return ifNoneMatch->value() == etag;
+    }
+
+    AsyncWebHeader* ifModifiedSince = request->getHeader("If-Modified-Since");
+    return ifModifiedSince && _indexLastModified[0] && ifModifiedSince->value() == _indexLastModified;
+}
 
-        Serial.println("[WebServer] No files in SPIFFS, using embedded version.");
-        response = request->beginResponse_P(200, "text/html", index_html_gz, index_html_gz_len);
-        response->addHeader("Content-Encoding", "gzip");
-        selectedFile = "EMBEDDED";
-        reason = "No files in SPIFFS";
+// Неизменяемые адреса из бандла: содержимое по адресу не меняется никогда
+void WebServerManager::_handleGetAsset(AsyncWebServerRequest *request) {
+    const UiAsset* asset = UiBundle::find(request->url().c_str(), getAcceptEncoding(request));
+    if (!asset || request->url() != asset->hashedPath) {
+        request->send(404);
+        return;
     }
 
-    Serial.printf("[WebServer] Serving: %s, Reason: %s\n", selectedFile.c_str(), reason.c_str());
+    AsyncWebServerResponse *response;
+    AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+    if (ifNoneMatch && ifNoneMatch->value() == asset->etag) {
+        response = request->beginResponse(304);
+    } else {
+        response = beginAssetResponse(request, *asset);
+    }
+    response->addHeader("ETag", asset->etag);
+    response->addHeader("Cache-Control", "public, max-age=31536000, immutable");
+    response->addHeader("Vary", "Accept-Encoding");
+    request->send(response);
+}
+
+AsyncWebServerResponse* WebServerManager::_getIndexResponse(AsyncWebServerRequest *request) {
+    const char* acceptEncoding = getAcceptEncoding(request);
+    const IndexVariant* variant = _selectIndexVariant(acceptEncoding);
+    const UiAsset* asset = variant ? nullptr : UiBundle::find("/index.html", acceptEncoding);
+    if (!variant && !asset) {
+        return request->beginResponse(404, "text/plain", "UI is not installed");
+    }
+    const char* etag = variant ? variant->etag : asset->etag;
 
-    if (response) {
-        response->addHeader("Cache-Control", "no-store, no-cache, must-revalidate, max-age=0");
-        response->addHeader("Pragma", "no-cache");
-        response->addHeader("Expires", "0");
+    AsyncWebServerResponse *response;
+    if (_isIndexNotModified(request, etag)) {
+        response = request->beginResponse(304);
+    } else if (variant) {
+        response = request->beginResponse(SPIFFS, variant->path, "text/html");
+        if (variant->encoding[0]) {
+            response->addHeader("Content-Encoding", variant->encoding);
+        }
+    } else {
+        response = beginAssetResponse(request, *asset);
     }
 
+    // Браузер хранит страницу, но перепроверяет её условным запросом
+    response->addHeader("ETag", etag);
+    if (variant && _indexLastModified[0]) {
+        response->addHeader("Last-Modified", _indexLastModified);
+    }
+    response->addHeader("Cache-Control", "no-cache");
+    response->addHeader("Vary", "Accept-Encoding");
     return response;
 }
 
@@ -233,15 +1271,16 @@ String WebServerManager::_getHTTPDate(time_t timestamp) {
 
 void WebServerManager::_handleFileUpload(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) {
     static bool isFirmwareUpdate = false;
-    static bool updateFailed = false;
     static size_t totalSize = 0;
 
+    // Ответ отправит _handleUploadDone по итогу, записанному здесь
+    RequestState* state = (RequestState*)request->_tempObject;
+
     String extension = filename.substring(filename.lastIndexOf('.') + 1);
 
     if (index == 0) {
         Serial.printf("Upload start: %s\n", filename.c_str());
         totalSize = 0;
-        updateFailed = false;
 
         if (extension == "bin") {
             isFirmwareUpdate = true;
@@ -250,8 +1289,8 @@ void WebServerManager::_handleFileUpload(AsyncWebServerRequest *request, const S
             uint32_t maxSketchSpace = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
             if (!Update.begin(maxSketchSpace, U_FLASH)) {
                 Update.printError(Serial);
-                request->send(500, "text/plain", "OTA Begin Failed");
-                updateFailed = true;
+                state->status = 500;
+                state->message = "OTA Begin Failed";
                 return;
             }
             Serial.println("Firmware update started...");
@@ -261,21 +1300,21 @@ void WebServerManager::_handleFileUpload(AsyncWebServerRequest *request, const S
             _uploadFile = SPIFFS.open(path, "w");
             if (!_uploadFile) {
                 Serial.printf("Failed to open file %s for writing\n", path.c_str());
-                request->send(500, "text/plain", "File open error");
-                updateFailed = true;
+                state->status = 500;
+                state->message = "File open error";
                 return;
             }
             Serial.printf("File upload started: %s\n", path.c_str());
         }
     }
 
-    if (len > 0 && !updateFailed) {
+    if (len > 0 && state->status == 0) {
         totalSize += len;
         if (isFirmwareUpdate) {
             if (Update.write(data, len) != len) {
                 Update.printError(Serial);
-                request->send(500, "text/plain", "OTA Write Error");
-                updateFailed = true;
+                state->status = 500;
+                state->message = "OTA Write Error";
                 return;
             }
         } else {
@@ -286,27 +1325,24 @@ void WebServerManager::_handleFileUpload(AsyncWebServerRequest *request, const S
     }
 
     if (final) {
-        if (updateFailed) {
-
-            return;
-        }
+        if (state->status != 0) return;
 
         if (isFirmwareUpdate) {
             if (Update.end(true)) {
                 Serial.println("Update Complete. Rebooting...");
-                request->send(200, "text/plain", "OTA Complete");
-
-                delay(300);
+                state->message = "OTA Complete";
                 _settingsManager.settings.isRebootRequested = true;
             } else {
                 Update.printError(Serial);
-                request->send(500, "text/plain", "OTA End Failed");
+                state->status = 500;
+                state->message = "OTA End Failed";
             }
         } else {
             if (_uploadFile) {
                 _uploadFile.close();
                 Serial.printf("File %s upload complete\n", filename.c_str());
-                request->send(200, "text/plain", "File Uploaded Successfully");
+                _resolveIndex();
+                state->message = "File Uploaded Successfully";
             }
         }
     }
@@ -8,27 +8,178 @@
 #include <ArduinoJson.h>
 #include "settings.h"
 #include "control.h"
+#include "profiler.h"
+#include "history.h"
+#include "rollup.h"
+#include "downsample.h"
+#include "event_journal.h"
+#include "telemetry_store.h"
+#include "json_writer.h"
+#include "ui_bundle.h"
+#include "scheduler.h"
 
 class WebServerManager {
 public:
-    WebServerManager(SettingsManager& settingsManager, ControlManager& controlManager);
+    WebServerManager(SettingsManager& settingsManager, ControlManager& controlManager, HistoryManager& historyManager,
+                     RollupManager& rollupManager, EventJournal& eventJournal, TelemetryStore& telemetryStore,
+                     TaskScheduler& scheduler);
     void begin();
-    void loop() {}
+    void loop();
 
 private:
+    typedef void (WebServerManager::*RequestHandler)(AsyncWebServerRequest *request);
+    typedef void (WebServerManager::*UploadHandler)(AsyncWebServerRequest *request, const String& filename, size_t index,
+                                                     uint8_t *data, size_t len, bool final);
+    typedef void (WebServerManager::*BodyHandler)(AsyncWebServerRequest *request, uint8_t *data, size_t len,
+                                                   size_t index, size_t total);
+
+    enum RouteClass : uint8_t {
+        ROUTE_CLASS_CONTROL = 0,
+        ROUTE_CLASS_LIVE,
+        ROUTE_CLASS_API,
+        ROUTE_CLASS_WRITE,
+        ROUTE_CLASS_ASSET,
+        ROUTE_CLASS_COUNT
+    };
+
+    struct RouteClassLimits {
+        const char* name;
+        uint8_t maxInFlight;
+        uint16_t minFreeHeap;
+        uint16_t minFreeBlock;
+        uint8_t retryAfterSec;
+    };
+
+    struct Route {
+        const char* path;
+        WebRequestMethodComposite method;
+        RouteClass routeClass;
+        RequestHandler handler;
+        UploadHandler upload;
+        BodyHandler body;
+        size_t maxBodySize;
+    };
+
+    // Состояние запроса с телом или загрузкой файла. Создаётся на первом
+    // куске и лежит в request->_tempObject; библиотека освобождает его free()
+    // вместе с запросом. Тело, если есть, хранится сразу за структурой.
+    struct RequestState {
+        bool isAdmitted;
+        uint16_t status;          // ошибка обработчика загрузки, 0 - нет
+        const char* message;
+        size_t bodyLength;
+        char* body() { return (char*)(this + 1); }
+    };
+
+    struct KnownPath {
+        const char* path;
+        int code;
+    };
+
+    static const uint8_t MAX_ROUTES = 24;
+    static const uint8_t MAX_KNOWN_PATHS = 16;
+    static const Route ROUTES[];
+    static const RouteClassLimits ROUTE_CLASS_LIMITS[ROUTE_CLASS_COUNT];
+    static const KnownPath KNOWN_PATHS[];
+    static const uint8_t ROUTE_COUNT;
+    static const uint8_t KNOWN_PATH_COUNT;
+
     AsyncWebServer server;
     SettingsManager& _settingsManager;
     ControlManager& _controlManager;
+    HistoryManager& _historyManager;
+    RollupManager& _rollupManager;
+    EventJournal& _eventJournal;
+    TelemetryStore& _telemetryStore;
+    TaskScheduler& _scheduler;
 
     File _uploadFile;
 
+    // Счётчики обращений: по маршрутам, по известным служебным адресам и
+    // по прочим неизвестным адресам
+    uint32_t _routeHits[MAX_ROUTES] = {0};
+    uint32_t _knownPathHits[MAX_KNOWN_PATHS] = {0};
+    uint32_t _navigationHits = 0;
+    uint32_t _assetMissHits = 0;
+    uint32_t _otherMissHits = 0;
+
+    uint8_t _inFlight[ROUTE_CLASS_COUNT] = {0};
+    uint32_t _rejectedHits[ROUTE_CLASS_COUNT] = {0};
+    static const uint8_t MAX_LIVE_CLIENTS = 4;
+
+    // Варианты index из SPIFFS; если их нет, страница берётся из бандла
+    struct IndexVariant {
+        const char* path;
+        const char* encoding;
+        size_t size;
+        char etag[12];
+    };
+    IndexVariant _indexVariants[2];
+    uint8_t _indexVariantCount = 0;
+    char _indexLastModified[30] = "";
+
+    // Готовый JSON /getLiveData в двух буферах: отдаётся передний, новый
+    // рисуется в задний, пока его не читает ни один ответ.
+    static const size_t LIVE_SNAPSHOT_SIZE = 512;
+    static const size_t SETTINGS_RESPONSE_SIZE = 1536;
+    static const size_t ROUTE_STATS_RESPONSE_SIZE = 1536;
+    static const size_t TIMINGS_RESPONSE_SIZE = 3072;
+    static const size_t SETTINGS_DOC_SIZE = 4096;
+    static const size_t SETTINGS_PATCH_BODY_SIZE = 1024;
+    static const size_t SETTINGS_PATCH_DOC_SIZE = 1536;
+    static const size_t SETTINGS_PATCH_FILTER_SIZE = 1024;
+    static const size_t SETTINGS_PATCH_RESPONSE_SIZE = 1024;
+    char _liveSnapshot[2][LIVE_SNAPSHOT_SIZE];
+    uint16_t _liveSnapshotLength[2] = {0};
+    uint8_t _liveSnapshotReaders[2] = {0};
+    uint8_t _liveSnapshotFront = 0;
+    uint32_t _liveSnapshotEtag = 0;
+    uint32_t _liveSnapshotStateVersion = 0;
+    bool _isLiveSnapshotValid = false;
+
+    AsyncEventSource _liveEvents;
+    uint16_t _liveDistanceMm[CONTROL_MAX_CHANNELS] = {0};
+    uint8_t _livePumpMask = 0;
+    uint8_t _liveErrorMask = 0;
+    bool _liveManualMode = false;
+    unsigned long _liveSentMs = 0;
+
+    bool _hasCapacity(RouteClass routeClass);
+    void _sendRejected(AsyncWebServerRequest *request, RouteClass routeClass);
+    bool _admitRequest(AsyncWebServerRequest *request, RouteClass routeClass);
+    void _trackRequest(AsyncWebServerRequest *request, RouteClass routeClass);
+    RequestState* _beginStream(AsyncWebServerRequest *request, RouteClass routeClass, size_t bodyLength);
+    void _handleGetIndex(AsyncWebServerRequest *request);
+    void _handleNotFound(AsyncWebServerRequest *request);
+    void _handleGetRouteStats(AsyncWebServerRequest *request);
+    void _handleUploadDone(AsyncWebServerRequest *request);
     void _handleGetAllSettings(AsyncWebServerRequest *request);
     void _handleGetLiveData(AsyncWebServerRequest *request);
+    void _writeLiveData(JsonWriter& json);
+    bool _refreshLiveSnapshot();
+    bool _isLiveDataChanged();
+    void _rememberLiveData();
+#if PROFILING_ENABLED
+    void _handleGetTimings(AsyncWebServerRequest *request);
+#endif
     void _handleSaveSettings(AsyncWebServerRequest *request);
+    void _handlePatchSettings(AsyncWebServerRequest *request);
+    void _handlePatchSettingsBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
     void _handleSetPump(AsyncWebServerRequest *request);
     void _handleResetManualMode(AsyncWebServerRequest *request);
+    void _handleGetSonarTrace(AsyncWebServerRequest *request);
+    void _handleSetSonarTrace(AsyncWebServerRequest *request);
+    void _handleGetHistory(AsyncWebServerRequest *request);
+    void _handleGetRollups(AsyncWebServerRequest *request);
+    void _handleGetHistoryRange(AsyncWebServerRequest *request);
+    void _handleGetEvents(AsyncWebServerRequest *request);
+    void _handleGetTelemetry(AsyncWebServerRequest *request);
     void _handleFileUpload(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final);
 
+    void _handleGetAsset(AsyncWebServerRequest *request);
+    void _resolveIndex();
+    const IndexVariant* _selectIndexVariant(const char* acceptEncoding) const;
+    bool _isIndexNotModified(AsyncWebServerRequest *request, const char* etag);
     AsyncWebServerResponse* _getIndexResponse(AsyncWebServerRequest *request);
     String _getHTTPDate(time_t timestamp);
 };
@@ -21,8 +21,7 @@ void WiFiManager::begin() {
 }
 
 void WiFiManager::loop() {
-
-   MDNS.update();
+    PROFILE_SCOPE(PROFILE_WIFI_LOOP);
 
     if (!_settingsManager.settings.isWifiTurnedOn || _settingsManager.settings.isAP) {
         return;
@@ -123,6 +122,14 @@ bool WiFiManager::isConnected() const {
     return (WiFi.status() == WL_CONNECTED);
 }
 
+bool WiFiManager::isConnecting() const {
+    return _isConnecting;
+}
+
+bool WiFiManager::isInFallbackAP() const {
+    return _isInFallbackAP;
+}
+
 String WiFiManager::getStatusString() const {
     switch (WiFi.status()) {
         case WL_CONNECTED: return "Connected";
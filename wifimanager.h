@@ -5,6 +5,7 @@
 #include <ESP8266WiFi.h>
 #include <ESP8266mDNS.h>
 #include "settings.h"
+#include "profiler.h"
 
 class WiFiManager {
 public:
@@ -18,6 +19,9 @@ public:
     void connectToWiFi();
 
     bool isConnected() const;
+    bool isConnecting() const;
+    // Точка доступа поднята потому, что не удалось подключиться к сети
+    bool isInFallbackAP() const;
     String getStatusString() const;
 
 private: